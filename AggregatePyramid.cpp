@@ -0,0 +1,227 @@
+
+#include<algorithm>
+
+#include "AggregatePyramid.h"
+
+const unsigned AggregatePyramid::MEASUREMENT_TYPES;
+
+AggregatePyramid::AggregatePyramid()
+{
+    m_built = true;
+}
+
+void AggregatePyramid::Add( const WindRecType &windRecType )
+{
+    Date date = windRecType.GetRecordDate();
+    unsigned timestamp = Timestamp::Pack( date, windRecType.GetRecordTime() );
+    float readings[MEASUREMENT_TYPES];
+
+    readings[unsigned( MeasurementType::WINDSPEED )] = windRecType.GetRecordWindSpeed().GetMeasurement();
+    readings[unsigned( MeasurementType::TEMPERATURE )] = windRecType.GetRecordTemperature().GetMeasurement();
+    readings[unsigned( MeasurementType::SOLARRADIATION )] = windRecType.GetRecordSolarRadiation().GetMeasurement();
+
+    AddToNode( TEN_MINUTE, GetKey( timestamp, TEN_MINUTE ), readings );
+    AddToNode( HOURLY, GetKey( timestamp, HOURLY ), readings );
+    AddToNode( DAILY, GetKey( timestamp, DAILY ), readings );
+    AddToNode( MONTHLY, date.GetYear() * 12 + date.GetMonth() - 1, readings );
+    AddToNode( YEARLY, date.GetYear(), readings );
+}
+
+void AggregatePyramid::Build()
+{
+    if( m_built )
+    {
+        return;
+    }
+
+    for( unsigned level(0); level < LEVELS; level++ )
+    {
+        Vector<Node> &nodes = m_levels[level];
+        unsigned used = 0;
+
+        std::stable_sort( nodes.Start(), nodes.Finish(), []( const Node &left, const Node &right )
+        {
+            return left.key < right.key;
+        } );
+
+        // Nodes of the same key are now adjacent, and are merged into the first of them
+        for( unsigned index(0); index < nodes.GetUsed(); index++ )
+        {
+            if( used > 0 && nodes[used - 1].key == nodes[index].key )
+            {
+                for( unsigned type(0); type < MEASUREMENT_TYPES; type++ )
+                {
+                    nodes[used - 1].summaries[type].Merge( nodes[index].summaries[type] );
+                }
+            }
+            else
+            {
+                nodes[used] = nodes[index];
+                used++;
+            }
+        }
+        nodes.SetSize( used );
+    }
+    m_built = true;
+}
+
+void AggregatePyramid::Clear()
+{
+    for( unsigned level(0); level < LEVELS; level++ )
+    {
+        m_levels[level].SetSize( 0 );
+    }
+    m_built = true;
+}
+
+bool AggregatePyramid::IsBuilt() const
+{
+    return m_built;
+}
+
+unsigned AggregatePyramid::GetNodeCount( Level level ) const
+{
+    return m_levels[level].GetUsed();
+}
+
+MeasurementAccumulator AggregatePyramid::GetRangeSummary( const unsigned &start, const unsigned &end, MeasurementType measurementType ) const
+{
+    MeasurementAccumulator summary;
+
+    if( m_built )
+    {
+        Collect( start, end, YEARLY, unsigned( measurementType ), summary );
+    }
+    return summary;
+}
+
+unsigned AggregatePyramid::GetKey( const unsigned &timestamp, Level level )
+{
+    Date date;
+    Time time;
+
+    switch( level )
+    {
+    case TEN_MINUTE:
+        return timestamp / 10;
+    case HOURLY:
+        return timestamp / Timestamp::MINUTES_PER_HOUR;
+    case DAILY:
+        return timestamp / Timestamp::MINUTES_PER_DAY;
+    case MONTHLY:
+        Timestamp::Unpack( timestamp, date, time );
+        return date.GetYear() * 12 + date.GetMonth() - 1;
+    case YEARLY:
+    default:
+        Timestamp::Unpack( timestamp, date, time );
+        return date.GetYear();
+    }
+}
+
+unsigned AggregatePyramid::GetNodeStart( const unsigned &key, Level level )
+{
+    switch( level )
+    {
+    case TEN_MINUTE:
+        return key * 10;
+    case HOURLY:
+        return key * Timestamp::MINUTES_PER_HOUR;
+    case DAILY:
+        return key * Timestamp::MINUTES_PER_DAY;
+    case MONTHLY:
+        return Timestamp::Pack( 1, key % 12 + 1, key / 12 );
+    case YEARLY:
+    default:
+        return Timestamp::Pack( 1, 1, key );
+    }
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void AggregatePyramid::AddToNode( const unsigned &level, const unsigned &key, const float readings[] )
+{
+    Vector<Node> &nodes = m_levels[level];
+    unsigned used = nodes.GetUsed();
+    unsigned index = used;
+
+    if( used > 0 && nodes[used - 1].key == key )
+    {
+        index = used - 1;
+    }
+    else
+    {
+        if( used > 0 && key < nodes[used - 1].key )
+        {
+            m_built = false;
+        }
+        Node node;
+        node.key = key;
+        nodes.InsertLast( node );
+    }
+
+    for( unsigned type(0); type < MEASUREMENT_TYPES; type++ )
+    {
+        nodes[index].summaries[type].Add( readings[type] );
+    }
+}
+
+void AggregatePyramid::Collect( const unsigned &start, const unsigned &end, const unsigned &level, const unsigned &type, MeasurementAccumulator &summary ) const
+{
+    if( end <= start )
+    {
+        return;
+    }
+
+    Level pyramidLevel = Level( level );
+    unsigned firstKey = GetKey( start, pyramidLevel );
+    if( GetNodeStart( firstKey, pyramidLevel ) < start )
+    {
+        firstKey++;
+    }
+
+    // The finest level takes every node starting in the range. A coarser level only takes the nodes
+    // that also end inside it, and leaves the partial nodes at each edge to the level below.
+    unsigned endKey = GetKey( end, pyramidLevel );
+    if( level == TEN_MINUTE && GetNodeStart( endKey, pyramidLevel ) < end )
+    {
+        endKey++;
+    }
+    if( level > TEN_MINUTE && firstKey >= endKey )
+    {
+        Collect( start, end, level - 1, type, summary );
+        return;
+    }
+
+    const Vector<Node> &nodes = m_levels[level];
+    for( unsigned index( LowerBound( level, firstKey ) ); index < nodes.GetUsed() && nodes[index].key < endKey; index++ )
+    {
+        summary.Merge( nodes[index].summaries[type] );
+    }
+
+    if( level > TEN_MINUTE )
+    {
+        Collect( start, GetNodeStart( firstKey, pyramidLevel ), level - 1, type, summary );
+        Collect( GetNodeStart( endKey, pyramidLevel ), end, level - 1, type, summary );
+    }
+}
+
+unsigned AggregatePyramid::LowerBound( const unsigned &level, const unsigned &key ) const
+{
+    const Vector<Node> &nodes = m_levels[level];
+    unsigned low = 0;
+    unsigned high = nodes.GetUsed();
+
+    while( low < high )
+    {
+        unsigned middle = low + ( high - low ) / 2;
+        if( nodes[middle].key < key )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
@@ -0,0 +1,161 @@
+/**
+ * @file AggregatePyramid.h
+ * @brief Defines the AggregatePyramid class, pre-aggregated summaries at 10 minute, hour, day, month and year resolution.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef AGGREGATEPYRAMID_H_INCLUDED
+#define AGGREGATEPYRAMID_H_INCLUDED
+
+#include "Vector.h"
+#include "WindRecType.h"
+#include "MeasurementType.h"
+#include "MeasurementAccumulator.h"
+#include "Timestamp.h"
+
+/**
+* @brief Represents a pyramid of mergeable summaries of every measurement over five time resolutions.
+*
+* Each level holds one node per 10 minutes, hour, day, month or year that has data, and each node
+* holds a MeasurementAccumulator per measurement. A [start, end) query takes the whole years inside
+* the range from the top level, then fills the partial years at each edge with whole months, the
+* partial months with whole days, and so on down to 10 minute nodes. The number of nodes merged is
+* bounded by the fan out of the levels, whatever the length of the range or the size of the archive.
+*
+* Records are added incrementally. A record in time order updates or extends the last node of each
+* level in constant time. An older record is appended as a node of its own and marks the pyramid as
+* not built, and Build() must be called before it is queried again, so loading unsorted files costs a
+* sort per level rather than an insertion per record. A node belongs to a range when its start lies
+* inside the range, so boundaries inside a 10 minute interval round up to the next one.
+*/
+class AggregatePyramid
+{
+public:
+    static const unsigned MEASUREMENT_TYPES = 3;    ///< Number of measurement types summarised.
+
+    /**
+    * @brief Levels of the pyramid, from the finest to the coarsest.
+    */
+    enum Level
+    {
+        TEN_MINUTE,
+        HOURLY,
+        DAILY,
+        MONTHLY,
+        YEARLY,
+        LEVELS
+    };
+
+    /**
+    * @brief Default constructor.
+    * @post Creates an empty AggregatePyramid.
+    */
+    AggregatePyramid();
+
+    /**
+    * @brief Adds a wind record to the node of its time at every level.
+    *
+    * @param[in] windRecType The wind record to add.
+    */
+    void Add( const WindRecType &windRecType );
+
+    /**
+    * @brief Sorts the nodes of each level by key and merges the nodes of the same key, if any record was added out of order.
+    * @post The pyramid is built and can be queried.
+    */
+    void Build();
+
+    /**
+    * @brief Removes every node from the pyramid.
+    * @post The pyramid is empty and built.
+    */
+    void Clear();
+
+    /**
+    * @brief Checks whether the pyramid can be queried.
+    *
+    * @return false if a record was added out of time order since the last Build(), true otherwise.
+    */
+    bool IsBuilt() const;
+
+    /**
+    * @brief Getter for the number of nodes in a level.
+    *
+    * @param[in] level The level of the pyramid.
+    * @return The number of nodes holding data.
+    */
+    unsigned GetNodeCount( Level level ) const;
+
+    /**
+    * @brief Summarises a measurement over a time range.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @return The count, sum, M2, minimum and maximum of the readings in the range, empty if the pyramid is not built.
+    */
+    MeasurementAccumulator GetRangeSummary( const unsigned &start, const unsigned &end, MeasurementType measurementType ) const;
+
+    /**
+    * @brief Finds the key of the node holding a timestamp.
+    *
+    * @param[in] timestamp The packed timestamp.
+    * @param[in] level The level of the pyramid.
+    * @return The key of the node, ordered by time within the level.
+    */
+    static unsigned GetKey( const unsigned &timestamp, Level level );
+
+    /**
+    * @brief Finds the start of a node.
+    *
+    * @param[in] key The key of the node.
+    * @param[in] level The level of the pyramid.
+    * @return The packed timestamp of the start of the node.
+    */
+    static unsigned GetNodeStart( const unsigned &key, Level level );
+
+private:
+
+    /**
+    * @brief The summaries of one period of a level.
+    */
+    struct Node
+    {
+        unsigned key;                                           ///< Key of the period, see GetKey().
+        MeasurementAccumulator summaries[MEASUREMENT_TYPES];    ///< Summaries indexed by measurement type.
+    };
+
+    Vector<Node> m_levels[LEVELS];      ///< Nodes of each level, in ascending key order once built.
+    bool m_built;                       ///< False while nodes are out of key order.
+
+    /**
+    * @brief Adds the readings of a record to the last node if it has the key, or to a new node after it.
+    *
+    * @param[in] level The level of the pyramid.
+    * @param[in] key The key of the node.
+    * @param[in] readings The readings of the record, indexed by measurement type.
+    */
+    void AddToNode( const unsigned &level, const unsigned &key, const float readings[] );
+
+    /**
+    * @brief Merges the nodes of a level whose start lies in a range, filling the edges from the finer levels.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] level The coarsest level to take whole nodes from.
+    * @param[in] type The measurement type index.
+    * @param[in,out] summary The summary the nodes are merged into.
+    */
+    void Collect( const unsigned &start, const unsigned &end, const unsigned &level, const unsigned &type, MeasurementAccumulator &summary ) const;
+
+    /**
+    * @brief Binary searches for the position of a key in a level.
+    *
+    * @param[in] level The level of the pyramid.
+    * @param[in] key The key to search for.
+    * @return The position of the key, or the position it would be inserted at.
+    */
+    unsigned LowerBound( const unsigned &level, const unsigned &key ) const;
+};
+
+#endif // AGGREGATEPYRAMID_H_INCLUDED
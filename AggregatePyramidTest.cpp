@@ -0,0 +1,139 @@
+#include<iostream>
+#include<cstdlib>
+#include<cmath>
+
+#include "AggregatePyramid.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestInitialization( const AggregatePyramid &aggregatePyramid );
+void TestLevels();
+void TestAgainstScan();
+void TestOutOfOrderAdd();
+
+int main()
+{
+    AggregatePyramid aggregatePyramid;
+
+    TestInitialization( aggregatePyramid );
+    TestLevels();
+    TestAgainstScan();
+    TestOutOfOrderAdd();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestInitialization( const AggregatePyramid &aggregatePyramid )
+{
+    cout << "Test on Default AggregatePyramid Object" << endl;
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::TEN_MINUTE ) == 0, "Default AggregatePyramid has no nodes" );
+    Assert( aggregatePyramid.GetRangeSummary( 0, 4000000000u, MeasurementType::WINDSPEED ).GetCount() == 0, "Default AggregatePyramid has an empty range" );
+    cout << endl;
+}
+
+void TestLevels()
+{
+    AggregatePyramid aggregatePyramid;
+
+    aggregatePyramid.Add( WindRecType( Date( 31, 12, 2015 ), Time( 23, 50 ), WindSpeed( 2 ), SolarRadiation( 0 ), Temperature( 20 ) ) );
+    aggregatePyramid.Add( WindRecType( Date( 1, 1, 2016 ), Time( 0, 0 ), WindSpeed( 4 ), SolarRadiation( 0 ), Temperature( 22 ) ) );
+    aggregatePyramid.Add( WindRecType( Date( 1, 1, 2016 ), Time( 0, 10 ), WindSpeed( 6 ), SolarRadiation( 0 ), Temperature( 24 ) ) );
+
+    unsigned newYear = Timestamp::Pack( 1, 1, 2016 );
+
+    cout << "Test on pyramid levels" << endl;
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::TEN_MINUTE ) == 3, "Each 10 minute reading has its own node" );
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::HOURLY ) == 2, "Readings share the hour after midnight" );
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::YEARLY ) == 2, "Readings span 2 years" );
+    Assert( AggregatePyramid::GetNodeStart( AggregatePyramid::GetKey( newYear + 70, AggregatePyramid::MONTHLY ), AggregatePyramid::MONTHLY ) == newYear, "Month node starts on the 1st" );
+    Assert( aggregatePyramid.GetRangeSummary( newYear, newYear + 60, MeasurementType::WINDSPEED ).GetSum() == 10, "First hour of 2016 sums to 10" );
+    Assert( aggregatePyramid.GetRangeSummary( newYear - 10, newYear + 10, MeasurementType::TEMPERATURE ).GetMaximum() == 22, "Range across the year boundary has maximum 22" );
+    cout << endl;
+}
+
+void TestAgainstScan()
+{
+    AggregatePyramid aggregatePyramid;
+    const unsigned rows = 20000;
+    const unsigned cadence = 50;
+    unsigned origin = Timestamp::Pack( 1, 11, 2015 );
+    float readings[rows];
+
+    srand( 283 );
+    for( unsigned i(0); i < rows; i++ )
+    {
+        Date date;
+        Time time;
+        Timestamp::Unpack( origin + i * cadence, date, time );
+        readings[i] = float( rand() % 1000 ) / 10.0f;
+        aggregatePyramid.Add( WindRecType( date, time, WindSpeed( readings[i] ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    }
+
+    bool countsMatch = true;
+    bool meansMatch = true;
+    bool deviationsMatch = true;
+    bool extremesMatch = true;
+    for( unsigned query(0); query < 300; query++ )
+    {
+        unsigned start = origin + unsigned( rand() % ( rows * cadence ) );
+        unsigned end = start + unsigned( rand() % ( rows * cadence ) );
+        MeasurementAccumulator expected;
+        for( unsigned i(0); i < rows; i++ )
+        {
+            unsigned timestamp = origin + i * cadence;
+            unsigned nodeStart = timestamp - timestamp % 10;
+            if( nodeStart >= start && nodeStart < end )
+            {
+                expected.Add( readings[i] );
+            }
+        }
+
+        MeasurementAccumulator actual = aggregatePyramid.GetRangeSummary( start, end, MeasurementType::WINDSPEED );
+        countsMatch = countsMatch && actual.GetCount() == expected.GetCount();
+        meansMatch = meansMatch && fabs( actual.GetMean() - expected.GetMean() ) < 1e-3;
+        deviationsMatch = deviationsMatch && fabs( actual.GetSampleStandardDeviation() - expected.GetSampleStandardDeviation() ) < 1e-3;
+        extremesMatch = extremesMatch && actual.GetMinimum() == expected.GetMinimum() && actual.GetMaximum() == expected.GetMaximum();
+    }
+
+    cout << "Test on random ranges against a scan" << endl;
+    Assert( countsMatch, "Every count matches a scan" );
+    Assert( meansMatch, "Every mean matches a scan" );
+    Assert( deviationsMatch, "Every sample standard deviation matches a scan" );
+    Assert( extremesMatch, "Every minimum and maximum matches a scan" );
+    cout << endl;
+}
+
+void TestOutOfOrderAdd()
+{
+    AggregatePyramid aggregatePyramid;
+
+    aggregatePyramid.Add( WindRecType( Date( 1, 1, 2016 ), Time( 0, 0 ), WindSpeed( 10 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    aggregatePyramid.Add( WindRecType( Date( 1, 1, 2015 ), Time( 0, 0 ), WindSpeed( 20 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    aggregatePyramid.Add( WindRecType( Date( 2, 1, 2015 ), Time( 0, 0 ), WindSpeed( 30 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+
+    aggregatePyramid.Add( WindRecType( Date( 1, 1, 2016 ), Time( 0, 5 ), WindSpeed( 40 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+
+    cout << "Test on out of order add" << endl;
+    Assert( !aggregatePyramid.IsBuilt(), "Out of order add leaves the pyramid unbuilt" );
+    Assert( aggregatePyramid.GetRangeSummary( 0, 4000000000u, MeasurementType::WINDSPEED ).GetCount() == 0, "An unbuilt pyramid has an empty range" );
+    aggregatePyramid.Build();
+    Assert( aggregatePyramid.IsBuilt(), "Build() builds the pyramid" );
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::DAILY ) == 3, "Build() merges the nodes of the same day" );
+    Assert( aggregatePyramid.GetNodeCount( AggregatePyramid::YEARLY ) == 2, "Build() merges the nodes of the same year" );
+    Assert( aggregatePyramid.GetRangeSummary( Timestamp::Pack( 1, 1, 2016 ), Timestamp::Pack( 2, 1, 2016 ), MeasurementType::WINDSPEED ).GetSum() == 50, "2016 sums the records added either side of the older ones" );
+    Assert( aggregatePyramid.GetRangeSummary( Timestamp::Pack( 1, 1, 2015 ), Timestamp::Pack( 1, 1, 2016 ), MeasurementType::WINDSPEED ).GetSum() == 50, "2015 sums the records added out of order" );
+    cout << endl;
+}
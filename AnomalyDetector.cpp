@@ -0,0 +1,172 @@
+#include "AnomalyDetector.h"
+
+#include<cmath>
+
+#include "Timestamp.h"
+
+namespace
+{
+// Median absolute deviations in one standard deviation of normal readings
+const float MAD_TO_DEVIATION = 1.4826f;
+// Largest move of the median and its deviation per reading, in robust deviations
+const float ROBUST_STEP = 0.1f;
+
+float Sign( const float &value )
+{
+    return value > 0.0f ? 1.0f : ( value < 0.0f ? -1.0f : 0.0f );
+}
+}
+
+const unsigned AnomalyDetector::SPIKE;
+const unsigned AnomalyDetector::OUTLIER;
+const unsigned AnomalyDetector::STUCK;
+const unsigned AnomalyDetector::MEASUREMENT_TYPES;
+const float AnomalyDetector::DEFAULT_THRESHOLD = 6.0f;
+const unsigned AnomalyDetector::DEFAULT_BASELINE_LENGTH = 144;
+const unsigned AnomalyDetector::DEFAULT_STUCK_LENGTH = 18;
+const unsigned AnomalyDetector::WARMUP_LENGTH = 12;
+
+AnomalyDetector::AnomalyDetector( const float &threshold, const unsigned &baselineLength, const unsigned &stuckLength )
+    : m_threshold( threshold ),
+      m_weight( 2.0f / ( baselineLength + 1 ) ),
+      m_stuckLength( stuckLength )
+{
+    Clear();
+}
+
+unsigned AnomalyDetector::Check( const WindRecType &windRecType, const std::function<void( const Anomaly & )> &emit )
+{
+    const float readings[MEASUREMENT_TYPES] =
+    {
+        windRecType.GetRecordWindSpeed().GetMeasurement(),
+        windRecType.GetRecordTemperature().GetMeasurement(),
+        windRecType.GetRecordSolarRadiation().GetMeasurement()
+    };
+    unsigned timestamp = Timestamp::Pack( windRecType.GetRecordDate(), windRecType.GetRecordTime() );
+    unsigned flagged = 0;
+
+    for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+    {
+        MeasurementType measurementType = MeasurementType( i );
+        float median = 0.0;
+        unsigned kinds = CheckReading( measurementType, readings[i], median );
+
+        if( kinds != 0 )
+        {
+            flagged ++;
+            if( emit )
+            {
+                emit( Anomaly{ timestamp, measurementType, readings[i], median, kinds } );
+            }
+        }
+    }
+    m_flagged += flagged;
+    return flagged;
+}
+
+void AnomalyDetector::Clear()
+{
+    for( Baseline &baseline : m_baselines )
+    {
+        baseline = Baseline{ 0, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0 };
+    }
+    m_flagged = 0;
+}
+
+unsigned AnomalyDetector::GetFlaggedCount() const
+{
+    return m_flagged;
+}
+
+string AnomalyDetector::GetKindNames( const unsigned &kinds )
+{
+    string names;
+
+    if( kinds & SPIKE )
+    {
+        names += "spike";
+    }
+    if( kinds & OUTLIER )
+    {
+        names += names.empty() ? "outlier" : "|outlier";
+    }
+    if( kinds & STUCK )
+    {
+        names += names.empty() ? "stuck" : "|stuck";
+    }
+    return names;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+unsigned AnomalyDetector::CheckReading( MeasurementType measurementType, const float &reading, float &median )
+{
+    Baseline &baseline = m_baselines[unsigned( measurementType )];
+    float floor = GetSpreadFloor( measurementType );
+    unsigned kinds = 0;
+
+    median = baseline.median;
+    if( !std::isfinite( reading ) )
+    {
+        return 0;
+    }
+    if( baseline.count == 0 )
+    {
+        baseline = Baseline{ 1, reading, 0.0f, reading, 0.0f, reading, 1 };
+        return 0;
+    }
+
+    // Flag against the baseline as it was before the reading
+    float robustSpread = fmax( MAD_TO_DEVIATION * baseline.deviation, floor );
+    if( baseline.count >= WARMUP_LENGTH )
+    {
+        if( fabs( reading - baseline.mean ) > m_threshold * fmax( sqrt( baseline.variance ), floor ) )
+        {
+            kinds |= SPIKE;
+        }
+        if( fabs( reading - baseline.median ) > m_threshold * robustSpread )
+        {
+            kinds |= OUTLIER;
+        }
+    }
+    baseline.run = ( reading == baseline.last ) ? baseline.run + 1 : 1;
+    baseline.last = reading;
+    if( reading != 0.0f && baseline.run >= m_stuckLength )
+    {
+        kinds |= STUCK;
+    }
+
+    // Exponentially weighted mean and variance
+    float difference = reading - baseline.mean;
+    float increment = m_weight * difference;
+    baseline.mean += increment;
+    baseline.variance = ( 1.0f - m_weight ) * ( baseline.variance + difference * increment );
+
+    // The median and its deviation move towards the reading by at most a bounded step,
+    // so they settle on the middle of the readings and a spike only nudges them
+    float step = ROBUST_STEP * robustSpread;
+    float distance = reading - baseline.median;
+    baseline.median += Sign( distance ) * fmin( fabs( distance ), step );
+    float spread = fabs( distance ) - baseline.deviation;
+    baseline.deviation += Sign( spread ) * fmin( fabs( spread ), step );
+
+    if( baseline.count < WARMUP_LENGTH )
+    {
+        baseline.count ++;
+    }
+    return kinds;
+}
+
+float AnomalyDetector::GetSpreadFloor( MeasurementType measurementType )
+{
+    switch( measurementType )
+    {
+    case MeasurementType::WINDSPEED:
+        return 1.0f;
+    case MeasurementType::TEMPERATURE:
+        return 1.0f;
+    case MeasurementType::SOLARRADIATION:
+    default:
+        return 50.0f;
+    }
+}
@@ -0,0 +1,144 @@
+/**
+ * @file AnomalyDetector.h
+ * @brief Defines the AnomalyDetector class, which flags suspect readings as the records are loaded.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef ANOMALYDETECTOR_H_INCLUDED
+#define ANOMALYDETECTOR_H_INCLUDED
+
+#include<string>
+#include<functional>
+
+#include "WindRecType.h"
+#include "MeasurementType.h"
+
+using namespace std;
+
+/**
+* @brief Flags readings that stray from a rolling baseline of their measurement, in one streaming pass.
+*
+* Each measurement keeps a fixed handful of numbers, whatever the number of records:
+*
+*   an exponentially weighted mean and variance, for a z-score against the recent readings;
+*   a streaming estimate of the median and of the median absolute deviation, each moved a bounded
+*   step towards every reading, so a single spike barely shifts them;
+*   the last reading and the length of its run, for sensors stuck on one value.
+*
+* A reading is a spike when its z-score is over the threshold, an outlier when its distance from
+* the median is over the threshold in robust deviations, and stuck when the same non zero reading
+* repeats for the stuck length. Zero runs are left alone, as calm nights and the dark are real.
+* Spreads are never taken below a floor per measurement, so a near constant baseline, such as
+* solar radiation before sunrise, does not flag the first ordinary change.
+*
+* Records are checked in the order they are loaded, which is time order within each file. The
+* first readings only build the baseline and are never flagged.
+*/
+class AnomalyDetector
+{
+public:
+    static const unsigned SPIKE = 1;                    ///< Kind of a reading whose z-score is over the threshold.
+    static const unsigned OUTLIER = 2;                  ///< Kind of a reading far from the median in robust deviations.
+    static const unsigned STUCK = 4;                    ///< Kind of a reading repeating for the stuck length.
+    static const unsigned MEASUREMENT_TYPES = 3;        ///< Number of measurement types checked.
+    static const float DEFAULT_THRESHOLD;               ///< Deviations a reading may stray before it is flagged.
+    static const unsigned DEFAULT_BASELINE_LENGTH;      ///< Readings the baseline mostly remembers, a day of 10 minute readings.
+    static const unsigned DEFAULT_STUCK_LENGTH;         ///< Repeats of one reading that flag it, 3 hours of 10 minute readings.
+    static const unsigned WARMUP_LENGTH;                ///< Readings a baseline needs before it flags anything.
+
+    /**
+    * @brief A flagged reading of a record, sent to the side channel of the loader.
+    */
+    struct Anomaly
+    {
+        unsigned timestamp;                 ///< Packed timestamp of the record.
+        MeasurementType measurementType;    ///< Measurement flagged.
+        float reading;                      ///< Flagged reading.
+        float median;                       ///< Median of the baseline before the reading.
+        unsigned kinds;                     ///< SPIKE, OUTLIER and STUCK bits of the reading.
+    };
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] threshold The number of deviations a reading may stray before it is flagged.
+    * @param[in] baselineLength The number of readings the baseline mostly remembers.
+    * @param[in] stuckLength The number of repeats of one non zero reading that flag it.
+    * @post Creates an AnomalyDetector with an empty baseline for each measurement.
+    */
+    AnomalyDetector(
+        const float &threshold = DEFAULT_THRESHOLD,
+        const unsigned &baselineLength = DEFAULT_BASELINE_LENGTH,
+        const unsigned &stuckLength = DEFAULT_STUCK_LENGTH );
+
+    /**
+    * @brief Checks every measurement of a record against its baseline, then adds the record to the baselines.
+    *
+    * @param[in] windRecType The wind record, later than the records checked before it.
+    * @param[in] emit Called once for each flagged reading of the record.
+    * @return The number of flagged readings of the record.
+    */
+    unsigned Check( const WindRecType &windRecType, const std::function<void( const Anomaly & )> &emit );
+
+    /**
+    * @brief Forgets every baseline, as before the first record.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of readings flagged since the last Clear().
+    *
+    * @return The number of flagged readings.
+    */
+    unsigned GetFlaggedCount() const;
+
+    /**
+    * @brief Gets the names of the kinds of a flagged reading.
+    *
+    * @param[in] kinds The SPIKE, OUTLIER and STUCK bits.
+    * @return The names of the set bits joined by '|', such as "spike|outlier".
+    */
+    static string GetKindNames( const unsigned &kinds );
+
+private:
+
+    /**
+    * @brief The rolling baseline of one measurement.
+    */
+    struct Baseline
+    {
+        unsigned count;     ///< Readings added, up to the warm up length.
+        float mean;         ///< Exponentially weighted mean.
+        float variance;     ///< Exponentially weighted variance.
+        float median;       ///< Streaming estimate of the median.
+        float deviation;    ///< Streaming estimate of the median absolute deviation.
+        float last;         ///< Last reading.
+        unsigned run;       ///< Times the last reading repeated in a row.
+    };
+
+    float m_threshold;                          ///< Deviations a reading may stray before it is flagged.
+    float m_weight;                             ///< Weight of a new reading in the exponentially weighted mean.
+    unsigned m_stuckLength;                     ///< Repeats of one non zero reading that flag it.
+    unsigned m_flagged;                         ///< Readings flagged since the last Clear().
+    Baseline m_baselines[MEASUREMENT_TYPES];    ///< Baseline of each measurement, indexed by MeasurementType.
+
+    /**
+    * @brief Checks a reading against the baseline of its measurement, then adds it to the baseline.
+    *
+    * @param[in] measurementType Type of measurement.
+    * @param[in] reading The reading.
+    * @param[out] median The median of the baseline before the reading.
+    * @return The SPIKE, OUTLIER and STUCK bits of the reading, 0 when it is not flagged.
+    */
+    unsigned CheckReading( MeasurementType measurementType, const float &reading, float &median );
+
+    /**
+    * @brief Getter for the smallest spread used for a measurement.
+    *
+    * @param[in] measurementType Type of measurement.
+    * @return The floor of the spread, in the unit of the measurement.
+    */
+    static float GetSpreadFloor( MeasurementType measurementType );
+};
+
+#endif // ANOMALYDETECTOR_H_INCLUDED
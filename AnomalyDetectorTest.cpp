@@ -0,0 +1,136 @@
+#include<iostream>
+#include<cmath>
+
+#include "AnomalyDetector.h"
+#include "Timestamp.h"
+#include "Vector.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+WindRecType MakeRecord( const unsigned &reading, const float &windSpeed, const float &solarRadiation, const float &temperature );
+void TestSpike();
+void TestStuck();
+void TestQuietChanges();
+void TestKindNames();
+
+int main()
+{
+    TestSpike();
+    TestStuck();
+    TestQuietChanges();
+    TestKindNames();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+WindRecType MakeRecord( const unsigned &reading, const float &windSpeed, const float &solarRadiation, const float &temperature )
+{
+    // Readings 10 minutes apart from midnight on 1 March 2016
+    unsigned minutes = reading * 10;
+    return WindRecType( Date( 1 + minutes / Timestamp::MINUTES_PER_DAY, 3, 2016 ), Time( minutes / 60 % 24, minutes % 60 ),
+                        WindSpeed( windSpeed ), SolarRadiation( solarRadiation ), Temperature( temperature ) );
+}
+
+void TestSpike()
+{
+    AnomalyDetector anomalyDetector;
+    Vector<AnomalyDetector::Anomaly> anomalies;
+    auto collect = [&anomalies]( const AnomalyDetector::Anomaly &anomaly )
+    {
+        anomalies.InsertLast( anomaly );
+    };
+    unsigned reading = 0;
+
+    cout << "Test on spikes" << endl;
+    anomalyDetector.Check( MakeRecord( reading++, 3, 0, 20 ), collect );
+    anomalyDetector.Check( MakeRecord( reading++, 3, 0, 60 ), collect );
+    Assert( anomalies.IsEmpty(), "readings are not flagged while the baseline warms up" );
+
+    for( ; reading < 200; reading++ )
+    {
+        anomalyDetector.Check( MakeRecord( reading, 2 + reading % 3, 0, reading % 2 == 0 ? 19.5f : 20.5f ), collect );
+    }
+    Assert( anomalies.IsEmpty(), "readings within the usual spread are not flagged" );
+
+    unsigned flagged = anomalyDetector.Check( MakeRecord( reading++, 3, 0, 45 ), collect );
+    Assert( flagged == 1 && anomalies.GetUsed() == 1 && anomalyDetector.GetFlaggedCount() == 1, "a spike of one measurement is flagged once" );
+    Assert( anomalies[0].measurementType == MeasurementType::TEMPERATURE && anomalies[0].reading == 45.0f
+            && anomalies[0].kinds == ( AnomalyDetector::SPIKE | AnomalyDetector::OUTLIER )
+            && anomalies[0].timestamp == Timestamp::Pack( 2, 3, 2016, 9, 20 ), "the flagged reading is sent with its time and kinds" );
+    Assert( fabs( anomalies[0].median - 20.0f ) < 1.0f, "the median of the baseline is sent with it" );
+
+    anomalyDetector.Check( MakeRecord( reading++, 3, 0, 20 ), collect );
+    Assert( anomalies.GetUsed() == 1, "the spike barely moves the baseline" );
+
+    Assert( anomalyDetector.Check( MakeRecord( reading++, 3, 0, NAN ), nullptr ) == 0, "a missing reading is not flagged" );
+    anomalyDetector.Clear();
+    Assert( anomalyDetector.GetFlaggedCount() == 0 && anomalyDetector.Check( MakeRecord( reading++, 3, 0, 90 ), collect ) == 0,
+            "clearing forgets the baselines" );
+    cout << endl;
+}
+
+void TestStuck()
+{
+    AnomalyDetector anomalyDetector;
+    unsigned stuck = 0;
+    auto count = [&stuck]( const AnomalyDetector::Anomaly &anomaly )
+    {
+        stuck += ( anomaly.kinds & AnomalyDetector::STUCK ) ? 1 : 0;
+    };
+
+    cout << "Test on stuck sensors" << endl;
+    for( unsigned reading(0); reading < AnomalyDetector::DEFAULT_STUCK_LENGTH - 1; reading++ )
+    {
+        anomalyDetector.Check( MakeRecord( reading, 3.5f, 0, 20 + reading % 3 ), count );
+    }
+    Assert( stuck == 0, "a repeat shorter than the stuck length is not flagged" );
+
+    anomalyDetector.Check( MakeRecord( AnomalyDetector::DEFAULT_STUCK_LENGTH, 3.5f, 0, 20 ), count );
+    Assert( stuck == 1, "a reading repeated for the stuck length is flagged" );
+
+    for( unsigned reading(0); reading < 100; reading++ )
+    {
+        anomalyDetector.Check( MakeRecord( 100 + reading, 0, 0, 20 + reading % 3 ), count );
+    }
+    Assert( stuck == 1, "a long run of zero wind and zero solar radiation is not stuck" );
+    cout << endl;
+}
+
+void TestQuietChanges()
+{
+    AnomalyDetector anomalyDetector;
+    unsigned flagged = 0;
+
+    cout << "Test on ordinary changes" << endl;
+    for( unsigned reading(0); reading < 150; reading++ )
+    {
+        // A night of dark calm, then sunrise and a breeze picking up
+        float solarRadiation = reading < 100 ? 0.0f : ( reading - 100 ) * 40.0f;
+        float windSpeed = reading < 100 ? 0.0f : ( reading - 100 ) * 0.2f;
+        flagged += anomalyDetector.Check( MakeRecord( reading, windSpeed, solarRadiation, 15 + reading * 0.05f ), nullptr );
+    }
+    Assert( flagged == 0 && anomalyDetector.GetFlaggedCount() == 0, "a sunrise after a constant night is not flagged" );
+    cout << endl;
+}
+
+void TestKindNames()
+{
+    cout << "Test on kind names" << endl;
+    Assert( AnomalyDetector::GetKindNames( AnomalyDetector::SPIKE | AnomalyDetector::OUTLIER ) == "spike|outlier"
+            && AnomalyDetector::GetKindNames( AnomalyDetector::STUCK ) == "stuck"
+            && AnomalyDetector::GetKindNames( 0 ).empty(), "kinds are named and joined" );
+    cout << endl;
+}
@@ -0,0 +1,64 @@
+
+#include "BulkReportGenerator.h"
+
+BulkReportGenerator::BulkReportGenerator( const unsigned &threadCount )
+    : m_workerPool( threadCount ) {}
+
+unsigned BulkReportGenerator::Generate(
+    const SummaryCube &summaryCube,
+    const unsigned &firstYear,
+    const unsigned &lastYear,
+    const string &filePath,
+    unsigned &failures )
+{
+    Vector<unsigned> years;
+    std::atomic<unsigned> written( 0 );
+    std::atomic<unsigned> failed( 0 );
+
+    for( unsigned index(0); index < summaryCube.GetYearCount(); index++ )
+    {
+        unsigned year = summaryCube.GetYearAt( index );
+        if( year >= firstYear && year <= lastYear )
+        {
+            years.InsertLast( year );
+        }
+    }
+
+    m_workerPool.ParallelFor( 0, years.GetUsed(), 1, [&]( unsigned, unsigned begin, unsigned end )
+    {
+        ReportWriter reportWriter;
+        for( unsigned index( begin ); index < end; index++ )
+        {
+            reportWriter.Clear();
+            reportWriter.AddYear( summaryCube, years[index] );
+            if( reportWriter.Write( GetReportPath( filePath, years[index] ) ) )
+            {
+                written++;
+            }
+            else
+            {
+                failed++;
+            }
+        }
+    } );
+
+    failures = failed;
+    return written;
+}
+
+unsigned BulkReportGenerator::Generate( const SummaryCube &summaryCube, const string &filePath, unsigned &failures )
+{
+    return Generate( summaryCube, 0, ~0u, filePath, failures );
+}
+
+string BulkReportGenerator::GetReportPath( const string &filePath, const unsigned &year )
+{
+    size_t extension = filePath.rfind( '.' );
+    size_t directory = filePath.find_last_of( "/\\" );
+
+    if( extension == string::npos || ( directory != string::npos && extension < directory ) )
+    {
+        return filePath + "_" + to_string( year );
+    }
+    return filePath.substr( 0, extension ) + "_" + to_string( year ) + filePath.substr( extension );
+}
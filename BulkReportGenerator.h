@@ -0,0 +1,79 @@
+/**
+ * @file BulkReportGenerator.h
+ * @brief Defines the BulkReportGenerator class, which writes the yearly reports of many years in parallel.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef BULKREPORTGENERATOR_H_INCLUDED
+#define BULKREPORTGENERATOR_H_INCLUDED
+
+#include<string>
+#include<atomic>
+
+#include "ReportWriter.h"
+#include "SummaryCube.h"
+#include "WorkerPool.h"
+
+/**
+* @brief Writes the option 4 report of every year of a range to its own file, one year per worker.
+*
+* The workers only read the summary cube, which must not change while the reports are generated,
+* and each builds and writes its own ReportWriter, so they share nothing else. The report of a year
+* is written next to the option 4 report with the year added to its name, for example
+* WindTempSolar_2015.csv for WindTempSolar.csv.
+*/
+class BulkReportGenerator
+{
+public:
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] threadCount The number of reports generated at once, or 0 for one per hardware thread.
+    */
+    BulkReportGenerator( const unsigned &threadCount = 0 );
+
+    BulkReportGenerator( const BulkReportGenerator & ) = delete;
+    BulkReportGenerator &operator = ( const BulkReportGenerator & ) = delete;
+
+    /**
+    * @brief Writes the report of every year of a range that has data.
+    *
+    * @param[in] summaryCube The monthly rollup of the dataset.
+    * @param[in] firstYear The first year of the range.
+    * @param[in] lastYear The last year of the range.
+    * @param[in] filePath The path of the option 4 report the yearly paths are made from.
+    * @param[out] failures The number of reports that could not be written.
+    * @return The number of reports written.
+    */
+    unsigned Generate(
+        const SummaryCube &summaryCube,
+        const unsigned &firstYear,
+        const unsigned &lastYear,
+        const string &filePath,
+        unsigned &failures );
+
+    /**
+    * @brief Writes the report of every year that has data.
+    *
+    * @param[in] summaryCube The monthly rollup of the dataset.
+    * @param[in] filePath The path of the option 4 report the yearly paths are made from.
+    * @param[out] failures The number of reports that could not be written.
+    * @return The number of reports written.
+    */
+    unsigned Generate( const SummaryCube &summaryCube, const string &filePath, unsigned &failures );
+
+    /**
+    * @brief Makes the path of the report of a year by adding the year before the extension.
+    *
+    * @param[in] filePath The path of the option 4 report.
+    * @param[in] year The year of the report.
+    * @return The path of the report of the year.
+    */
+    static string GetReportPath( const string &filePath, const unsigned &year );
+
+private:
+    WorkerPool m_workerPool;        ///< Workers generating the reports.
+};
+
+#endif // BULKREPORTGENERATOR_H_INCLUDED
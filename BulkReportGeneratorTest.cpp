@@ -0,0 +1,104 @@
+#include<iostream>
+#include<fstream>
+#include<sstream>
+#include<cstdio>
+
+#include "BulkReportGenerator.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+string ReadFile( const string &filePath );
+void TestReportPath();
+void TestGenerate( const SummaryCube &summaryCube );
+void TestRange( const SummaryCube &summaryCube );
+
+int main()
+{
+    SummaryCube summaryCube;
+
+    for( unsigned year(2010); year <= 2017; year++ )
+    {
+        for( unsigned month(1); month <= 12; month += year % 3 + 1 )
+        {
+            summaryCube.Add( WindRecType( Date( 1, month, year ), Time( 9, 0 ), WindSpeed( float( month ) ), SolarRadiation( 600 ), Temperature( float( year - 2000 ) ) ) );
+            summaryCube.Add( WindRecType( Date( 2, month, year ), Time( 9, 0 ), WindSpeed( float( month + 2 ) ), SolarRadiation( 600 ), Temperature( float( year - 2000 ) ) ) );
+        }
+    }
+
+    TestReportPath();
+    TestGenerate( summaryCube );
+    TestRange( summaryCube );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+string ReadFile( const string &filePath )
+{
+    ifstream inputFile( filePath );
+    ostringstream contents;
+
+    contents << inputFile.rdbuf();
+    return contents.str();
+}
+
+void TestReportPath()
+{
+    cout << "Test on report paths" << endl;
+    Assert( BulkReportGenerator::GetReportPath( "WindTempSolar.csv", 2015 ) == "WindTempSolar_2015.csv", "Year goes before the extension" );
+    Assert( BulkReportGenerator::GetReportPath( "out.d/report", 2015 ) == "out.d/report_2015", "Path without an extension ends with the year" );
+    cout << endl;
+}
+
+void TestGenerate( const SummaryCube &summaryCube )
+{
+    BulkReportGenerator bulkReportGenerator( 3 );
+    unsigned failures = 0;
+    unsigned written = bulkReportGenerator.Generate( summaryCube, "BulkReportGeneratorTest.csv", failures );
+
+    bool reportsMatch = true;
+    for( unsigned year(2010); year <= 2017; year++ )
+    {
+        ReportWriter expected;
+        expected.AddYear( summaryCube, year );
+        string filePath = BulkReportGenerator::GetReportPath( "BulkReportGeneratorTest.csv", year );
+        reportsMatch = reportsMatch && ReadFile( filePath ) == expected.GetContents() && expected.GetRowCount() > 0;
+        remove( filePath.c_str() );
+    }
+
+    cout << "Test on generating every year" << endl;
+    Assert( written == 8 && failures == 0, "A report is written for each of the 8 years" );
+    Assert( reportsMatch, "Each report holds its own year" );
+    cout << endl;
+}
+
+void TestRange( const SummaryCube &summaryCube )
+{
+    BulkReportGenerator bulkReportGenerator;
+    unsigned failures = 0;
+    unsigned written = bulkReportGenerator.Generate( summaryCube, 2015, 2030, "BulkReportGeneratorTest.csv", failures );
+    bool outsideWritten = ifstream( BulkReportGenerator::GetReportPath( "BulkReportGeneratorTest.csv", 2014 ) ).good();
+
+    for( unsigned year(2015); year <= 2017; year++ )
+    {
+        remove( BulkReportGenerator::GetReportPath( "BulkReportGeneratorTest.csv", year ).c_str() );
+    }
+
+    cout << "Test on generating a range of years" << endl;
+    Assert( written == 3 && failures == 0, "Only years of the range with data are written" );
+    Assert( !outsideWritten, "Years before the range are not written" );
+    Assert( bulkReportGenerator.Generate( summaryCube, 2015, 2016, "missing_directory/report.csv", failures ) == 0 && failures == 2, "Unwritable reports are counted as failures" );
+    cout << endl;
+}
@@ -1,8 +1,80 @@
 
 #include "Client.h"
+#include "ColumnKernels.h"
+
+const unsigned Client::MINIMUM_RECORDS_PER_WORKER;
+const unsigned Client::ALL_MONTHS;
 
 // ++++++++++++ PUBLIC ++++++++++++++++++++++++
 // ++++++++++++++++++++++++++++++++++++++++++++
+Client::Client()
+    : m_output( cout )
+{
+    m_convertedInput = 0;
+    m_threadCount = WorkerPool::GetDefaultThreadCount();
+    m_workerPool = nullptr;
+    m_isWorkerPoolOwned = true;
+}
+
+Client::Client( WorkerPool &workerPool )
+    : m_output( cout )
+{
+    m_convertedInput = 0;
+    m_threadCount = workerPool.GetThreadCount();
+    m_workerPool = &workerPool;
+    m_isWorkerPoolOwned = false;
+}
+
+Client::~Client()
+{
+    if( m_isWorkerPoolOwned )
+    {
+        delete m_workerPool;
+    }
+}
+
+void Client::SetThreadCount( const unsigned &threadCount )
+{
+    unsigned requested = ( threadCount == 0 ) ? WorkerPool::GetDefaultThreadCount() : threadCount;
+    if( requested != m_threadCount )
+    {
+        if( m_isWorkerPoolOwned )
+        {
+            delete m_workerPool;
+        }
+        m_workerPool = nullptr;
+        m_isWorkerPoolOwned = true;
+        m_threadCount = requested;
+    }
+}
+
+unsigned Client::GetThreadCount() const
+{
+    return m_threadCount;
+}
+
+const QueryCache &Client::GetQueryCache() const
+{
+    return m_queryCache;
+}
+
+void Client::ClearQueryCache()
+{
+    m_queryCache.Clear();
+}
+
+void Client::FlushOutput()
+{
+    m_output.Flush();
+}
+
+void Client::DisplayQueryCacheStatistics() const
+{
+    std::cout   << Constant::INFO( Constant::QUERY_CACHE_HITS_MSG ) << m_queryCache.GetHitCount() << '\n'
+                << Constant::INFO( Constant::QUERY_CACHE_MISSES_MSG ) << m_queryCache.GetMissCount() << '\n'
+                << Constant::INFO( Constant::QUERY_CACHE_INVALIDATIONS_MSG ) << m_queryCache.GetInvalidationCount() << endl;
+}
+
 void Client::MenuList()
 {
     cout   << Constant::MENU_OPTIONS_MSG
@@ -15,6 +87,7 @@ void Client::MenuList()
 
 void Client::EnterRequired()
 {
+    m_output.Flush();
     cout << Constant::INFO( Constant::PRESS_ENTER_TO_CONTINUE_MSG ) << endl;
     while( getch() != 13 );
 }
@@ -64,266 +137,290 @@ unsigned Client::ClientYearInputValidation()
     return m_convertedInput;
 }
 
-float Client::GetSumFromSelectedInput( Vector<WindRecType> &windRecLog, const unsigned &month, const unsigned &year )
+void Client::GetMonthlySummariesAbove(
+    const SensorRegistry &sensorRegistry,
+    const unsigned &year,
+    MeasurementType measurementType,
+    const float &threshold,
+    MeasurementAccumulator monthlySummary[] )
+{
+    if( !DispatchMeasurement( measurementType, [&]( auto tag )
+    {
+        GetMonthlySummariesAbove<decltype( tag )>( sensorRegistry, year, threshold, monthlySummary );
+    } ) )
+    {
+        cerr << "Invalid measurement type" << endl;
+    }
+}
+
+MeasurementAccumulator Client::GetMonthlySummary(
+    const SummaryCube &summaryCube,
+    const unsigned &month,
+    const unsigned &year,
+    MeasurementType measurementType )
 {
-    unsigned sum = 0.0;
+    unsigned key = Timestamp::MakeYearMonthKey( month, year );
+    MeasurementAccumulator summary;
 
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr ++ )
+    if( !LookupQuery( QueryKind::MONTHLY_SUMMARY, measurementType, key, key + 1, &summaryCube, nullptr, summary ) )
     {
-        if( IsClientMonthFound(windRecLog, month) && IsClientYearFound(windRecLog, year) )
-        {
-            sum += ptr->GetRecordWindSpeed().GetMeasurement();
-        }
+        summary = summaryCube.GetMonthly( month, year, measurementType );
+        StoreQuery( QueryKind::MONTHLY_SUMMARY, measurementType, key, key + 1, &summaryCube, nullptr, summary );
     }
+    return summary;
+}
 
-    /**
-    for( unsigned i(0); i<windRecLog.GetUsed(); i++ )
+void Client::GetYearlySummary(
+    const SummaryCube &summaryCube,
+    const unsigned &year,
+    MeasurementType measurementType,
+    MeasurementAccumulator monthlySummary[] )
+{
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
     {
-        if( IsClientMonthFound( windRecLog, month ) &&
-                IsClientYearFound( windRecLog, year ) )
-        {
-            sum +=  windRecLog[i].GetRecordWindSpeed().GetMeasurement();
-        }
+        monthlySummary[month] = GetMonthlySummary( summaryCube, month + 1, year, measurementType );
     }
-    */
-    return sum;
 }
 
-unsigned Client::GetClientMonthYearInputCount( Vector<WindRecType> &windRecLog, const unsigned &month, const unsigned &year )
+bool Client::GetMonthlyPercentiles(
+    const SummaryCube &summaryCube,
+    const unsigned &month,
+    const unsigned &year,
+    MeasurementType measurementType,
+    float &median,
+    float &p90,
+    float &p95,
+    float &p99 )
 {
-    unsigned count = 0;
+    const QuantileSketch &sketch = summaryCube.GetMonthlySketch( month, year, measurementType );
 
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
+    if( sketch.GetCount() == 0 )
     {
-        if( IsClientMonthFound(windRecLog, month) && IsClientYearFound(windRecLog, year) )
-        {
-            count ++;
-        }
+        return false;
     }
+    median = sketch.GetQuantile( 0.5 );
+    p90 = sketch.GetQuantile( 0.9 );
+    p95 = sketch.GetQuantile( 0.95 );
+    p99 = sketch.GetQuantile( 0.99 );
+    return true;
+}
 
-    /**
-    for( unsigned i(0); i<windRecLog.GetUsed(); i++ )
+void Client::GetWindRose(
+    const SensorRegistry &sensorRegistry,
+    const unsigned &month,
+    const unsigned &year,
+    WindRose &windRose )
+{
+    const float *directions = sensorRegistry.GetColumn( sensorRegistry.Find( SensorRegistry::WINDDIRECTION_CODE ) );
+    const float *speeds = sensorRegistry.GetColumn( sensorRegistry.Find( SensorRegistry::WINDSPEED_CODE ) );
+    const unsigned *keys = sensorRegistry.GetYearMonthKeys();
+    unsigned firstKey = Timestamp::MakeYearMonthKey( month == ALL_MONTHS ? 1 : month, year );
+    unsigned lastKey = Timestamp::MakeYearMonthKey( month == ALL_MONTHS ? SummaryCube::MONTHS_IN_YEAR : month, year );
+    Vector<WindRose> partials;
+    partials.SetSize( m_threadCount );
+
+    windRose.Clear();
+    unsigned chunks = GetWorkerPool().ParallelFor( 0, sensorRegistry.GetRowCount(), MINIMUM_RECORDS_PER_WORKER,
+                      [&]( unsigned chunk, unsigned begin, unsigned end )
     {
-        if( IsClientMonthFound( windRecLog, month ) &&
-                IsClientYearFound( windRecLog, year ) )
+        WindRose local( windRose );
+        for( unsigned row(begin); row < end; row++ )
         {
-            count ++;
+            if( keys[row] >= firstKey && keys[row] <= lastKey )
+            {
+                local.Add( directions[row], speeds[row] );
+            }
         }
+        partials[chunk] = local;
+    } );
+
+    for( unsigned chunk(0); chunk < chunks; chunk++ )
+    {
+        windRose.Merge( partials[chunk] );
     }
-    */
-    return count;
 }
 
-float Client::GetMeanFromSelectedInput(
-    WindRecType &windRecType,
-    float &sum,
-    unsigned &count,
-    MeanFunctionPtr meanFunc,
+MeasurementAccumulator Client::GetRangeSummary(
+    const PrefixSumIndex &prefixSumIndex,
+    const Date &startDate,
+    const Date &endDate,
     MeasurementType measurementType )
 {
-    switch (measurementType)
+    unsigned start = Timestamp::Pack( startDate, Time( 0, 0 ) );
+    unsigned end = Timestamp::Pack( endDate, Time( 0, 0 ) );
+    MeasurementAccumulator summary;
+
+    if( !LookupQuery( QueryKind::RANGE_SUMMARY, measurementType, start, end, &prefixSumIndex, nullptr, summary ) )
     {
-    case MeasurementType::WINDSPEED:
-        return (windRecType.GetRecordWindSpeed().*meanFunc)(sum, count);
-    case MeasurementType::TEMPERATURE:
-        return (windRecType.GetRecordTemperature().*meanFunc)(sum, count);
-    case MeasurementType::SOLARRADIATION:
-        return (windRecType.GetRecordSolarRadiation().*meanFunc)(sum, count);
-    default:
-        cerr << "Invalid measurement type" << endl;
-        return 0.0;
+        summary = prefixSumIndex.GetRangeSummary( start, end, measurementType );
+        StoreQuery( QueryKind::RANGE_SUMMARY, measurementType, start, end, &prefixSumIndex, nullptr, summary );
     }
+    return summary;
 }
 
-float Client::GetSampleStandardDeviation(Vector<WindRecType> &windRecLog, WindRecType &windRecType, float &mean, unsigned &count, MeasurementType measurementType)
+MeasurementAccumulator Client::GetRangeSummary(
+    const PrefixSumIndex &prefixSumIndex,
+    const RangeExtremumIndex &rangeExtremumIndex,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType )
 {
-    float squareDiffForEachElement = 0.0;
-    float sumSquareDiff = 0.0;
-    float variance = 0.0;
-
-    /**
-    for (unsigned i = 0; i < windRecLog.GetUsed(); i++)
+    unsigned start = Timestamp::Pack( startDate, Time( 0, 0 ) );
+    unsigned end = Timestamp::Pack( endDate, Time( 0, 0 ) );
+    MeasurementAccumulator summary;
+    if( LookupQuery( QueryKind::RANGE_SUMMARY_WITH_EXTREMES, measurementType, start, end, &prefixSumIndex, &rangeExtremumIndex, summary ) )
     {
-        switch (measurementType)
-        {
-        case MeasurementType::WINDSPEED:
-            squareDiffForEachElement = windRecLog[i].GetRecordWindSpeed().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordWindSpeed().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        case MeasurementType::TEMPERATURE:
-            squareDiffForEachElement = windRecLog[i].GetRecordTemperature().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordTemperature().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        case MeasurementType::SOLARRADIATION:
-            squareDiffForEachElement = windRecLog[i].GetRecordSolarRadiation().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordSolarRadiation().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        default:
-            cerr << "Invalid measurement type" << endl;
-            return 0.0;
-        }
+        return summary;
     }
-    */
 
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
-    {
-        switch (measurementType)
-        {
-        case MeasurementType::WINDSPEED:
-            squareDiffForEachElement = ptr->GetRecordWindSpeed().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordWindSpeed().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        case MeasurementType::TEMPERATURE:
-            squareDiffForEachElement = ptr->GetRecordTemperature().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordTemperature().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        case MeasurementType::SOLARRADIATION:
-            squareDiffForEachElement = ptr->GetRecordSolarRadiation().GetMeasurement();
-            sumSquareDiff = windRecType.GetRecordSolarRadiation().GetSumSquareDifferences(variance, squareDiffForEachElement, mean);
-            break;
-        default:
-            cerr << "Invalid measurement type" << endl;
-            return 0.0;
-        }
-    }
+    float minimum = 0.0;
+    float maximum = 0.0;
+    unsigned timestamp = 0;
 
-    switch (measurementType)
+    summary = prefixSumIndex.GetRangeSummary( start, end, measurementType );
+    if( summary.GetCount() > 0
+            && rangeExtremumIndex.GetMinimum( start, end, measurementType, minimum, timestamp )
+            && rangeExtremumIndex.GetMaximum( start, end, measurementType, maximum, timestamp ) )
     {
-    case MeasurementType::WINDSPEED:
-        return windRecType.GetRecordWindSpeed().GetStandardDeviation(sumSquareDiff, count);
-    case MeasurementType::TEMPERATURE:
-        return windRecType.GetRecordTemperature().GetStandardDeviation(sumSquareDiff, count);
-    case MeasurementType::SOLARRADIATION:
-        return windRecType.GetRecordSolarRadiation().GetStandardDeviation(sumSquareDiff, count);
-    default:
-        cerr << "Invalid measurement type" << endl;
-        return 0.0;
+        summary.SetExtremes( minimum, maximum );
     }
+    StoreQuery( QueryKind::RANGE_SUMMARY_WITH_EXTREMES, measurementType, start, end, &prefixSumIndex, &rangeExtremumIndex, summary );
+    return summary;
 }
 
-void Client::DisplayOptionOneWithData( WindRecType &windRecType, const float &mean, const float &ssD, const unsigned &month, const unsigned &year )
+MeasurementAccumulator Client::GetRangeSummary(
+    const AggregatePyramid &aggregatePyramid,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType )
 {
-    cout    << Constant::OUTPUT << endl;
-    cout    << setw(5) << " " << windRecType.GetRecordDate().GetMonthInStr(month) << " " << year << ":" << endl;
-    cout    << setw(8) << " " << Constant::AVERAGE_WINDSPEED << setprecision(3) << mean << endl;
-    cout    << setw(8) << " " << Constant::WINDSPEED_STANDARD_DEVIATION << setprecision(3) << ssD << '\n' << endl;
-}
+    unsigned start = Timestamp::Pack( startDate, Time( 0, 0 ) );
+    unsigned end = Timestamp::Pack( endDate, Time( 0, 0 ) );
+    MeasurementAccumulator summary;
 
-void Client::DisplayOptionOneWithOutData( WindRecType &windRecType, const unsigned &month, const unsigned &year )
-{
-    cout    << Constant::OUTPUT << endl;
-    cout    << setw(5) << " " << windRecType.GetRecordDate().GetMonthInStr(month) << " " << year << ": NO DATA" << '\n' << endl;
+    if( !LookupQuery( QueryKind::PYRAMID_RANGE_SUMMARY, measurementType, start, end, &aggregatePyramid, nullptr, summary ) )
+    {
+        summary = aggregatePyramid.GetRangeSummary( start, end, measurementType );
+        StoreQuery( QueryKind::PYRAMID_RANGE_SUMMARY, measurementType, start, end, &aggregatePyramid, nullptr, summary );
+    }
+    return summary;
 }
 
-// ----------------------------------------------------------------------------------------------------------------------------------------------------
-
-float Client::GetMonthlySumOfEachFromInput(Vector<WindRecType> &windRecLog, const unsigned &year, float monthlySum[], unsigned &month, MeasurementType measurementType)
+bool Client::GetRangeMinimum(
+    const RangeExtremumIndex &rangeExtremumIndex,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType,
+    float &minimum,
+    Date &date,
+    Time &time )
 {
-    // Initialize the monthly sum to 0
-    for (int i = 0; i < 12; ++i)
+    unsigned timestamp = 0;
+
+    if( !rangeExtremumIndex.GetMinimum( Timestamp::Pack( startDate, Time( 0, 0 ) ), Timestamp::Pack( endDate, Time( 0, 0 ) ), measurementType, minimum, timestamp ) )
     {
-        monthlySum[i] = 0.0;
+        return false;
     }
+    Timestamp::Unpack( timestamp, date, time );
+    return true;
+}
+
+bool Client::GetRangeMaximum(
+    const RangeExtremumIndex &rangeExtremumIndex,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType,
+    float &maximum,
+    Date &date,
+    Time &time )
+{
+    unsigned timestamp = 0;
 
-    /**
-    for (unsigned i = 0; i < windRecLog.GetUsed(); i++)
+    if( !rangeExtremumIndex.GetMaximum( Timestamp::Pack( startDate, Time( 0, 0 ) ), Timestamp::Pack( endDate, Time( 0, 0 ) ), measurementType, maximum, timestamp ) )
     {
-        if (IsClientYearFound(windRecLog, year))
-        {
-            // Get the month index (0-based)
-            month = windRecLog[i].GetRecordDate().GetMonth() - 1;
-            switch( measurementType )
-            {
-            case MeasurementType::WINDSPEED:
-                monthlySum[month] += windRecLog[i].GetRecordWindSpeed().GetMeasurement();
-                break;
-            case MeasurementType::TEMPERATURE:
-                monthlySum[month] += windRecLog[i].GetRecordTemperature().GetMeasurement();
-                break;
-            case MeasurementType::SOLARRADIATION:
-                monthlySum[month] += windRecLog[i].GetRecordSolarRadiation().GetMeasurement();
-                break;
-            default:
-                cerr << "Invalid measurement type" << endl;
-                break;
-            }
-        }
+        return false;
     }
-    */
+    Timestamp::Unpack( timestamp, date, time );
+    return true;
+}
+
+void Client::GetResampledSeries(
+    const PrefixSumIndex &prefixSumIndex,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType,
+    Resolution resolution,
+    ResampledSeries &series,
+    FillMethod fillMethod )
+{
+    unsigned start = Timestamp::Pack( startDate, Time( 0, 0 ) );
+    unsigned end = Timestamp::Pack( endDate, Time( 0, 0 ) );
 
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
+    if( fillMethod == FillMethod::NONE )
     {
-        if (IsClientYearFound(windRecLog, year))
-        {
-            // Get the month index (0-based)
-            month = ptr->GetRecordDate().GetMonth() - 1;
-            switch( measurementType )
-            {
-            case MeasurementType::WINDSPEED:
-                monthlySum[month] += ptr->GetRecordWindSpeed().GetMeasurement();
-                break;
-            case MeasurementType::TEMPERATURE:
-                monthlySum[month] += ptr->GetRecordTemperature().GetMeasurement();
-                break;
-            case MeasurementType::SOLARRADIATION:
-                monthlySum[month] += ptr->GetRecordSolarRadiation().GetMeasurement();
-                break;
-            default:
-                cerr << "Invalid measurement type" << endl;
-                break;
-            }
-        }
+        Resampler::Resample( prefixSumIndex, start, end, measurementType, resolution, series );
+        return;
     }
 
-    return monthlySum[month];
+    ResampledSeries buckets;
+    Resampler::Resample( prefixSumIndex, start, end, measurementType, resolution, buckets );
+    Resampler::Fill( buckets, resolution, fillMethod, series );
 }
 
+void Client::GetRollingSeries(
+    const PrefixSumIndex &prefixSumIndex,
+    const Date &startDate,
+    const Date &endDate,
+    MeasurementType measurementType,
+    const unsigned &width,
+    RollingSeries &series )
+{
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( startDate, Time( 0, 0 ) ), Timestamp::Pack( endDate, Time( 0, 0 ) ), measurementType, width, series );
+}
 
-float Client::GetMonthlySumCountOfEachFromInput( Vector<WindRecType> &windRecLog, const unsigned &year, unsigned monthlyCount[], unsigned &month )
+void Client::DisplayYearHeader( const unsigned &year )
 {
-    /**
-    for (unsigned i = 0; i < windRecLog.GetUsed(); i++)
-    {
-        if (IsClientYearFound(windRecLog, year))
-        {
-            month = windRecLog[i].GetRecordDate().GetMonth() - 1;
-            monthlyCount[month] ++;
-        }
-    }
-    */
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
-    {
-        if( IsClientYearFound(windRecLog, year ) )
-        {
-            month = ptr->GetRecordDate().GetMonth() -1;
-            monthlyCount[month] ++;
-        }
-    }
-    return monthlyCount[month];
+    m_output.Append( Constant::OUTPUT ).Append( '\n' ).AppendSpaces( 5 ).Append( year ).Append( '\n' );
 }
 
+void Client::DisplayOptionOneWithData( WindRecType &windRecType, const float &mean, const float &ssD, const unsigned &month, const unsigned &year )
+{
+    m_output.Append( Constant::OUTPUT ).Append( '\n' );
+    m_output.AppendSpaces( 5 ).AppendMonth( month ).Append( ' ' ).Append( year ).Append( ":\n" );
+    m_output.AppendSpaces( 8 ).Append( Constant::AVERAGE_WINDSPEED ).Append( mean, 3 ).Append( '\n' );
+    m_output.AppendSpaces( 8 ).Append( Constant::WINDSPEED_STANDARD_DEVIATION ).Append( ssD, 3 ).Append( "\n\n" );
+}
+
+void Client::DisplayOptionOneWithOutData( WindRecType &windRecType, const unsigned &month, const unsigned &year )
+{
+    m_output.Append( Constant::OUTPUT ).Append( '\n' );
+    m_output.AppendSpaces( 5 ).AppendMonth( month ).Append( ' ' ).Append( year ).Append( ": NO DATA\n\n" );
+}
+
+// ----------------------------------------------------------------------------------------------------------------------------------------------------
+
 void Client::DisplayOptionTwoWithData( WindRecType &windRecType, float &mean, float &ssD, const unsigned &month )
 {
-    cout    << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ": "
-            << setprecision(3) << mean << " degrees C, stdev: "
-            << setprecision(3) << ssD << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( month + 1 ).Append( ": " )
+            .Append( mean, 3 ).Append( " degrees C, stdev: " )
+            .Append( ssD, 3 ).Append( '\n' );
 }
 
 void Client::DisplayOptionTwoWithOutData( WindRecType &windRecType, const unsigned &month )
 {
-    cout    << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << " " << ": NO DATA" << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( month + 1 ).Append( " : NO DATA\n" );
 }
 
 // ----------------- OPTION THREE ---------------------------------------------------------------------------------------------
 void Client::DisplayOptionThreeWithData( WindRecType &windRecType, const unsigned &month, const float &sum )
 {
-    cout    << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ": "
-            << setprecision(4) << sum / 60000 << " kWh/m2" << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( month + 1 ).Append( ": " )
+            .Append( sum / 60000, 4 ).Append( " kWh/m2\n" );
 }
 
 void Client::DisplayOptionThreeWithOutData( WindRecType &windRecType, const float &month )
 {
-    cout << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ": No Data" << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( unsigned( month ) + 1 ).Append( ": No Data\n" );
 }
 
 // ---------------- OPTION FOUR ------------------------------------------------------------------------------------------------
@@ -337,15 +434,15 @@ void Client::DisplayOptionFourWithData(
     const float &tempSsd,
     const float &srSum)
 {
-    cout    << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ","
-            << speedMean << "(" << speedSsd << "),"
-            << tempMean << "(" << tempSsd << "),"
-            << srSum / 60000 << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( month + 1 ).Append( ',' )
+            .Append( speedMean ).Append( '(' ).Append( speedSsd ).Append( ")," )
+            .Append( tempMean ).Append( '(' ).Append( tempSsd ).Append( ")," )
+            .Append( srSum / 60000 ).Append( '\n' );
 }
 
 void Client::DisplayOptionFourWithOutData( WindRecType &windRecType, const float &month )
 {
-    cout << setw(7) << " " << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ": No Data" << endl;
+    m_output.AppendSpaces( 7 ).AppendMonth( unsigned( month ) + 1 ).Append( ": No Data\n" );
 }
 
 
@@ -361,76 +458,89 @@ bool Client::IsYearInputValid() const
     return ( m_convertedInput <= 2010 || m_convertedInput > 2030 );
 }
 
-bool Client::IsClientMonthFound( Vector<WindRecType> &windRecLog, const unsigned &month ) const
+bool Client::LookupQuery( QueryKind kind, MeasurementType measurementType, const unsigned &start, const unsigned &end, const void *source, const void *secondarySource, MeasurementAccumulator &summary )
 {
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
+    QueryCache::Key key = { kind, measurementType, start, end, source, secondarySource };
+    return m_queryCache.Lookup( key, Processor::GetInstance().GetDataVersion(), summary );
+}
+
+void Client::StoreQuery( QueryKind kind, MeasurementType measurementType, const unsigned &start, const unsigned &end, const void *source, const void *secondarySource, const MeasurementAccumulator &summary )
+{
+    QueryCache::Key key = { kind, measurementType, start, end, source, secondarySource };
+    m_queryCache.Insert( key, Processor::GetInstance().GetDataVersion(), summary );
+}
+
+void Client::ReduceColumnAbove(
+    const SensorRegistry &sensorRegistry,
+    const unsigned &sensor,
+    const unsigned &year,
+    const float &threshold,
+    MeasurementAccumulator monthly[] )
+{
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
     {
-        if( month == ptr->GetRecordDate().GetMonth() )
-        {
-            return true;
-        }
+        monthly[month].Clear();
     }
-
-    /**
-    for( unsigned i(0); i<windRecLog.GetUsed(); i++ )
+    if( sensor == SensorRegistry::NOT_FOUND )
     {
-        if( month == windRecLog[i].GetRecordDate().GetMonth() )
-        {
-            return true;
-        }
+        return;
     }
-    */
 
-    return false;
-}
+    const float *values = sensorRegistry.GetColumn( sensor );
+    const unsigned *keys = sensorRegistry.GetYearMonthKeys();
+    Vector<MonthlyBuckets> partials;
+    partials.SetSize( m_threadCount );
 
-bool Client::IsClientYearFound( Vector<WindRecType> &windRecLog, const unsigned &year ) const
-{
-    /**
-    for( unsigned i(0); i<windRecLog.GetUsed(); i++ )
+    unsigned chunks = GetWorkerPool().ParallelFor( 0, sensorRegistry.GetRowCount(), MINIMUM_RECORDS_PER_WORKER,
+                      [&]( unsigned chunk, unsigned begin, unsigned end )
     {
-        if( year == windRecLog[i].GetRecordDate().GetYear() )
+        const float *chunkValues = values + begin;
+        unsigned rows = end - begin;
+        Vector<unsigned char> mask;
+        MonthlyBuckets local;
+
+        mask.SetSize( rows );
+        for( unsigned month(1); month <= SummaryCube::MONTHS_IN_YEAR; month++ )
         {
-            return true;
+            ColumnKernels::BuildKeyMask( keys + begin, rows, Timestamp::MakeYearMonthKey( month, year ), mask.Start() );
+            unsigned count = ColumnKernels::MaskedCountAbove( chunkValues, mask.Start(), rows, threshold );
+            if( count == 0 )
+            {
+                continue;
+            }
+
+            // Narrow the month to the readings above the threshold, which a missing NaN reading never is
+            for( unsigned row(0); row < rows; row++ )
+            {
+                mask[row] = mask[row] && chunkValues[row] > threshold;
+            }
+            double sum = ColumnKernels::MaskedSum( chunkValues, mask.Start(), rows );
+            float mean = sum / count;
+            local.months[month - 1] = MeasurementAccumulator(
+                                          count,
+                                          sum,
+                                          ColumnKernels::MaskedSumOfSquares( chunkValues, mask.Start(), rows, mean ),
+                                          ColumnKernels::MaskedMinimum( chunkValues, mask.Start(), rows ),
+                                          ColumnKernels::MaskedMaximum( chunkValues, mask.Start(), rows ) );
         }
-    }
-    */
+        partials[chunk] = local;
+    } );
 
-    for( WindRecType *ptr = windRecLog.Start(); ptr != windRecLog.Finish(); ptr++ )
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
     {
-        if( year == ptr->GetRecordDate().GetYear() )
+        for( unsigned chunk(0); chunk < chunks; chunk++ )
         {
-            return true;
+            monthly[month].Merge( partials[chunk].months[month] );
         }
     }
-    return false;
 }
 
-void Client::OutputStreamMeasurement(
-    WindRecType &windRecType,
-    const string &output_filePath,
-    unsigned &month,
-    float &speedMean,
-    float &speedSsd,
-    float &tempMean,
-    float &tempSsd,
-    float &srSum )
+WorkerPool &Client::GetWorkerPool()
 {
-    ofstream outputFile( output_filePath );
-
-    if( !outputFile )
+    if( m_workerPool == nullptr )
     {
-        cerr << "[ ERROR ] Opening File: " << output_filePath << endl;
+        m_workerPool = new WorkerPool( m_threadCount );
     }
-    outputFile << "Month,Average Wind Speed(stdev),Average Ambient Temperature(stdev),Solar Radiation" << endl;
-
-    outputFile << windRecType.GetRecordDate().GetMonthInStr(month + 1) << ","
-               << speedMean << "(" << speedSsd << "),"
-               << tempMean << "(" << tempSsd << "),"
-               << srSum / 60000 << endl;
-
-    // Close the CSV file
-    outputFile.close();
+    return *m_workerPool;
 }
 
-
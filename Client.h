@@ -10,18 +10,22 @@
 #include "Processor.h"
 #include "Constant.h"
 #include "MeasurementType.h"
+#include "SummaryCube.h"
+#include "Timestamp.h"
+#include "PrefixSumIndex.h"
+#include "RangeExtremumIndex.h"
+#include "Resampler.h"
+#include "RollingWindow.h"
+#include "AggregatePyramid.h"
+#include "QueryCache.h"
+#include "WorkerPool.h"
+#include "MeasurementTag.h"
+#include "OutputBuffer.h"
+#include "SensorRegistry.h"
+#include "WindRose.h"
 
 using namespace std;
 
-/**
- * @brief Type alias for a pointer to member function of the Measurement class.
- *
- * This type alias represents a pointer to a member function of the Measurement class. The member function
- * takes two parameters: a reference to a float and a reference to an unsigned int, and returns a float.
- * It is used to define a pointer to a function that calculates a mean value.
- */
-using MeanFunctionPtr = float (Measurement::*)(float&, unsigned&);
-
 /**
  * @brief The Client class provides functionality for interacting with the user,
  * managing input validation, processing data, and displaying results.
@@ -29,6 +33,84 @@ using MeanFunctionPtr = float (Measurement::*)(float&, unsigned&);
 class Client
 {
 public:
+    static const unsigned ALL_MONTHS = 0;   ///< Month passed to GetWindRose() to bin the whole year.
+
+    /**
+     * @brief Default constructor.
+     *
+     * The record reductions run in parallel on one worker per hardware thread by default.
+     * The worker pool is only started by the first reduction that needs it.
+     */
+    Client();
+
+    /**
+     * @brief Parameterized constructor.
+     *
+     * The record reductions run on a worker pool shared with other clients, one per worker
+     * thread of the pool, so several clients running at once do not each start their own.
+     *
+     * @param[in] workerPool The shared worker pool, which must outlive the client.
+     */
+    explicit Client( WorkerPool &workerPool );
+
+    /**
+     * @brief Destructor.
+     *
+     * Stops the worker pool if it was started by this client.
+     */
+    ~Client();
+
+    Client( const Client & ) = delete;
+    Client &operator = ( const Client & ) = delete;
+
+    /**
+     * @brief Sets the number of worker threads used by the record reductions.
+     *
+     * GetMonthlySummariesAbove() and GetWindRose() partition the sensor rows across this many workers.
+     * A count of 1 runs them sequentially. A client on a shared worker pool starts its own
+     * pool when the count differs from the shared one.
+     *
+     * @param[in] threadCount The number of worker threads, 0 for the hardware concurrency.
+     */
+    void SetThreadCount( const unsigned &threadCount );
+
+    /**
+     * @brief Getter for the number of worker threads used by the record reductions.
+     *
+     * @return The number of worker threads.
+     */
+    unsigned GetThreadCount() const;
+
+    /**
+     * @brief Getter for the cache of summary query results.
+     *
+     * The monthly, yearly and range summaries are cached by query kind, measurement and
+     * time range, and invalidated whenever the Processor data version changes.
+     *
+     * @return The query cache, with its hit and miss counts.
+     */
+    const QueryCache &GetQueryCache() const;
+
+    /**
+     * @brief Removes every cached query result.
+     *
+     * Only needed after changing a structure that is not owned by the Processor, since the
+     * Processor data version already invalidates the cache on every load and append.
+     */
+    void ClearQueryCache();
+
+    /**
+     * @brief Writes the formatted report lines not yet shown to the console.
+     *
+     * The Display functions only format into the output buffer, so the report of an option
+     * reaches the console in one write when this is called after its last line.
+     */
+    void FlushOutput();
+
+    /**
+     * @brief Displays the hit, miss and invalidation counts of the query cache.
+     */
+    void DisplayQueryCacheStatistics() const;
 
     /**
      * @brief Displays the menu options to the user.
@@ -90,113 +172,282 @@ public:
     unsigned ClientYearInputValidation();
 
     /**
-     * @brief Calculates the sum of selected wind speed inputs for a specific month and year.
+     * @brief Summarises the readings of a measurement above a threshold for each month of a year.
+     *
+     * The summary cube holds every reading, so the readings above a threshold, such as the wind above
+     * the cut-out speed of a turbine or the temperature of a heat alarm, are reduced from the sensor
+     * column of the measurement with the ColumnKernels. The rows are split across the worker pool,
+     * see SetThreadCount(). The measurement type is switched on once to the column of its tag.
+     *
+     * @param[in] sensorRegistry The sensor columns read by the Processor during loading.
+     * @param[in] year The year of the summaries.
+     * @param[in] measurementType Type of measurement.
+     * @param[in] threshold Only readings greater than the threshold are summarised.
+     * @param[out] monthlySummary An array of twelve summaries, indexed by month - 1.
+     */
+    void GetMonthlySummariesAbove(
+        const SensorRegistry &sensorRegistry,
+        const unsigned &year,
+        MeasurementType measurementType,
+        const float &threshold,
+        MeasurementAccumulator monthlySummary[] );
+
+    /**
+     * @brief Summarises the readings above a threshold of the measurement selected by a tag for each month of a year.
      *
-     * This function iterates through the wind record log and calculates the sum of wind speed
-     * inputs for entries matching the specified month and year.
+     * The tag is resolved at compile time to the column of its sensor.
      *
-     * @param[in] windRecLog Vector of wind records.
-     * @param[in] month The month for which to calculate the sum.
-     * @param[in] year The year for which to calculate the sum.
-     * @return Sum of wind speed inputs for the specified month and year.
+     * @tparam Tag WindSpeedTag, TemperatureTag or SolarRadiationTag.
+     * @param[in] sensorRegistry The sensor columns read by the Processor during loading.
+     * @param[in] year The year of the summaries.
+     * @param[in] threshold Only readings greater than the threshold are summarised.
+     * @param[out] monthlySummary An array of twelve summaries, indexed by month - 1.
      */
-    float GetSumFromSelectedInput(
-        Vector<WindRecType> &windRecLog,
+    template<class Tag>
+    void GetMonthlySummariesAbove( const SensorRegistry &sensorRegistry, const unsigned &year, const float &threshold, MeasurementAccumulator monthlySummary[] );
+
+    /**
+     * @brief Gets the summary of a measurement for a specific month and year from the summary cube.
+     *
+     * This function reads the precomputed cell of the summary cube instead of scanning the wind
+     * record log, so the count, mean and sample standard deviation are returned in constant time.
+     *
+     * @param[in] summaryCube The monthly rollup built by the Processor during loading.
+     * @param[in] month The month of the summary.
+     * @param[in] year The year of the summary.
+     * @param[in] measurementType Type of measurement.
+     * @return The summary of the measurement, with a count of 0 when there is no data.
+     */
+    MeasurementAccumulator GetMonthlySummary(
+        const SummaryCube &summaryCube,
         const unsigned &month,
-        const unsigned &year );
+        const unsigned &year,
+        MeasurementType measurementType );
 
     /**
-     * @brief Counts the number of entries matching the specified month and year in the wind record log.
+     * @brief Gets the summary of a measurement for each month of a specific year from the summary cube.
      *
-     * This function iterates through the wind record log and counts the number of entries that match
-     * the specified month and year.
+     * This function copies the twelve monthly cells of the year from the summary cube,
+     * so a whole year is served in O(12) work regardless of the number of records.
      *
-     * @param[in] windRecLog Vector of wind records.
-     * @param[in] month The month to match.
-     * @param[in] year The year to match.
-     * @return The number of entries matching the specified month and year.
+     * @param[in] summaryCube The monthly rollup built by the Processor during loading.
+     * @param[in] year The year of the summaries.
+     * @param[in] measurementType Type of measurement.
+     * @param[out] monthlySummary An array of twelve summaries, indexed by month - 1.
      */
-    unsigned GetClientMonthYearInputCount(
-        Vector<WindRecType> &windRecLog,
+    void GetYearlySummary(
+        const SummaryCube &summaryCube,
+        const unsigned &year,
+        MeasurementType measurementType,
+        MeasurementAccumulator monthlySummary[] );
+
+    /**
+     * @brief Gets the median and tail percentiles of a measurement for a specific month and year.
+     *
+     * The percentiles are estimated from the quantile sketch maintained by the summary cube during
+     * loading, so no readings are copied or sorted. Their rank error is about 1% of the month's readings.
+     *
+     * @param[in] summaryCube The monthly rollup built by the Processor during loading.
+     * @param[in] month The month of the percentiles.
+     * @param[in] year The year of the percentiles.
+     * @param[in] measurementType Type of measurement.
+     * @param[out] median The 50th percentile.
+     * @param[out] p90 The 90th percentile.
+     * @param[out] p95 The 95th percentile.
+     * @param[out] p99 The 99th percentile.
+     * @return false if there is no data for the month, true otherwise.
+     */
+    bool GetMonthlyPercentiles(
+        const SummaryCube &summaryCube,
         const unsigned &month,
-        const unsigned &year );
+        const unsigned &year,
+        MeasurementType measurementType,
+        float &median,
+        float &p90,
+        float &p95,
+        float &p99 );
 
     /**
-     * @brief Calculates the mean of selected inputs based on the specified measurement type.
+     * @brief Bins the wind direction and wind speed of a month, or of a whole year, into a wind rose.
      *
-     * This function calculates the mean of selected inputs for the given wind record type and
-     * measurement type using the provided mean function pointer.
+     * The rows of the sensor columns are split across the worker pool. Each worker fills its own
+     * wind rose with the speed classes of the one passed in, and the partial wind roses are merged
+     * in chunk order. Rows missing either reading are not counted.
      *
-     * @param[in] windRecType Wind record type.
-     * @param[in] sum The sum of selected inputs.
-     * @param[in] count The count of selected inputs.
-     * @param[in] meanFunc Pointer to the mean calculation function.
+     * @param[in] sensorRegistry The sensor columns read by the Processor during loading.
+     * @param[in] month The month of the wind rose, ALL_MONTHS for the whole year.
+     * @param[in] year The year of the wind rose.
+     * @param[in,out] windRose The wind rose whose speed classes are used, replaced by the counts.
+     */
+    void GetWindRose(
+        const SensorRegistry &sensorRegistry,
+        const unsigned &month,
+        const unsigned &year,
+        WindRose &windRose );
+
+    /**
+     * @brief Summarises a measurement over any date range from the prefix sum index.
+     *
+     * The range runs from midnight of startDate up to, but not including, midnight of endDate,
+     * so a week is [ Monday, next Monday ) and a season is [ 1 March, 1 June ). The mean and the
+     * standard deviations come from two binary searches and a difference of prefix sums, without
+     * rescanning the records. The prefix sums carry no extremes, so the minimum and maximum are 0;
+     * pass a RangeExtremumIndex as well to fill them in.
+     *
+     * @param[in] prefixSumIndex The time ordered prefix sums built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
      * @param[in] measurementType Type of measurement.
-     * @return The mean of selected inputs.
+     * @return The summary of the measurement, with a count of 0 when there is no data.
      */
-    float GetMeanFromSelectedInput(
-        WindRecType &windRecType,
-        float &sum,
-        unsigned &count,
-        MeanFunctionPtr meanFunc,
-        MeasurementType measurementType);
+    MeasurementAccumulator GetRangeSummary(
+        const PrefixSumIndex &prefixSumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType );
 
     /**
-    * @brief Calculates the sample standard deviation for selected inputs based on the specified measurement type.
-    *
-    * This function calculates the sample standard deviation of selected inputs for the given wind record type and
-    * measurement type. It iterates through the wind record log, calculates the sum of squared differences from the mean,
-    * and then calculates the sample standard deviation using the sum of squared differences and the count of inputs.
-    *
-    * @param[in] windRecLog Vector of wind records.
-    * @param[in] windRecType Wind record type.
-    * @param[in] mean The mean of selected inputs.
-    * @param[in] count The count of selected inputs.
-    * @param[in] measurementType Type of measurement.
-    * @return The sample standard deviation of selected inputs.
-    */
-    float GetSampleStandardDeviation(
-        Vector<WindRecType> &windRecLog,
-        WindRecType &windRecType,
-        float &mean,
-        unsigned &count,
-        MeasurementType measurementType);
+     * @brief Summarises a measurement over any date range, including its minimum and maximum.
+     *
+     * @param[in] prefixSumIndex The time ordered prefix sums built by the Processor during loading.
+     * @param[in] rangeExtremumIndex The range minimum and maximum index built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
+     * @param[in] measurementType Type of measurement.
+     * @return The summary of the measurement, with a count of 0 when there is no data.
+     */
+    MeasurementAccumulator GetRangeSummary(
+        const PrefixSumIndex &prefixSumIndex,
+        const RangeExtremumIndex &rangeExtremumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType );
 
-    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    /**
+     * @brief Summarises a measurement over any date range from the aggregate pyramid.
+     *
+     * The range is covered by whole years, months, days, hours and 10 minute periods from the
+     * coarsest level that fits, so the number of merged summaries stays flat as the archive grows.
+     *
+     * @param[in] aggregatePyramid The pyramid of summaries maintained by the Processor on every append.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
+     * @param[in] measurementType Type of measurement.
+     * @return The summary of the measurement, with a count of 0 when there is no data.
+     */
+    MeasurementAccumulator GetRangeSummary(
+        const AggregatePyramid &aggregatePyramid,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType );
 
     /**
-     * @brief Calculates the monthly sum of each measurement type for a specific year.
+     * @brief Finds the smallest reading of a measurement over any date range, and when it was recorded.
      *
-     * This function calculates the sum of each measurement type (e.g., wind speed, temperature, solar radiation)
-     * for each month of the specified year from the wind record log.
+     * Answers questions such as the minimum temperature of a week with a lookup in the range
+     * extremum index, without scanning the records.
      *
-     * @param[in] windRecLog Vector of wind records.
-     * @param[in] year The year for which to calculate the monthly sums.
-     * @param[in] monthlySum An array to store the monthly sums for each measurement type.
-     * @param[in] month The month index.
+     * @param[in] rangeExtremumIndex The range minimum and maximum index built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
+     * @param[in] measurementType Type of measurement.
+     * @param[out] minimum The smallest reading in the range.
+     * @param[out] date The date of the first record holding the smallest reading.
+     * @param[out] time The time of the first record holding the smallest reading.
+     * @return false if there is no data in the range, true otherwise.
+     */
+    bool GetRangeMinimum(
+        const RangeExtremumIndex &rangeExtremumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType,
+        float &minimum,
+        Date &date,
+        Time &time );
+
+    /**
+     * @brief Finds the largest reading of a measurement over any date range, and when it was recorded.
+     *
+     * Answers questions such as the peak wind speed of a season with a lookup in the range
+     * extremum index, without scanning the records.
+     *
+     * @param[in] rangeExtremumIndex The range minimum and maximum index built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
      * @param[in] measurementType Type of measurement.
+     * @param[out] maximum The largest reading in the range.
+     * @param[out] date The date of the first record holding the largest reading.
+     * @param[out] time The time of the first record holding the largest reading.
+     * @return false if there is no data in the range, true otherwise.
+     */
+    bool GetRangeMaximum(
+        const RangeExtremumIndex &rangeExtremumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType,
+        float &maximum,
+        Date &date,
+        Time &time );
+
+    /**
+     * @brief Resamples a measurement over any date range into hourly, daily or weekly buckets.
+     *
+     * The buckets are built in one pass over the time ordered rows of the prefix sum index and
+     * written to the columns of the series, ready for charts and reports.
+     *
+     * @param[in] prefixSumIndex The time ordered prefix sums built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
+     * @param[in] measurementType Type of measurement.
+     * @param[in] resolution Width of the buckets.
+     * @param[out] series The count, sum, mean, minimum and maximum of each bucket holding data, and of the filled buckets.
+     * @param[in] fillMethod How the empty buckets between buckets holding data are filled, see Resampler::Fill().
+     */
+    void GetResampledSeries(
+        const PrefixSumIndex &prefixSumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType,
+        Resolution resolution,
+        ResampledSeries &series,
+        FillMethod fillMethod = FillMethod::NONE );
+
+    /**
+     * @brief Rolls a moving window over a measurement, giving its statistics at each reading of a date range.
+     *
+     * Each reading enters and leaves the window once, so the whole range is one linear pass over the
+     * time ordered rows of the prefix sum index whatever the width of the window.
      *
-     * @return The monthly sum of the specified measurement type for the specified month and year.
+     * @param[in] prefixSumIndex The time ordered prefix sums built by the Processor during loading.
+     * @param[in] startDate The first date of the range.
+     * @param[in] endDate The date after the last date of the range.
+     * @param[in] measurementType Type of measurement.
+     * @param[in] width The width of the window in minutes.
+     * @param[out] series The count, mean, standard deviation, minimum and maximum of the window ending at each reading.
      */
-    float GetMonthlySumOfEachFromInput(Vector<WindRecType> &windRecLog, const unsigned &year, float monthlySum[], unsigned &month, MeasurementType measurementType);
+    void GetRollingSeries(
+        const PrefixSumIndex &prefixSumIndex,
+        const Date &startDate,
+        const Date &endDate,
+        MeasurementType measurementType,
+        const unsigned &width,
+        RollingSeries &series );
+
+    // ++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+
+    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
 
     /**
-    * @brief Calculates the monthly count of each measurement type for a specific year.
+    * @brief Displays the output header of a yearly report.
     *
-    * This function calculates the count of each measurement type (e.g., number of wind speed measurements,
-    * number of temperature measurements, number of solar radiation measurements) for each month of the
-    * specified year from the wind record log.
+    * This function formats the header into the output buffer, so it reaches the console
+    * with the monthly lines of options two, three and four when the output is flushed.
     *
-    * @param[in] windRecLog Vector of wind records.
-    * @param[in] year The year for which to calculate the monthly counts.
-    * @param[in] monthlyCount An array to store the monthly counts for each measurement type.
-    * @param[in] month The month index.
+    * @param[in] year The year of the report.
     *
-    * @return The monthly count of the specified measurement type for the specified month and year.
+    * @return void
     */
-    float GetMonthlySumCountOfEachFromInput( Vector<WindRecType> &windRecLog, const unsigned &year, unsigned monthlyCount[], unsigned &month );
-
-    // +++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++
+    void DisplayYearHeader( const unsigned &year );
 
     /**
     * @brief Displays option one with data.
@@ -328,37 +579,78 @@ public:
      */
     void DisplayOptionFourWithOutData( WindRecType &windRecType, const float &month );
 
+private:
+    static const unsigned MINIMUM_RECORDS_PER_WORKER = 4096;    ///< Smallest share of the rows worth a worker.
+
     /**
-     * @brief Outputs measurement data to a CSV file.
+     * @brief Represents the twelve monthly buckets filled by one worker.
+     */
+    struct MonthlyBuckets
+    {
+        MeasurementAccumulator months[SummaryCube::MONTHS_IN_YEAR];   ///< Buckets indexed by month - 1.
+    };
+
+    string m_clientInput;               ///< User input.
+    unsigned m_convertedInput;          ///< Converted user input.
+    unsigned m_threadCount;             ///< Number of workers of the record reductions.
+    WorkerPool *m_workerPool;           ///< Worker pool of the record reductions, started on first use.
+    bool m_isWorkerPoolOwned;           ///< Whether the worker pool was started by this client.
+    QueryCache m_queryCache;            ///< Cached summary query results.
+    OutputBuffer m_output;              ///< Formatted console output of the Display functions.
+
+    /**
+     * @brief Partitions the rows of a sensor column across the worker pool and merges the monthly summaries of the readings above a threshold.
      *
-     * This function writes measurement data including average wind speed, average ambient temperature,
-     * and solar radiation to a CSV file specified by the output file path.
+     * Each worker masks the rows of each month of its share with the month and year keys, counts the
+     * readings above the threshold, then narrows the mask to them and reduces their sum, deviation,
+     * minimum and maximum with the ColumnKernels. The partial summaries are merged in chunk order.
      *
-     * @param[in] windRecType The wind record type.
-     * @param[in] output_filePath The path to the output CSV file.
-     * @param[in] month The month index.
-     * @param[in] speedMean The average wind speed.
-     * @param[in] speedSsd The standard deviation of wind speed.
-     * @param[in] tempMean The average ambient temperature.
-     * @param[in] tempSsd The standard deviation of ambient temperature.
-     * @param[in] srSum The total solar radiation.
+     * @param[in] sensorRegistry The sensor columns.
+     * @param[in] sensor The index of the sensor, NOT_FOUND giving empty summaries.
+     * @param[in] year The year of the summaries.
+     * @param[in] threshold Only readings greater than the threshold are summarised.
+     * @param[out] monthly An array of twelve summaries, indexed by month - 1.
+     */
+    void ReduceColumnAbove(
+        const SensorRegistry &sensorRegistry,
+        const unsigned &sensor,
+        const unsigned &year,
+        const float &threshold,
+        MeasurementAccumulator monthly[] );
+
+    /**
+     * @brief Getter for the worker pool, starting it on first use.
      *
-     * @return void
+     * @return The worker pool of the record reductions.
      */
-    void OutputStreamMeasurement(
-        WindRecType &windRecType,
-        const string &output_filePath,
-        unsigned &month,
-        float &speedMean,
-        float &speedSsd,
-        float &tempMean,
-        float &tempSsd,
-        float &srSum );
+    WorkerPool &GetWorkerPool();
 
+    /**
+     * @brief Looks up a cached summary at the current Processor data version.
+     *
+     * @param[in] kind Kind of query.
+     * @param[in] measurementType Measurement queried.
+     * @param[in] start The start of the queried range.
+     * @param[in] end The end of the queried range.
+     * @param[in] source Structure the query runs against.
+     * @param[in] secondarySource Second structure the query runs against, nullptr for a query on one structure.
+     * @param[out] summary The cached summary, when found.
+     * @return true on a hit, false on a miss.
+     */
+    bool LookupQuery( QueryKind kind, MeasurementType measurementType, const unsigned &start, const unsigned &end, const void *source, const void *secondarySource, MeasurementAccumulator &summary );
 
-private:
-    string m_clientInput;       ///< User input.
-    unsigned m_convertedInput;  ///< Converted user input.
+    /**
+     * @brief Caches a summary at the current Processor data version.
+     *
+     * @param[in] kind Kind of query.
+     * @param[in] measurementType Measurement queried.
+     * @param[in] start The start of the queried range.
+     * @param[in] end The end of the queried range.
+     * @param[in] source Structure the query ran against.
+     * @param[in] secondarySource Second structure the query ran against, nullptr for a query on one structure.
+     * @param[in] summary The summary to cache.
+     */
+    void StoreQuery( QueryKind kind, MeasurementType measurementType, const unsigned &start, const unsigned &end, const void *source, const void *secondarySource, const MeasurementAccumulator &summary );
 
     /**
      * @brief Checks if the converted month input is valid.
@@ -374,26 +666,12 @@ private:
      */
     bool IsYearInputValid() const;
 
-    /**
-     * @brief Checks if the given month exists in the wind record log.
-     *
-     * @param[in] windRecLog The vector of wind record types.
-     * @param[in] month The month to check.
-     *
-     * @return true if the month is found, false otherwise.
-     */
-    bool IsClientMonthFound( Vector<WindRecType> &windRecLog, const unsigned &month ) const;
-
-    /**
-     * @brief Checks if the given year exists in the wind record log.
-     *
-     * @param[in] windRecLog The vector of wind record types.
-     * @param[in] year The year to check.
-     *
-     * @return true if the year is found, false otherwise.
-     */
-    bool IsClientYearFound( Vector<WindRecType> &windRecLog, const unsigned &year ) const;
-
 };
 
+template<class Tag>
+void Client::GetMonthlySummariesAbove( const SensorRegistry &sensorRegistry, const unsigned &year, const float &threshold, MeasurementAccumulator monthlySummary[] )
+{
+    ReduceColumnAbove( sensorRegistry, sensorRegistry.Find( Tag::GetCode() ), year, threshold, monthlySummary );
+}
+
 #endif // CLIENT_H_INCLUDED
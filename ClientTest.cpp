@@ -1,7 +1,10 @@
 
 #include<iostream>
+#include<cmath>
+#include<thread>
 
 #include "Client.h"
+#include "Processor.h"
 
 using namespace std;
 
@@ -9,6 +12,40 @@ void Assert( bool condition, const string &message );
 void TestMenuListDisplay( Client &client);
 void TestClientMonthInputValidation( Client &client );
 void TestClientYearInputValidation( Client &client );
+void TestCachedSummaryAfterAppend();
+void TestRangeSummaryWithExtremes();
+void TestMonthlySummariesAboveThreads();
+void TestMonthlySummariesAboveTags();
+void TestSharedWorkerPool();
+template<class Tag>
+void TestMonthlySummariesAboveTag( const SensorRegistry &sensorRegistry, const float &threshold, const float &mean, const string &name );
+void AppendReading( SensorRegistry &sensorRegistry, const Date &date, const Time &time, const float readings[] );
+void TestRangeSummaryWithExtremes()
+{
+    Client client;
+    PrefixSumIndex prefixSumIndex;
+    PrefixSumIndex otherPrefixSumIndex;
+    RangeExtremumIndex rangeExtremumIndex;
+    RangeExtremumIndex otherRangeExtremumIndex;
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 100 ), Temperature( 20 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 9 ), SolarRadiation( 200 ), Temperature( 12 ) ) );
+    otherPrefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 1 ), SolarRadiation( 100 ), Temperature( 20 ) ) );
+    otherPrefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 20 ), SolarRadiation( 200 ), Temperature( 12 ) ) );
+    rangeExtremumIndex.Build( prefixSumIndex );
+    otherRangeExtremumIndex.Build( otherPrefixSumIndex );
+
+    cout << "Test Range Summary with extremes" << endl;
+    MeasurementAccumulator summary = client.GetRangeSummary( prefixSumIndex, rangeExtremumIndex, Date( 1, 3, 2016 ), Date( 2, 3, 2016 ), MeasurementType::WINDSPEED );
+    Assert( summary.GetCount() == 2 && summary.GetSum() == 11 && summary.GetMinimum() == 2 && summary.GetMaximum() == 9,
+            "Extremes are read from the extremum index, keeping the sum" );
+    summary = client.GetRangeSummary( prefixSumIndex, otherRangeExtremumIndex, Date( 1, 3, 2016 ), Date( 2, 3, 2016 ), MeasurementType::WINDSPEED );
+    Assert( summary.GetSum() == 11 && summary.GetMinimum() == 1 && summary.GetMaximum() == 20,
+            "Another extremum index is not answered from the cache of the first" );
+    cout << endl;
+}
+
+bool IsSameSummary( const MeasurementAccumulator &actual, const MeasurementAccumulator &expected );
 
 int main()
 {
@@ -17,6 +54,11 @@ int main()
     TestClientMonthInputValidation( client );
     TestClientYearInputValidation( client );
     TestMenuListDisplay( client );
+    TestCachedSummaryAfterAppend();
+    TestRangeSummaryWithExtremes();
+    TestMonthlySummariesAboveThreads();
+    TestMonthlySummariesAboveTags();
+    TestSharedWorkerPool();
 
     return 0;
 }
@@ -53,3 +95,191 @@ void TestClientYearInputValidation( Client &client )
     Assert( yearInput >= 2011 && yearInput <= 2029, "Should return a valid year value" );
     cout << endl;
 }
+
+void TestCachedSummaryAfterAppend()
+{
+    Client client;
+    DatasetSnapshot snapshot;
+    const SummaryCube &summaryCube = snapshot.GetSummaryCube();
+
+    cout << "Test cached Monthly Summary after an Append" << endl;
+    Processor::GetInstance().AppendRecord( snapshot, WindRecType( Date( 1, 5, 2014 ), Time( 9, 0 ), WindSpeed( 10 ), SolarRadiation( 500 ), Temperature( 20 ) ) );
+    MeasurementAccumulator summary = client.GetMonthlySummary( summaryCube, 5, 2014, MeasurementType::WINDSPEED );
+    Assert( summary.GetCount() == 1 && summary.GetMean() == 10, "First query reads one record" );
+
+    Processor::GetInstance().AppendRecord( snapshot, WindRecType( Date( 2, 5, 2014 ), Time( 9, 0 ), WindSpeed( 20 ), SolarRadiation( 500 ), Temperature( 20 ) ) );
+    summary = client.GetMonthlySummary( summaryCube, 5, 2014, MeasurementType::WINDSPEED );
+    Assert( summary.GetCount() == 2 && summary.GetMean() == 15, "Query after an Append reads the appended record" );
+    cout << endl;
+}
+
+bool IsSameSummary( const MeasurementAccumulator &actual, const MeasurementAccumulator &expected )
+{
+    // The chunks are merged in a different order than a single scan adds, so sums may differ in the last bits
+    auto isClose = []( double left, double right )
+    {
+        return fabs( left - right ) <= 1e-4 * fmax( 1.0, fabs( right ) );
+    };
+
+    if( actual.GetCount() != expected.GetCount() )
+    {
+        return false;
+    }
+    if( expected.GetCount() == 0 )
+    {
+        return true;
+    }
+    return isClose( actual.GetSum(), expected.GetSum() )
+           && isClose( actual.GetMean(), expected.GetMean() )
+           && isClose( actual.GetSampleStandardDeviation(), expected.GetSampleStandardDeviation() )
+           && actual.GetMinimum() == expected.GetMinimum()
+           && actual.GetMaximum() == expected.GetMaximum();
+}
+
+void AppendReading( SensorRegistry &sensorRegistry, const Date &date, const Time &time, const float readings[] )
+{
+    // The columns of the header are wind speed, temperature and solar radiation, in the order of the readings
+    sensorRegistry.AppendLine( to_string( date.GetDay() ) + '/' + to_string( date.GetMonth() ) + '/' + to_string( date.GetYear() ) + ' '
+                               + to_string( time.GetHour() ) + ':' + to_string( time.GetMinute() ) + ','
+                               + to_string( readings[0] ) + ',' + to_string( readings[1] ) + ',' + to_string( readings[2] ) );
+}
+
+void TestMonthlySummariesAboveThreads()
+{
+    const unsigned YEAR = 2015;
+    const float THRESHOLD = 20;
+    const MeasurementType types[] = { MeasurementType::WINDSPEED, MeasurementType::TEMPERATURE, MeasurementType::SOLARRADIATION };
+    SensorRegistry sensorRegistry;
+    MeasurementAccumulator expected[3][SummaryCube::MONTHS_IN_YEAR];
+
+    // A plain sequential scan of the readings is the reference
+    sensorRegistry.ReadHeader( "WAST,S,T,SR" );
+    auto addReading = [&]( const Date &date, const Time &time, const float readings[] )
+    {
+        AppendReading( sensorRegistry, date, time, readings );
+        for( unsigned type(0); type < 3 && date.GetYear() == YEAR; type++ )
+        {
+            if( readings[type] > THRESHOLD )
+            {
+                expected[type][date.GetMonth() - 1].Add( readings[type] );
+            }
+        }
+    };
+
+    // January holds a single reading, February none, and the other months more than a worker share each
+    const float januaryReadings[] = { 25, 30, 800 };
+    addReading( Date( 15, 1, YEAR ), Time( 12, 0 ), januaryReadings );
+    unsigned index = 0;
+    for( unsigned month(3); month <= SummaryCube::MONTHS_IN_YEAR; month++ )
+    {
+        for( unsigned day(1); day <= 28; day++ )
+        {
+            for( unsigned minutes(0); minutes < 24 * 60; minutes += 10 )
+            {
+                const float readings[] = { float( index * 37 % 50 ), float( index * 13 % 45 ) - 5, float( index * 7919 % 1000 ) };
+                addReading( Date( day, month, YEAR ), Time( minutes / 60, minutes % 60 ), readings );
+                index++;
+            }
+        }
+    }
+    const float otherYearReadings[] = { 40, 40, 900 };
+    addReading( Date( 15, 2, YEAR + 1 ), Time( 12, 0 ), otherYearReadings );
+
+    cout << "Test Monthly Summaries Above a threshold on 1 and 4 threads" << endl;
+    for( unsigned threadCount : { 1u, 4u } )
+    {
+        Client client;
+        client.SetThreadCount( threadCount );
+        for( unsigned type(0); type < 3; type++ )
+        {
+            MeasurementAccumulator monthlySummary[SummaryCube::MONTHS_IN_YEAR];
+            bool isSame = true;
+
+            client.GetMonthlySummariesAbove( sensorRegistry, YEAR, types[type], THRESHOLD, monthlySummary );
+            for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
+            {
+                isSame = isSame && IsSameSummary( monthlySummary[month], expected[type][month] );
+            }
+            Assert( isSame, "Measurement " + to_string( type ) + " on " + to_string( threadCount ) + " threads matches a sequential scan" );
+        }
+    }
+    Assert( expected[0][0].GetCount() == 1 && expected[0][1].GetCount() == 0 && sensorRegistry.GetRowCount() > 4 * 4096,
+            "The columns hold a single reading month, an empty month and more than four worker shares" );
+    cout << endl;
+}
+
+void TestMonthlySummariesAboveTags()
+{
+    SensorRegistry sensorRegistry;
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,2,0,20" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,4,60000,22" );
+    sensorRegistry.AppendLine( "2/3/2016 9:00,6,120000,24" );
+    sensorRegistry.AppendLine( "3/3/2016 9:00,,,," );
+    sensorRegistry.AppendLine( "1/4/2017 9:00,10,180000,30" );
+
+    cout << "Test Monthly Summaries Above a threshold for each measurement tag" << endl;
+    TestMonthlySummariesAboveTag<WindSpeedTag>( sensorRegistry, 3, 5, "wind speed" );
+    TestMonthlySummariesAboveTag<TemperatureTag>( sensorRegistry, 21, 23, "temperature" );
+    TestMonthlySummariesAboveTag<SolarRadiationTag>( sensorRegistry, 0, 90000, "solar radiation" );
+    cout << endl;
+}
+
+template<class Tag>
+void TestMonthlySummariesAboveTag( const SensorRegistry &sensorRegistry, const float &threshold, const float &mean, const string &name )
+{
+    Client client;
+    MeasurementAccumulator byTag[SummaryCube::MONTHS_IN_YEAR];
+    MeasurementAccumulator byType[SummaryCube::MONTHS_IN_YEAR];
+    bool isOtherMonthEmpty = true;
+
+    client.GetMonthlySummariesAbove<Tag>( sensorRegistry, 2016, threshold, byTag );
+    client.GetMonthlySummariesAbove( sensorRegistry, 2016, Tag::TYPE, threshold, byType );
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
+    {
+        isOtherMonthEmpty = isOtherMonthEmpty && ( month == 2 || byTag[month].GetCount() == 0 );
+    }
+
+    Assert( byTag[2].GetCount() == 2 && byTag[2].GetMean() == mean, "The " + name + " tag summarises the 2 readings above the threshold, skipping missing ones" );
+    Assert( isOtherMonthEmpty, "The " + name + " tag leaves the months of other years empty" );
+    Assert( IsSameSummary( byType[2], byTag[2] ), "The " + name + " type dispatches to its tag" );
+}
+
+void TestSharedWorkerPool()
+{
+    WorkerPool workerPool( 4 );
+    Client first( workerPool );
+    Client second( workerPool );
+    SensorRegistry sensorRegistry;
+    MeasurementAccumulator expected;
+    MeasurementAccumulator firstSummary[SummaryCube::MONTHS_IN_YEAR];
+    MeasurementAccumulator secondSummary[SummaryCube::MONTHS_IN_YEAR];
+
+    sensorRegistry.ReadHeader( "WAST,S,T,SR" );
+    for( unsigned i(0); i < 5 * 4096; i++ )
+    {
+        const float readings[] = { float( i % 40 ), 0, 0 };
+        AppendReading( sensorRegistry, Date( 1 + i / 1000, 7, 2015 ), Time( 0, 0 ), readings );
+        if( readings[0] > 10 )
+        {
+            expected.Add( readings[0] );
+        }
+    }
+
+    cout << "Test Clients on a shared Worker Pool" << endl;
+    Assert( first.GetThreadCount() == 4, "A client on a shared pool runs one worker per thread of the pool" );
+    thread other( [&]()
+    {
+        second.GetMonthlySummariesAbove<WindSpeedTag>( sensorRegistry, 2015, 10, secondSummary );
+    } );
+    first.GetMonthlySummariesAbove<WindSpeedTag>( sensorRegistry, 2015, 10, firstSummary );
+    other.join();
+    Assert( IsSameSummary( firstSummary[6], expected ) && IsSameSummary( secondSummary[6], expected ),
+            "Clients reducing at once on a shared pool match a sequential scan" );
+
+    first.SetThreadCount( 2 );
+    first.GetMonthlySummariesAbove<WindSpeedTag>( sensorRegistry, 2015, 10, firstSummary );
+    Assert( first.GetThreadCount() == 2 && IsSameSummary( firstSummary[6], expected ), "A client leaves the shared pool for its own thread count" );
+    cout << endl;
+}
@@ -0,0 +1,14 @@
+#ifndef COLUMNENCODING_H_INCLUDED
+#define COLUMNENCODING_H_INCLUDED
+
+/**
+* @brief Encoding of a block of a column of a columnar file, as stored in its block table.
+*/
+enum class ColumnEncoding
+{
+    PLAIN = 0,          ///< The 32 bit values as they are, readable in place from a mapped file.
+    DELTA = 1,          ///< The first 32 bit value, then the increase to each next value in 1, 2 or 4 bytes.
+    RUN_LENGTH = 2      ///< Pairs of a 32 bit run length and the 32 bit value repeated by the run.
+};
+
+#endif // COLUMNENCODING_H_INCLUDED
@@ -0,0 +1,714 @@
+
+#include<cmath>
+#include<cstring>
+#include<limits>
+#include<atomic>
+
+#include "ColumnKernels.h"
+
+#if defined(__GNUC__) && ( defined(__x86_64__) || defined(__i386__) )
+#define COLUMN_KERNELS_X86
+#include<immintrin.h>
+#endif
+
+namespace ColumnKernels
+{
+
+namespace
+{
+
+const float POSITIVE_INFINITY = std::numeric_limits<float>::infinity();
+const float NEGATIVE_INFINITY = -std::numeric_limits<float>::infinity();
+
+// Angles are reduced to the nearest quarter turn, leaving at most pi / 4 radians for the polynomials
+const float QUARTER_TURN = 90.0f;
+const float INVERSE_QUARTER_TURN = 1.0f / 90.0f;
+const float RADIANS_PER_DEGREE = 3.14159265358979f / 180.0f;
+const float SINE_3 = -1.0f / 6.0f;
+const float SINE_5 = 1.0f / 120.0f;
+const float SINE_7 = -1.0f / 5040.0f;
+const float COSINE_2 = -1.0f / 2.0f;
+const float COSINE_4 = 1.0f / 24.0f;
+const float COSINE_6 = -1.0f / 720.0f;
+const float COSINE_8 = 1.0f / 40320.0f;
+
+// ++++++++++++ SCALAR ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+template<bool MASKED>
+double ScalarSum( const float values[], const unsigned char mask[], unsigned count )
+{
+    double sum = 0.0;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            sum += values[i];
+        }
+    }
+    return sum;
+}
+
+template<bool MASKED>
+double ScalarSumOfSquares( const float values[], const unsigned char mask[], unsigned count, float center )
+{
+    double sum = 0.0;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            double difference = double( values[i] ) - center;
+            sum += difference * difference;
+        }
+    }
+    return sum;
+}
+
+template<bool MASKED>
+float ScalarMinimum( const float values[], const unsigned char mask[], unsigned count )
+{
+    float minimum = POSITIVE_INFINITY;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && values[i] < minimum )
+        {
+            minimum = values[i];
+        }
+    }
+    return minimum;
+}
+
+template<bool MASKED>
+float ScalarMaximum( const float values[], const unsigned char mask[], unsigned count )
+{
+    float maximum = NEGATIVE_INFINITY;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && values[i] > maximum )
+        {
+            maximum = values[i];
+        }
+    }
+    return maximum;
+}
+
+template<bool MASKED>
+unsigned ScalarCountAbove( const float values[], const unsigned char mask[], unsigned count, float threshold )
+{
+    unsigned above = 0;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && values[i] > threshold )
+        {
+            above ++;
+        }
+    }
+    return above;
+}
+
+inline void ScalarSineCosine( float degrees, float &sine, float &cosine )
+{
+    // A missing reading has no quadrant, and converting it to one would be undefined
+    if( !std::isfinite( degrees ) )
+    {
+        sine = std::numeric_limits<float>::quiet_NaN();
+        cosine = sine;
+        return;
+    }
+
+    int quadrant = int( std::nearbyint( degrees * INVERSE_QUARTER_TURN ) );
+    float radians = ( degrees - float( quadrant ) * QUARTER_TURN ) * RADIANS_PER_DEGREE;
+    float squared = radians * radians;
+    float s = radians + radians * squared * ( SINE_3 + squared * ( SINE_5 + squared * SINE_7 ) );
+    float c = 1.0f + squared * ( COSINE_2 + squared * ( COSINE_4 + squared * ( COSINE_6 + squared * COSINE_8 ) ) );
+
+    // sin( x + q * 90 ) and cos( x + q * 90 ) swap for odd quadrants and change sign every half turn
+    sine = ( quadrant & 1 ) ? c : s;
+    cosine = ( quadrant & 1 ) ? s : c;
+    sine = ( quadrant & 2 ) ? -sine : sine;
+    cosine = ( ( quadrant + 1 ) & 2 ) ? -cosine : cosine;
+}
+
+template<bool MASKED>
+void ScalarSumOfSinesAndCosines( const float degrees[], const unsigned char mask[], unsigned count, double &sumOfSines, double &sumOfCosines )
+{
+    sumOfSines = 0.0;
+    sumOfCosines = 0.0;
+    for( unsigned i(0); i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && std::isfinite( degrees[i] ) )
+        {
+            float sine;
+            float cosine;
+            ScalarSineCosine( degrees[i], sine, cosine );
+            sumOfSines += sine;
+            sumOfCosines += cosine;
+        }
+    }
+}
+
+#ifdef COLUMN_KERNELS_X86
+
+// ++++++++++++ SSE +++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+__attribute__((target("sse2")))
+inline __m128 SseLaneMask( const unsigned char mask[] )
+{
+    int bytes;
+    std::memcpy( &bytes, mask, sizeof( bytes ) );
+    __m128i zero = _mm_setzero_si128();
+    __m128i lanes = _mm_unpacklo_epi16( _mm_unpacklo_epi8( _mm_cvtsi32_si128( bytes ), zero ), zero );
+    return _mm_castsi128_ps( _mm_cmpgt_epi32( lanes, zero ) );
+}
+
+__attribute__((target("sse2")))
+inline double SseHorizontalSum( __m128d sum )
+{
+    double lanes[2];
+    _mm_storeu_pd( lanes, sum );
+    return lanes[0] + lanes[1];
+}
+
+template<bool MASKED>
+__attribute__((target("sse2")))
+double SseSumOfSquares( const float values[], const unsigned char mask[], unsigned count, float center, bool square )
+{
+    __m128d low = _mm_setzero_pd();
+    __m128d high = _mm_setzero_pd();
+    __m128 offset = _mm_set1_ps( center );
+    unsigned i = 0;
+
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128 x = _mm_sub_ps( _mm_loadu_ps( values + i ), offset );
+        if( MASKED )
+        {
+            x = _mm_and_ps( x, SseLaneMask( mask + i ) );
+        }
+        __m128d lowLanes = _mm_cvtps_pd( x );
+        __m128d highLanes = _mm_cvtps_pd( _mm_movehl_ps( x, x ) );
+        if( square )
+        {
+            lowLanes = _mm_mul_pd( lowLanes, lowLanes );
+            highLanes = _mm_mul_pd( highLanes, highLanes );
+        }
+        low = _mm_add_pd( low, lowLanes );
+        high = _mm_add_pd( high, highLanes );
+    }
+
+    double sum = SseHorizontalSum( _mm_add_pd( low, high ) );
+    for( ; i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            double difference = double( values[i] ) - center;
+            sum += square ? difference * difference : difference;
+        }
+    }
+    return sum;
+}
+
+template<bool MASKED, bool MINIMUM>
+__attribute__((target("sse2")))
+float SseExtremum( const float values[], const unsigned char mask[], unsigned count )
+{
+    __m128 identity = _mm_set1_ps( MINIMUM ? POSITIVE_INFINITY : NEGATIVE_INFINITY );
+    __m128 extremum = identity;
+    unsigned i = 0;
+
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128 x = _mm_loadu_ps( values + i );
+        if( MASKED )
+        {
+            __m128 lanes = SseLaneMask( mask + i );
+            x = _mm_or_ps( _mm_and_ps( lanes, x ), _mm_andnot_ps( lanes, identity ) );
+        }
+        extremum = MINIMUM ? _mm_min_ps( extremum, x ) : _mm_max_ps( extremum, x );
+    }
+
+    float lanes[4];
+    _mm_storeu_ps( lanes, extremum );
+    float result = MINIMUM ? POSITIVE_INFINITY : NEGATIVE_INFINITY;
+    for( unsigned lane(0); lane < 4; lane++ )
+    {
+        result = MINIMUM ? ( lanes[lane] < result ? lanes[lane] : result ) : ( lanes[lane] > result ? lanes[lane] : result );
+    }
+    for( ; i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            result = MINIMUM ? ( values[i] < result ? values[i] : result ) : ( values[i] > result ? values[i] : result );
+        }
+    }
+    return result;
+}
+
+template<bool MASKED>
+__attribute__((target("sse2")))
+unsigned SseCountAbove( const float values[], const unsigned char mask[], unsigned count, float threshold )
+{
+    __m128 limit = _mm_set1_ps( threshold );
+    unsigned above = 0;
+    unsigned i = 0;
+
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128 greater = _mm_cmpgt_ps( _mm_loadu_ps( values + i ), limit );
+        if( MASKED )
+        {
+            greater = _mm_and_ps( greater, SseLaneMask( mask + i ) );
+        }
+        above += __builtin_popcount( _mm_movemask_ps( greater ) );
+    }
+    for( ; i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && values[i] > threshold )
+        {
+            above ++;
+        }
+    }
+    return above;
+}
+
+__attribute__((target("sse2")))
+inline void SseSineCosine( __m128 degrees, __m128 &sine, __m128 &cosine )
+{
+    __m128i one = _mm_set1_epi32( 1 );
+    __m128i two = _mm_set1_epi32( 2 );
+    __m128i quadrant = _mm_cvtps_epi32( _mm_mul_ps( degrees, _mm_set1_ps( INVERSE_QUARTER_TURN ) ) );
+    __m128 radians = _mm_mul_ps( _mm_sub_ps( degrees, _mm_mul_ps( _mm_cvtepi32_ps( quadrant ), _mm_set1_ps( QUARTER_TURN ) ) ),
+                                 _mm_set1_ps( RADIANS_PER_DEGREE ) );
+    __m128 squared = _mm_mul_ps( radians, radians );
+    __m128 s = _mm_add_ps( _mm_set1_ps( SINE_5 ), _mm_mul_ps( squared, _mm_set1_ps( SINE_7 ) ) );
+    s = _mm_add_ps( _mm_set1_ps( SINE_3 ), _mm_mul_ps( squared, s ) );
+    s = _mm_add_ps( radians, _mm_mul_ps( _mm_mul_ps( radians, squared ), s ) );
+    __m128 c = _mm_add_ps( _mm_set1_ps( COSINE_6 ), _mm_mul_ps( squared, _mm_set1_ps( COSINE_8 ) ) );
+    c = _mm_add_ps( _mm_set1_ps( COSINE_4 ), _mm_mul_ps( squared, c ) );
+    c = _mm_add_ps( _mm_set1_ps( COSINE_2 ), _mm_mul_ps( squared, c ) );
+    c = _mm_add_ps( _mm_set1_ps( 1.0f ), _mm_mul_ps( squared, c ) );
+
+    __m128 swap = _mm_castsi128_ps( _mm_cmpeq_epi32( _mm_and_si128( quadrant, one ), one ) );
+    sine = _mm_or_ps( _mm_and_ps( swap, c ), _mm_andnot_ps( swap, s ) );
+    cosine = _mm_or_ps( _mm_and_ps( swap, s ), _mm_andnot_ps( swap, c ) );
+    sine = _mm_xor_ps( sine, _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( quadrant, two ), 30 ) ) );
+    cosine = _mm_xor_ps( cosine, _mm_castsi128_ps( _mm_slli_epi32( _mm_and_si128( _mm_add_epi32( quadrant, one ), two ), 30 ) ) );
+}
+
+template<bool MASKED>
+__attribute__((target("sse2")))
+void SseSumOfSinesAndCosines( const float degrees[], const unsigned char mask[], unsigned count, double &sumOfSines, double &sumOfCosines )
+{
+    __m128d sines = _mm_setzero_pd();
+    __m128d cosines = _mm_setzero_pd();
+    unsigned i = 0;
+
+    for( ; i + 4 <= count; i += 4 )
+    {
+        __m128 sine;
+        __m128 cosine;
+        __m128 angles = _mm_loadu_ps( degrees + i );
+        __m128 lanes = _mm_cmplt_ps( _mm_andnot_ps( _mm_set1_ps( -0.0f ), angles ), _mm_set1_ps( POSITIVE_INFINITY ) );
+        SseSineCosine( angles, sine, cosine );
+        if( MASKED )
+        {
+            lanes = _mm_and_ps( lanes, SseLaneMask( mask + i ) );
+        }
+        sine = _mm_and_ps( sine, lanes );
+        cosine = _mm_and_ps( cosine, lanes );
+        sines = _mm_add_pd( sines, _mm_add_pd( _mm_cvtps_pd( sine ), _mm_cvtps_pd( _mm_movehl_ps( sine, sine ) ) ) );
+        cosines = _mm_add_pd( cosines, _mm_add_pd( _mm_cvtps_pd( cosine ), _mm_cvtps_pd( _mm_movehl_ps( cosine, cosine ) ) ) );
+    }
+
+    double tailSines;
+    double tailCosines;
+    ScalarSumOfSinesAndCosines<MASKED>( degrees + i, MASKED ? mask + i : mask, count - i, tailSines, tailCosines );
+    sumOfSines = SseHorizontalSum( sines ) + tailSines;
+    sumOfCosines = SseHorizontalSum( cosines ) + tailCosines;
+}
+
+// ++++++++++++ AVX2 ++++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+__attribute__((target("avx2")))
+inline __m256 Avx2LaneMask( const unsigned char mask[] )
+{
+    __m128i bytes = _mm_loadl_epi64( reinterpret_cast<const __m128i *>( mask ) );
+    __m256i lanes = _mm256_cvtepu8_epi32( bytes );
+    return _mm256_castsi256_ps( _mm256_cmpgt_epi32( lanes, _mm256_setzero_si256() ) );
+}
+
+__attribute__((target("avx2")))
+inline double Avx2HorizontalSum( __m256d sum )
+{
+    double lanes[4];
+    _mm256_storeu_pd( lanes, sum );
+    return ( lanes[0] + lanes[1] ) + ( lanes[2] + lanes[3] );
+}
+
+template<bool MASKED>
+__attribute__((target("avx2")))
+double Avx2SumOfSquares( const float values[], const unsigned char mask[], unsigned count, float center, bool square )
+{
+    __m256d low = _mm256_setzero_pd();
+    __m256d high = _mm256_setzero_pd();
+    __m256 offset = _mm256_set1_ps( center );
+    unsigned i = 0;
+
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256 x = _mm256_sub_ps( _mm256_loadu_ps( values + i ), offset );
+        if( MASKED )
+        {
+            x = _mm256_and_ps( x, Avx2LaneMask( mask + i ) );
+        }
+        __m256d lowLanes = _mm256_cvtps_pd( _mm256_castps256_ps128( x ) );
+        __m256d highLanes = _mm256_cvtps_pd( _mm256_extractf128_ps( x, 1 ) );
+        if( square )
+        {
+            lowLanes = _mm256_mul_pd( lowLanes, lowLanes );
+            highLanes = _mm256_mul_pd( highLanes, highLanes );
+        }
+        low = _mm256_add_pd( low, lowLanes );
+        high = _mm256_add_pd( high, highLanes );
+    }
+
+    double sum = Avx2HorizontalSum( _mm256_add_pd( low, high ) );
+    for( ; i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            double difference = double( values[i] ) - center;
+            sum += square ? difference * difference : difference;
+        }
+    }
+    return sum;
+}
+
+template<bool MASKED, bool MINIMUM>
+__attribute__((target("avx2")))
+float Avx2Extremum( const float values[], const unsigned char mask[], unsigned count )
+{
+    __m256 identity = _mm256_set1_ps( MINIMUM ? POSITIVE_INFINITY : NEGATIVE_INFINITY );
+    __m256 extremum = identity;
+    unsigned i = 0;
+
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256 x = _mm256_loadu_ps( values + i );
+        if( MASKED )
+        {
+            x = _mm256_blendv_ps( identity, x, Avx2LaneMask( mask + i ) );
+        }
+        extremum = MINIMUM ? _mm256_min_ps( extremum, x ) : _mm256_max_ps( extremum, x );
+    }
+
+    float lanes[8];
+    _mm256_storeu_ps( lanes, extremum );
+    float result = MINIMUM ? POSITIVE_INFINITY : NEGATIVE_INFINITY;
+    for( unsigned lane(0); lane < 8; lane++ )
+    {
+        result = MINIMUM ? ( lanes[lane] < result ? lanes[lane] : result ) : ( lanes[lane] > result ? lanes[lane] : result );
+    }
+    for( ; i < count; i++ )
+    {
+        if( !MASKED || mask[i] )
+        {
+            result = MINIMUM ? ( values[i] < result ? values[i] : result ) : ( values[i] > result ? values[i] : result );
+        }
+    }
+    return result;
+}
+
+template<bool MASKED>
+__attribute__((target("avx2")))
+unsigned Avx2CountAbove( const float values[], const unsigned char mask[], unsigned count, float threshold )
+{
+    __m256 limit = _mm256_set1_ps( threshold );
+    unsigned above = 0;
+    unsigned i = 0;
+
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256 greater = _mm256_cmp_ps( _mm256_loadu_ps( values + i ), limit, _CMP_GT_OQ );
+        if( MASKED )
+        {
+            greater = _mm256_and_ps( greater, Avx2LaneMask( mask + i ) );
+        }
+        above += __builtin_popcount( _mm256_movemask_ps( greater ) );
+    }
+    for( ; i < count; i++ )
+    {
+        if( ( !MASKED || mask[i] ) && values[i] > threshold )
+        {
+            above ++;
+        }
+    }
+    return above;
+}
+
+__attribute__((target("avx2")))
+inline void Avx2SineCosine( __m256 degrees, __m256 &sine, __m256 &cosine )
+{
+    __m256i one = _mm256_set1_epi32( 1 );
+    __m256i two = _mm256_set1_epi32( 2 );
+    __m256i quadrant = _mm256_cvtps_epi32( _mm256_mul_ps( degrees, _mm256_set1_ps( INVERSE_QUARTER_TURN ) ) );
+    __m256 radians = _mm256_mul_ps( _mm256_sub_ps( degrees, _mm256_mul_ps( _mm256_cvtepi32_ps( quadrant ), _mm256_set1_ps( QUARTER_TURN ) ) ),
+                                    _mm256_set1_ps( RADIANS_PER_DEGREE ) );
+    __m256 squared = _mm256_mul_ps( radians, radians );
+    __m256 s = _mm256_add_ps( _mm256_set1_ps( SINE_5 ), _mm256_mul_ps( squared, _mm256_set1_ps( SINE_7 ) ) );
+    s = _mm256_add_ps( _mm256_set1_ps( SINE_3 ), _mm256_mul_ps( squared, s ) );
+    s = _mm256_add_ps( radians, _mm256_mul_ps( _mm256_mul_ps( radians, squared ), s ) );
+    __m256 c = _mm256_add_ps( _mm256_set1_ps( COSINE_6 ), _mm256_mul_ps( squared, _mm256_set1_ps( COSINE_8 ) ) );
+    c = _mm256_add_ps( _mm256_set1_ps( COSINE_4 ), _mm256_mul_ps( squared, c ) );
+    c = _mm256_add_ps( _mm256_set1_ps( COSINE_2 ), _mm256_mul_ps( squared, c ) );
+    c = _mm256_add_ps( _mm256_set1_ps( 1.0f ), _mm256_mul_ps( squared, c ) );
+
+    __m256 swap = _mm256_castsi256_ps( _mm256_cmpeq_epi32( _mm256_and_si256( quadrant, one ), one ) );
+    sine = _mm256_blendv_ps( s, c, swap );
+    cosine = _mm256_blendv_ps( c, s, swap );
+    sine = _mm256_xor_ps( sine, _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( quadrant, two ), 30 ) ) );
+    cosine = _mm256_xor_ps( cosine, _mm256_castsi256_ps( _mm256_slli_epi32( _mm256_and_si256( _mm256_add_epi32( quadrant, one ), two ), 30 ) ) );
+}
+
+template<bool MASKED>
+__attribute__((target("avx2")))
+void Avx2SumOfSinesAndCosines( const float degrees[], const unsigned char mask[], unsigned count, double &sumOfSines, double &sumOfCosines )
+{
+    __m256d sines = _mm256_setzero_pd();
+    __m256d cosines = _mm256_setzero_pd();
+    unsigned i = 0;
+
+    for( ; i + 8 <= count; i += 8 )
+    {
+        __m256 sine;
+        __m256 cosine;
+        __m256 angles = _mm256_loadu_ps( degrees + i );
+        __m256 lanes = _mm256_cmp_ps( _mm256_andnot_ps( _mm256_set1_ps( -0.0f ), angles ), _mm256_set1_ps( POSITIVE_INFINITY ), _CMP_LT_OQ );
+        Avx2SineCosine( angles, sine, cosine );
+        if( MASKED )
+        {
+            lanes = _mm256_and_ps( lanes, Avx2LaneMask( mask + i ) );
+        }
+        sine = _mm256_and_ps( sine, lanes );
+        cosine = _mm256_and_ps( cosine, lanes );
+        sines = _mm256_add_pd( sines, _mm256_add_pd( _mm256_cvtps_pd( _mm256_castps256_ps128( sine ) ), _mm256_cvtps_pd( _mm256_extractf128_ps( sine, 1 ) ) ) );
+        cosines = _mm256_add_pd( cosines, _mm256_add_pd( _mm256_cvtps_pd( _mm256_castps256_ps128( cosine ) ), _mm256_cvtps_pd( _mm256_extractf128_ps( cosine, 1 ) ) ) );
+    }
+
+    double tailSines;
+    double tailCosines;
+    ScalarSumOfSinesAndCosines<MASKED>( degrees + i, MASKED ? mask + i : mask, count - i, tailSines, tailCosines );
+    sumOfSines = Avx2HorizontalSum( sines ) + tailSines;
+    sumOfCosines = Avx2HorizontalSum( cosines ) + tailCosines;
+}
+
+#endif // COLUMN_KERNELS_X86
+
+// ++++++++++++ DISPATCH ++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+InstructionSet DetectInstructionSet()
+{
+#ifdef COLUMN_KERNELS_X86
+    __builtin_cpu_init();
+    if( __builtin_cpu_supports( "avx2" ) )
+    {
+        return InstructionSet::AVX2;
+    }
+    if( __builtin_cpu_supports( "sse2" ) )
+    {
+        return InstructionSet::SSE;
+    }
+#endif
+    return InstructionSet::SCALAR;
+}
+
+// Read by every worker thread running a kernel, so it may be changed while they run
+std::atomic<InstructionSet> &ActiveInstructionSet()
+{
+    static std::atomic<InstructionSet> s_active( GetSupportedInstructionSet() );
+    return s_active;
+}
+
+template<bool MASKED>
+double DispatchSumOfSquares( const float values[], const unsigned char mask[], unsigned count, float center, bool square )
+{
+    switch( ActiveInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef COLUMN_KERNELS_X86
+    case InstructionSet::AVX2:
+        return Avx2SumOfSquares<MASKED>( values, mask, count, center, square );
+    case InstructionSet::SSE:
+        return SseSumOfSquares<MASKED>( values, mask, count, center, square );
+#endif
+    default:
+        return square ? ScalarSumOfSquares<MASKED>( values, mask, count, center ) : ScalarSum<MASKED>( values, mask, count );
+    }
+}
+
+template<bool MASKED, bool MINIMUM>
+float DispatchExtremum( const float values[], const unsigned char mask[], unsigned count )
+{
+    switch( ActiveInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef COLUMN_KERNELS_X86
+    case InstructionSet::AVX2:
+        return Avx2Extremum<MASKED, MINIMUM>( values, mask, count );
+    case InstructionSet::SSE:
+        return SseExtremum<MASKED, MINIMUM>( values, mask, count );
+#endif
+    default:
+        return MINIMUM ? ScalarMinimum<MASKED>( values, mask, count ) : ScalarMaximum<MASKED>( values, mask, count );
+    }
+}
+
+template<bool MASKED>
+unsigned DispatchCountAbove( const float values[], const unsigned char mask[], unsigned count, float threshold )
+{
+    switch( ActiveInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef COLUMN_KERNELS_X86
+    case InstructionSet::AVX2:
+        return Avx2CountAbove<MASKED>( values, mask, count, threshold );
+    case InstructionSet::SSE:
+        return SseCountAbove<MASKED>( values, mask, count, threshold );
+#endif
+    default:
+        return ScalarCountAbove<MASKED>( values, mask, count, threshold );
+    }
+}
+
+template<bool MASKED>
+void DispatchSumOfSinesAndCosines( const float degrees[], const unsigned char mask[], unsigned count, double &sumOfSines, double &sumOfCosines )
+{
+    switch( ActiveInstructionSet().load( std::memory_order_relaxed ) )
+    {
+#ifdef COLUMN_KERNELS_X86
+    case InstructionSet::AVX2:
+        Avx2SumOfSinesAndCosines<MASKED>( degrees, mask, count, sumOfSines, sumOfCosines );
+        return;
+    case InstructionSet::SSE:
+        SseSumOfSinesAndCosines<MASKED>( degrees, mask, count, sumOfSines, sumOfCosines );
+        return;
+#endif
+    default:
+        ScalarSumOfSinesAndCosines<MASKED>( degrees, mask, count, sumOfSines, sumOfCosines );
+    }
+}
+
+}
+
+// ++++++++++++ PUBLIC ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+InstructionSet GetSupportedInstructionSet()
+{
+    static InstructionSet s_supported = DetectInstructionSet();
+    return s_supported;
+}
+
+InstructionSet GetInstructionSet()
+{
+    return ActiveInstructionSet().load();
+}
+
+void SetInstructionSet( InstructionSet instructionSet )
+{
+    InstructionSet supported = GetSupportedInstructionSet();
+    ActiveInstructionSet().store( ( int( instructionSet ) > int( supported ) ) ? supported : instructionSet );
+}
+
+const char *GetInstructionSetName( InstructionSet instructionSet )
+{
+    switch( instructionSet )
+    {
+    case InstructionSet::AVX2:
+        return "AVX2";
+    case InstructionSet::SSE:
+        return "SSE";
+    default:
+        return "Scalar";
+    }
+}
+
+double Sum( const float values[], const unsigned &count )
+{
+    return DispatchSumOfSquares<false>( values, nullptr, count, 0.0, false );
+}
+
+double MaskedSum( const float values[], const unsigned char mask[], const unsigned &count )
+{
+    return DispatchSumOfSquares<true>( values, mask, count, 0.0, false );
+}
+
+double SumOfSquares( const float values[], const unsigned &count, const float &center )
+{
+    return DispatchSumOfSquares<false>( values, nullptr, count, center, true );
+}
+
+double MaskedSumOfSquares( const float values[], const unsigned char mask[], const unsigned &count, const float &center )
+{
+    return DispatchSumOfSquares<true>( values, mask, count, center, true );
+}
+
+float Minimum( const float values[], const unsigned &count )
+{
+    return DispatchExtremum<false, true>( values, nullptr, count );
+}
+
+float MaskedMinimum( const float values[], const unsigned char mask[], const unsigned &count )
+{
+    return DispatchExtremum<true, true>( values, mask, count );
+}
+
+float Maximum( const float values[], const unsigned &count )
+{
+    return DispatchExtremum<false, false>( values, nullptr, count );
+}
+
+float MaskedMaximum( const float values[], const unsigned char mask[], const unsigned &count )
+{
+    return DispatchExtremum<true, false>( values, mask, count );
+}
+
+unsigned CountAbove( const float values[], const unsigned &count, const float &threshold )
+{
+    return DispatchCountAbove<false>( values, nullptr, count, threshold );
+}
+
+unsigned MaskedCountAbove( const float values[], const unsigned char mask[], const unsigned &count, const float &threshold )
+{
+    return DispatchCountAbove<true>( values, mask, count, threshold );
+}
+
+void SineCosine( const float &degrees, float &sine, float &cosine )
+{
+    ScalarSineCosine( degrees, sine, cosine );
+}
+
+void SumOfSinesAndCosines( const float degrees[], const unsigned &count, double &sumOfSines, double &sumOfCosines )
+{
+    DispatchSumOfSinesAndCosines<false>( degrees, nullptr, count, sumOfSines, sumOfCosines );
+}
+
+void MaskedSumOfSinesAndCosines( const float degrees[], const unsigned char mask[], const unsigned &count, double &sumOfSines, double &sumOfCosines )
+{
+    DispatchSumOfSinesAndCosines<true>( degrees, mask, count, sumOfSines, sumOfCosines );
+}
+
+unsigned CountSelected( const unsigned char mask[], const unsigned &count )
+{
+    unsigned selected = 0;
+    for( unsigned i(0); i < count; i++ )
+    {
+        selected += ( mask[i] != 0 );
+    }
+    return selected;
+}
+
+void BuildKeyMask( const unsigned keys[], const unsigned &count, const unsigned &key, unsigned char mask[] )
+{
+    for( unsigned i(0); i < count; i++ )
+    {
+        mask[i] = ( keys[i] == key );
+    }
+}
+
+}
@@ -0,0 +1,221 @@
+/**
+ * @file ColumnKernels.h
+ * @brief Declares the vectorised reduction kernels over contiguous float columns.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef COLUMNKERNELS_H_INCLUDED
+#define COLUMNKERNELS_H_INCLUDED
+
+/**
+ * @brief Namespace containing the sum, sum of squares, minimum, maximum, count over threshold and
+ * sine and cosine reductions used by the column statistics.
+ *
+ * Every reduction has an unmasked form over the whole column and a masked form that only reads the
+ * elements whose mask byte is non-zero. Each call dispatches once to an AVX2, SSE or scalar kernel,
+ * picked at runtime from the instruction sets supported by the CPU. Sums are accumulated in double.
+ */
+namespace ColumnKernels
+{
+
+/**
+ * @brief Instruction sets a kernel can be dispatched to.
+ */
+enum class InstructionSet
+{
+    SCALAR,
+    SSE,
+    AVX2
+};
+
+/**
+ * @brief Gets the best instruction set supported by the CPU.
+ *
+ * @return The detected instruction set, SCALAR on non x86 targets.
+ */
+InstructionSet GetSupportedInstructionSet();
+
+/**
+ * @brief Gets the instruction set the kernels are currently dispatched to.
+ *
+ * @return The active instruction set, the supported instruction set by default.
+ */
+InstructionSet GetInstructionSet();
+
+/**
+ * @brief Sets the instruction set the kernels are dispatched to.
+ *
+ * Safe to call while other threads run kernels, which each finish on the instruction set they started with.
+ *
+ * @param[in] instructionSet The requested instruction set, lowered to the supported instruction set.
+ */
+void SetInstructionSet( InstructionSet instructionSet );
+
+/**
+ * @brief Gets the name of an instruction set.
+ *
+ * @param[in] instructionSet The instruction set.
+ * @return "AVX2", "SSE" or "Scalar".
+ */
+const char *GetInstructionSetName( InstructionSet instructionSet );
+
+/**
+ * @brief Sums a column.
+ *
+ * @param[in] values The column.
+ * @param[in] count The number of elements in the column.
+ * @return The sum of the elements.
+ */
+double Sum( const float values[], const unsigned &count );
+
+/**
+ * @brief Sums the selected elements of a column.
+ *
+ * @param[in] values The column.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @return The sum of the selected elements.
+ */
+double MaskedSum( const float values[], const unsigned char mask[], const unsigned &count );
+
+/**
+ * @brief Sums the squared differences of a column from a center.
+ *
+ * A center of 0 gives the plain sum of squares, a center of the mean gives M2.
+ *
+ * @param[in] values The column.
+ * @param[in] count The number of elements in the column.
+ * @param[in] center The value subtracted from each element before squaring.
+ * @return The sum of ( element - center ) squared.
+ */
+double SumOfSquares( const float values[], const unsigned &count, const float &center = 0.0 );
+
+/**
+ * @brief Sums the squared differences of the selected elements of a column from a center.
+ *
+ * @param[in] values The column.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @param[in] center The value subtracted from each element before squaring.
+ * @return The sum of ( selected element - center ) squared.
+ */
+double MaskedSumOfSquares( const float values[], const unsigned char mask[], const unsigned &count, const float &center = 0.0 );
+
+/**
+ * @brief Finds the smallest element of a column.
+ *
+ * @param[in] values The column.
+ * @param[in] count The number of elements in the column.
+ * @return The minimum element, +infinity when the column is empty.
+ */
+float Minimum( const float values[], const unsigned &count );
+
+/**
+ * @brief Finds the smallest selected element of a column.
+ *
+ * @param[in] values The column.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @return The minimum selected element, +infinity when nothing is selected.
+ */
+float MaskedMinimum( const float values[], const unsigned char mask[], const unsigned &count );
+
+/**
+ * @brief Finds the largest element of a column.
+ *
+ * @param[in] values The column.
+ * @param[in] count The number of elements in the column.
+ * @return The maximum element, -infinity when the column is empty.
+ */
+float Maximum( const float values[], const unsigned &count );
+
+/**
+ * @brief Finds the largest selected element of a column.
+ *
+ * @param[in] values The column.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @return The maximum selected element, -infinity when nothing is selected.
+ */
+float MaskedMaximum( const float values[], const unsigned char mask[], const unsigned &count );
+
+/**
+ * @brief Counts the elements of a column greater than a threshold.
+ *
+ * @param[in] values The column.
+ * @param[in] count The number of elements in the column.
+ * @param[in] threshold The threshold to compare against.
+ * @return The number of elements greater than the threshold.
+ */
+unsigned CountAbove( const float values[], const unsigned &count, const float &threshold );
+
+/**
+ * @brief Counts the selected elements of a column greater than a threshold.
+ *
+ * @param[in] values The column.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @param[in] threshold The threshold to compare against.
+ * @return The number of selected elements greater than the threshold.
+ */
+unsigned MaskedCountAbove( const float values[], const unsigned char mask[], const unsigned &count, const float &threshold );
+
+/**
+ * @brief Calculates the sine and cosine of an angle with the polynomial approximation of the kernels.
+ *
+ * The angle is reduced to the nearest quarter turn and the remaining +-45 degrees evaluated with
+ * short Taylor polynomials, within 4e-7 of std::sin and std::cos for angles of a few turns.
+ *
+ * @param[in] degrees The angle, in degrees.
+ * @param[out] sine The sine of the angle, NaN if the angle is not finite.
+ * @param[out] cosine The cosine of the angle, NaN if the angle is not finite.
+ */
+void SineCosine( const float &degrees, float &sine, float &cosine );
+
+/**
+ * @brief Sums the sines and cosines of a column of angles, the vector sum of a circular mean.
+ *
+ * Elements that are not finite are missing readings, and are never added.
+ *
+ * @param[in] degrees The column of angles, in degrees.
+ * @param[in] count The number of elements in the column.
+ * @param[out] sumOfSines The sum of the sines of the finite elements.
+ * @param[out] sumOfCosines The sum of the cosines of the finite elements.
+ */
+void SumOfSinesAndCosines( const float degrees[], const unsigned &count, double &sumOfSines, double &sumOfCosines );
+
+/**
+ * @brief Sums the sines and cosines of the selected elements of a column of angles.
+ *
+ * Unselected elements and elements that are not finite are never added, so missing readings may be NaN.
+ *
+ * @param[in] degrees The column of angles, in degrees.
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of elements in the column.
+ * @param[out] sumOfSines The sum of the sines of the selected elements.
+ * @param[out] sumOfCosines The sum of the cosines of the selected elements.
+ */
+void MaskedSumOfSinesAndCosines( const float degrees[], const unsigned char mask[], const unsigned &count, double &sumOfSines, double &sumOfCosines );
+
+/**
+ * @brief Counts the selected elements of a mask.
+ *
+ * @param[in] mask One byte per element, non-zero when the element is selected.
+ * @param[in] count The number of bytes in the mask.
+ * @return The number of non-zero bytes.
+ */
+unsigned CountSelected( const unsigned char mask[], const unsigned &count );
+
+/**
+ * @brief Builds a mask selecting the elements whose key equals a key.
+ *
+ * @param[in] keys The key column.
+ * @param[in] count The number of elements in the key column.
+ * @param[in] key The key to select.
+ * @param[out] mask One byte per element, set to 1 when the key matches and 0 otherwise.
+ */
+void BuildKeyMask( const unsigned keys[], const unsigned &count, const unsigned &key, unsigned char mask[] );
+
+}
+
+#endif // COLUMNKERNELS_H_INCLUDED
@@ -0,0 +1,191 @@
+
+#include<iostream>
+#include<cmath>
+#include<limits>
+#include<algorithm>
+
+#include "ColumnKernels.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+bool IsClose( const double &actual, const double &expected );
+void TestKnownColumn();
+void TestEmptyColumn();
+void TestInstructionSetsAgree( const float values[], const unsigned char mask[], const unsigned &count );
+void TestKeyMask();
+void TestSinesAndCosines();
+
+int main()
+{
+    const unsigned count = 1003;
+    float values[count];
+    unsigned char mask[count];
+
+    for( unsigned i(0); i<count; i++ )
+    {
+        values[i] = float( ( i * 37 ) % 101 ) / 4 - 10;
+        mask[i] = ( i % 3 == 0 ) ? 1 : 0;
+    }
+
+    cout << "Supported instruction set: "
+         << ColumnKernels::GetInstructionSetName( ColumnKernels::GetSupportedInstructionSet() ) << '\n' << endl;
+
+    TestKnownColumn();
+    TestEmptyColumn();
+    TestInstructionSetsAgree( values, mask, count );
+    TestKeyMask();
+    TestSinesAndCosines();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+bool IsClose( const double &actual, const double &expected )
+{
+    return fabs( actual - expected ) < 0.001;
+}
+
+void TestKnownColumn()
+{
+    const unsigned count = 11;
+    float values[count] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11 };
+    unsigned char mask[count] = { 1, 0, 1, 0, 1, 0, 1, 0, 1, 0, 1 };
+
+    cout << "Test on reductions of a known column" << endl;
+    Assert( IsClose( ColumnKernels::Sum( values, count ), 66 ), "Sum of 1 ~ 11 is 66" );
+    Assert( IsClose( ColumnKernels::MaskedSum( values, mask, count ), 36 ), "Masked sum of odd numbers is 36" );
+    Assert( IsClose( ColumnKernels::SumOfSquares( values, count ), 506 ), "Sum of squares of 1 ~ 11 is 506" );
+    Assert( IsClose( ColumnKernels::SumOfSquares( values, count, 6 ), 110 ), "Sum of squares about the mean is 110" );
+    Assert( IsClose( ColumnKernels::MaskedSumOfSquares( values, mask, count, 6 ), 70 ), "Masked sum of squares about 6 is 70" );
+    Assert( ColumnKernels::Minimum( values, count ) == 1, "Minimum is 1" );
+    Assert( ColumnKernels::Maximum( values, count ) == 11, "Maximum is 11" );
+    Assert( ColumnKernels::MaskedMaximum( values, mask, count - 1 ) == 9, "Masked maximum of the first 10 is 9" );
+    Assert( ColumnKernels::CountAbove( values, count, 8 ) == 3, "3 values above 8" );
+    Assert( ColumnKernels::MaskedCountAbove( values, mask, count, 8 ) == 2, "2 selected values above 8" );
+    Assert( ColumnKernels::CountSelected( mask, count ) == 6, "6 values selected" );
+    cout << endl;
+}
+
+void TestEmptyColumn()
+{
+    float values[1] = { 5 };
+    unsigned char mask[1] = { 0 };
+
+    cout << "Test on reductions of an empty selection" << endl;
+    Assert( ColumnKernels::Sum( values, 0 ) == 0.0, "Sum of no values is 0" );
+    Assert( ColumnKernels::MaskedMinimum( values, mask, 1 ) > 1e30, "Minimum of no values is +infinity" );
+    Assert( ColumnKernels::MaskedMaximum( values, mask, 1 ) < -1e30, "Maximum of no values is -infinity" );
+    cout << endl;
+}
+
+void TestInstructionSetsAgree( const float values[], const unsigned char mask[], const unsigned &count )
+{
+    ColumnKernels::InstructionSet supported = ColumnKernels::GetSupportedInstructionSet();
+
+    ColumnKernels::SetInstructionSet( ColumnKernels::InstructionSet::SCALAR );
+    double sum = ColumnKernels::Sum( values, count );
+    double maskedSum = ColumnKernels::MaskedSum( values, mask, count );
+    double squares = ColumnKernels::MaskedSumOfSquares( values, mask, count, 1.5 );
+    float minimum = ColumnKernels::MaskedMinimum( values, mask, count );
+    float maximum = ColumnKernels::Maximum( values, count );
+    unsigned above = ColumnKernels::MaskedCountAbove( values, mask, count, 2.5 );
+    double sines = 0.0;
+    double cosines = 0.0;
+    ColumnKernels::MaskedSumOfSinesAndCosines( values, mask, count, sines, cosines );
+
+    for( int set = int( ColumnKernels::InstructionSet::SSE ); set <= int( supported ); set++ )
+    {
+        ColumnKernels::InstructionSet instructionSet = ColumnKernels::InstructionSet( set );
+        string name = ColumnKernels::GetInstructionSetName( instructionSet );
+        ColumnKernels::SetInstructionSet( instructionSet );
+
+        cout << "Test on " << name << " kernels matching the scalar kernels" << endl;
+        Assert( ColumnKernels::GetInstructionSet() == instructionSet, name + " kernels are active" );
+        Assert( IsClose( ColumnKernels::Sum( values, count ), sum ), name + " sum matches" );
+        Assert( IsClose( ColumnKernels::MaskedSum( values, mask, count ), maskedSum ), name + " masked sum matches" );
+        Assert( IsClose( ColumnKernels::MaskedSumOfSquares( values, mask, count, 1.5 ), squares ), name + " masked sum of squares matches" );
+        Assert( ColumnKernels::MaskedMinimum( values, mask, count ) == minimum, name + " masked minimum matches" );
+        Assert( ColumnKernels::Maximum( values, count ) == maximum, name + " maximum matches" );
+        Assert( ColumnKernels::MaskedCountAbove( values, mask, count, 2.5 ) == above, name + " masked count above matches" );
+
+        double kernelSines = 0.0;
+        double kernelCosines = 0.0;
+        ColumnKernels::MaskedSumOfSinesAndCosines( values, mask, count, kernelSines, kernelCosines );
+        Assert( IsClose( kernelSines, sines ) && IsClose( kernelCosines, cosines ), name + " masked sums of sines and cosines match" );
+        cout << endl;
+    }
+    ColumnKernels::SetInstructionSet( supported );
+}
+
+void TestKeyMask()
+{
+    const unsigned count = 5;
+    unsigned keys[count] = { 7, 8, 7, 9, 7 };
+    unsigned char mask[count];
+
+    ColumnKernels::BuildKeyMask( keys, count, 7, mask );
+
+    cout << "Test on building a key mask" << endl;
+    Assert( mask[0] == 1 && mask[1] == 0 && mask[2] == 1 && mask[3] == 0 && mask[4] == 1, "Rows with key 7 are selected" );
+    cout << endl;
+}
+
+void TestSinesAndCosines()
+{
+    const unsigned count = 9;
+    float degrees[count] = { 0, 90, 180, 270, -90, 350, 10, 405, numeric_limits<float>::quiet_NaN() };
+    unsigned char mask[count] = { 0, 0, 0, 0, 0, 1, 1, 0, 0 };
+    double largestError = 0.0;
+    double sines = 0.0;
+    double cosines = 0.0;
+
+    for( float angle = -720; angle <= 720; angle += 0.25f )
+    {
+        float sine;
+        float cosine;
+        ColumnKernels::SineCosine( angle, sine, cosine );
+        largestError = max( largestError, max( fabs( sine - sin( angle * M_PI / 180 ) ), fabs( cosine - cos( angle * M_PI / 180 ) ) ) );
+    }
+
+    cout << "Test on sines and cosines of angles" << endl;
+    Assert( largestError < 1e-6, "Approximated sine and cosine are within 1e-6 over two turns each way" );
+    ColumnKernels::SumOfSinesAndCosines( degrees, count - 1, sines, cosines );
+    Assert( IsClose( sines, -1 + sin( M_PI / 4 ) ) && IsClose( cosines, 2 * cos( 10 * M_PI / 180 ) + cos( M_PI / 4 ) ),
+            "Quarter turns land on the axes" );
+    ColumnKernels::MaskedSumOfSinesAndCosines( degrees, mask, count, sines, cosines );
+    Assert( IsClose( sines, 0 ) && IsClose( cosines, 2 * cos( 10 * M_PI / 180 ) ), "350 and 10 degrees sum to north, skipping NaN" );
+
+    // Every instruction set skips missing readings in the vector lanes and in the scalar tail
+    const unsigned columnCount = 21;
+    float column[columnCount];
+    bool skipsMissing = true;
+    for( unsigned i(0); i < columnCount; i++ )
+    {
+        column[i] = ( i % 4 == 1 ) ? numeric_limits<float>::quiet_NaN() : ( i % 4 == 3 ) ? numeric_limits<float>::infinity() : 90;
+    }
+    for( unsigned instructionSet(0); instructionSet <= unsigned( ColumnKernels::InstructionSet::AVX2 ); instructionSet++ )
+    {
+        ColumnKernels::SetInstructionSet( ColumnKernels::InstructionSet( instructionSet ) );
+        ColumnKernels::SumOfSinesAndCosines( column, columnCount, sines, cosines );
+        skipsMissing = skipsMissing && IsClose( sines, 11 ) && IsClose( cosines, 0 );
+    }
+    ColumnKernels::SetInstructionSet( ColumnKernels::GetSupportedInstructionSet() );
+    Assert( skipsMissing, "Unmasked sums skip NaN and infinite angles" );
+    float sine = 0;
+    float cosine = 0;
+    ColumnKernels::SineCosine( numeric_limits<float>::quiet_NaN(), sine, cosine );
+    Assert( std::isnan( sine ) && std::isnan( cosine ), "Sine and cosine of NaN are NaN" );
+    cout << endl;
+}
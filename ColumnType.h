@@ -0,0 +1,13 @@
+#ifndef COLUMNTYPE_H_INCLUDED
+#define COLUMNTYPE_H_INCLUDED
+
+/**
+* @brief Type of the values of a column of a columnar file, as stored in its column directory.
+*/
+enum class ColumnType
+{
+    UINT32 = 1,     ///< 32 bit unsigned integers, such as packed timestamps.
+    FLOAT32 = 2     ///< 32 bit IEEE 754 floats, such as measurements.
+};
+
+#endif // COLUMNTYPE_H_INCLUDED
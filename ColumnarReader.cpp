@@ -0,0 +1,265 @@
+
+#include "ColumnarReader.h"
+
+#include<fstream>
+#include<sstream>
+#include<cstring>
+
+ColumnarReader::ColumnarReader()
+    : m_rowCount( 0 ), m_columnCount( 0 ), m_blockCount( 0 ) {}
+
+bool ColumnarReader::Open( const string &filePath )
+{
+    ifstream inputFile( filePath, ios::binary );
+    ostringstream contents;
+
+    m_contents.clear();
+    m_rowCount = 0;
+    m_columnCount = 0;
+    m_blockCount = 0;
+    if( !inputFile || !( contents << inputFile.rdbuf() ) )
+    {
+        return false;
+    }
+
+    string file = contents.str();
+    if( file.size() < ColumnarWriter::HEADER_SIZE
+            || memcmp( file.data(), ColumnarWriter::MAGIC, sizeof( ColumnarWriter::MAGIC ) ) != 0
+            || GetUnsigned( file.data() + 8 ) != ColumnarWriter::VERSION )
+    {
+        return false;
+    }
+
+    unsigned long long rows = GetUnsigned64( file.data() + 16 );
+    unsigned columns = GetUnsigned( file.data() + 12 );
+    unsigned blockRows = GetUnsigned( file.data() + 24 );
+    unsigned blocks = GetUnsigned( file.data() + 28 );
+    if( rows > ~0u || blockRows == 0 || blocks != ( rows + blockRows - 1 ) / blockRows )
+    {
+        return false;
+    }
+
+    // The tables are bounded by the file before their sizes are multiplied, so a corrupt count cannot overflow
+    unsigned long long tableSpace = file.size() - ColumnarWriter::HEADER_SIZE;
+    if( columns > tableSpace / ColumnarWriter::COLUMN_ENTRY_SIZE )
+    {
+        return false;
+    }
+    tableSpace -= (unsigned long long) columns * ColumnarWriter::COLUMN_ENTRY_SIZE;
+    if( columns > 0 && blocks > tableSpace / ( (unsigned long long) columns * ColumnarWriter::BLOCK_ENTRY_SIZE ) )
+    {
+        return false;
+    }
+
+    // Every block must lie inside the file and the blocks of a column must add up to its rows
+    m_contents.swap( file );
+    m_rowCount = unsigned( rows );
+    m_columnCount = columns;
+    m_blockCount = blocks;
+    for( unsigned column(0); column < m_columnCount; column++ )
+    {
+        unsigned type = GetUnsigned( m_contents.data() + ColumnarWriter::HEADER_SIZE + column * ColumnarWriter::COLUMN_ENTRY_SIZE + ColumnarWriter::MAXIMUM_NAME_LENGTH + 1 );
+        bool isValid = type == unsigned( ColumnType::UINT32 ) || type == unsigned( ColumnType::FLOAT32 );
+        unsigned long long columnRows = 0;
+        for( unsigned block(0); block < m_blockCount && isValid; block++ )
+        {
+            const char *entry = GetBlockEntry( column, block );
+            unsigned long long offset = GetUnsigned64( entry );
+            unsigned size = GetUnsigned( entry + 12 );
+            unsigned encoding = GetUnsigned( entry + 16 );
+            columnRows += GetUnsigned( entry + 8 );
+            isValid = offset <= m_contents.size()
+                      && size <= m_contents.size() - offset
+                      && encoding <= unsigned( ColumnEncoding::RUN_LENGTH );
+        }
+        if( !isValid || columnRows != m_rowCount )
+        {
+            m_contents.clear();
+            m_rowCount = 0;
+            m_columnCount = 0;
+            m_blockCount = 0;
+            return false;
+        }
+    }
+    return true;
+}
+
+unsigned ColumnarReader::GetRowCount() const
+{
+    return m_rowCount;
+}
+
+unsigned ColumnarReader::GetColumnCount() const
+{
+    return m_columnCount;
+}
+
+unsigned ColumnarReader::GetBlockCount() const
+{
+    return m_blockCount;
+}
+
+string ColumnarReader::GetColumnName( const unsigned &column ) const
+{
+    const char *name = m_contents.data() + ColumnarWriter::HEADER_SIZE + column * ColumnarWriter::COLUMN_ENTRY_SIZE;
+
+    return string( name, strnlen( name, ColumnarWriter::MAXIMUM_NAME_LENGTH + 1 ) );
+}
+
+ColumnType ColumnarReader::GetColumnType( const unsigned &column ) const
+{
+    return ColumnType( GetUnsigned( m_contents.data() + ColumnarWriter::HEADER_SIZE + column * ColumnarWriter::COLUMN_ENTRY_SIZE + ColumnarWriter::MAXIMUM_NAME_LENGTH + 1 ) );
+}
+
+bool ColumnarReader::FindColumn( const string &name, unsigned &column ) const
+{
+    for( unsigned index(0); index < m_columnCount; index++ )
+    {
+        if( GetColumnName( index ) == name )
+        {
+            column = index;
+            return true;
+        }
+    }
+    return false;
+}
+
+ColumnEncoding ColumnarReader::GetBlockEncoding( const unsigned &column, const unsigned &block ) const
+{
+    return ColumnEncoding( GetUnsigned( GetBlockEntry( column, block ) + 16 ) );
+}
+
+double ColumnarReader::GetBlockMinimum( const unsigned &column, const unsigned &block ) const
+{
+    return ToValue( column, GetUnsigned( GetBlockEntry( column, block ) + 24 ) );
+}
+
+double ColumnarReader::GetBlockMaximum( const unsigned &column, const unsigned &block ) const
+{
+    return ToValue( column, GetUnsigned( GetBlockEntry( column, block ) + 28 ) );
+}
+
+bool ColumnarReader::ReadColumn( const unsigned &column, Vector<unsigned> &values ) const
+{
+    return GetColumnType( column ) == ColumnType::UINT32 && ReadBits( column, values );
+}
+
+bool ColumnarReader::ReadColumn( const unsigned &column, Vector<float> &values ) const
+{
+    Vector<unsigned> bits;
+
+    values.SetSize( 0 );
+    if( GetColumnType( column ) != ColumnType::FLOAT32 || !ReadBits( column, bits ) )
+    {
+        return false;
+    }
+    values.SetSize( bits.GetUsed() );
+    if( bits.GetUsed() > 0 )
+    {
+        memcpy( values.Start(), bits.Start(), bits.GetUsed() * sizeof( float ) );
+    }
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+bool ColumnarReader::ReadBits( const unsigned &column, Vector<unsigned> &bits ) const
+{
+    bits.SetSize( 0 );
+    for( unsigned block(0); block < m_blockCount; block++ )
+    {
+        const char *entry = GetBlockEntry( column, block );
+        const char *data = m_contents.data() + GetUnsigned64( entry );
+        unsigned rows = GetUnsigned( entry + 8 );
+        unsigned size = GetUnsigned( entry + 12 );
+        unsigned width = GetUnsigned( entry + 20 );
+        unsigned first = bits.GetUsed();
+
+        switch( ColumnEncoding( GetUnsigned( entry + 16 ) ) )
+        {
+        case ColumnEncoding::DELTA:
+        {
+            if( rows == 0 || ( width != 1 && width != 2 && width != 4 ) || size != 4 + ( rows - 1 ) * width )
+            {
+                return false;
+            }
+            unsigned value = GetUnsigned( data );
+            bits.InsertLast( value );
+            for( const char *next = data + 4; next < data + size; next += width )
+            {
+                unsigned increase = 0;
+                for( unsigned byte(0); byte < width; byte++ )
+                {
+                    increase |= unsigned( (unsigned char) next[byte] ) << ( 8 * byte );
+                }
+                value += increase;
+                bits.InsertLast( value );
+            }
+            break;
+        }
+        case ColumnEncoding::RUN_LENGTH:
+            for( const char *next = data; next + 8 <= data + size; next += 8 )
+            {
+                unsigned run = GetUnsigned( next );
+                unsigned value = GetUnsigned( next + 4 );
+                if( run > rows - ( bits.GetUsed() - first ) )
+                {
+                    return false;
+                }
+                for( unsigned repeat(0); repeat < run; repeat++ )
+                {
+                    bits.InsertLast( value );
+                }
+            }
+            break;
+        case ColumnEncoding::PLAIN:
+        default:
+            for( const char *next = data; next + 4 <= data + size; next += 4 )
+            {
+                bits.InsertLast( GetUnsigned( next ) );
+            }
+            break;
+        }
+
+        if( bits.GetUsed() - first != rows )
+        {
+            return false;
+        }
+    }
+    return true;
+}
+
+const char *ColumnarReader::GetBlockEntry( const unsigned &column, const unsigned &block ) const
+{
+    return m_contents.data() + ColumnarWriter::HEADER_SIZE
+           + m_columnCount * ColumnarWriter::COLUMN_ENTRY_SIZE
+           + ( (size_t) column * m_blockCount + block ) * ColumnarWriter::BLOCK_ENTRY_SIZE;
+}
+
+double ColumnarReader::ToValue( const unsigned &column, const unsigned &bits ) const
+{
+    if( GetColumnType( column ) == ColumnType::UINT32 )
+    {
+        return bits;
+    }
+
+    float value;
+    memcpy( &value, &bits, sizeof( value ) );
+    return value;
+}
+
+unsigned ColumnarReader::GetUnsigned( const char *bytes )
+{
+    unsigned value = 0;
+
+    for( unsigned byte(0); byte < 4; byte++ )
+    {
+        value |= unsigned( (unsigned char) bytes[byte] ) << ( 8 * byte );
+    }
+    return value;
+}
+
+unsigned long long ColumnarReader::GetUnsigned64( const char *bytes )
+{
+    return GetUnsigned( bytes ) | ( (unsigned long long) GetUnsigned( bytes + 4 ) << 32 );
+}
@@ -0,0 +1,182 @@
+/**
+ * @file ColumnarReader.h
+ * @brief Defines the ColumnarReader class, which reads back the columnar binary files of the ColumnarWriter.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef COLUMNARREADER_H_INCLUDED
+#define COLUMNARREADER_H_INCLUDED
+
+#include<string>
+
+#include "ColumnarWriter.h"
+
+using namespace std;
+
+/**
+* @brief Reads a columnar file written by the ColumnarWriter, checking its layout before any column is decoded.
+*
+* The whole file is read into memory once. Open() checks the magic, the version and that every
+* table and block lies inside the file, so the getters and ReadColumn() never read past its end.
+*/
+class ColumnarReader
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates a reader without an open file.
+    */
+    ColumnarReader();
+
+    /**
+    * @brief Reads a columnar file and checks its layout.
+    *
+    * @param[in] filePath The path of the file.
+    * @return false if the file could not be read or is not a valid columnar file, true otherwise.
+    */
+    bool Open( const string &filePath );
+
+    /**
+    * @brief Getter for the number of rows of every column.
+    *
+    * @return The number of rows.
+    */
+    unsigned GetRowCount() const;
+
+    /**
+    * @brief Getter for the number of columns.
+    *
+    * @return The number of columns.
+    */
+    unsigned GetColumnCount() const;
+
+    /**
+    * @brief Getter for the number of blocks of every column.
+    *
+    * @return The number of blocks.
+    */
+    unsigned GetBlockCount() const;
+
+    /**
+    * @brief Getter for the name of a column.
+    *
+    * @param[in] column The index of the column.
+    * @return The name of the column.
+    */
+    string GetColumnName( const unsigned &column ) const;
+
+    /**
+    * @brief Getter for the type of the values of a column.
+    *
+    * @param[in] column The index of the column.
+    * @return The type of the values.
+    */
+    ColumnType GetColumnType( const unsigned &column ) const;
+
+    /**
+    * @brief Finds a column by its name.
+    *
+    * @param[in] name The name of the column.
+    * @param[out] column The index of the column.
+    * @return false if no column has the name, true otherwise.
+    */
+    bool FindColumn( const string &name, unsigned &column ) const;
+
+    /**
+    * @brief Getter for the encoding of a block.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] block The index of the block.
+    * @return The encoding of the block.
+    */
+    ColumnEncoding GetBlockEncoding( const unsigned &column, const unsigned &block ) const;
+
+    /**
+    * @brief Getter for the smallest value of a block, from the block table.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] block The index of the block.
+    * @return The smallest value, converted from the type of the column.
+    */
+    double GetBlockMinimum( const unsigned &column, const unsigned &block ) const;
+
+    /**
+    * @brief Getter for the largest value of a block, from the block table.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] block The index of the block.
+    * @return The largest value, converted from the type of the column.
+    */
+    double GetBlockMaximum( const unsigned &column, const unsigned &block ) const;
+
+    /**
+    * @brief Decodes an UINT32 column.
+    *
+    * @param[in] column The index of the column.
+    * @param[out] values The values of the column, replacing its contents.
+    * @return false if the column is not UINT32 or a block does not decode to its row count, true otherwise.
+    */
+    bool ReadColumn( const unsigned &column, Vector<unsigned> &values ) const;
+
+    /**
+    * @brief Decodes a FLOAT32 column.
+    *
+    * @param[in] column The index of the column.
+    * @param[out] values The values of the column, replacing its contents.
+    * @return false if the column is not FLOAT32 or a block does not decode to its row count, true otherwise.
+    */
+    bool ReadColumn( const unsigned &column, Vector<float> &values ) const;
+
+private:
+    string m_contents;          ///< Contents of the file.
+    unsigned m_rowCount;        ///< Number of rows of every column.
+    unsigned m_columnCount;     ///< Number of columns.
+    unsigned m_blockCount;      ///< Number of blocks of every column.
+
+    /**
+    * @brief Decodes the raw 32 bit values of a column.
+    *
+    * @param[in] column The index of the column.
+    * @param[out] bits The raw values, replacing its contents.
+    * @return false if a block does not decode to its row count, true otherwise.
+    */
+    bool ReadBits( const unsigned &column, Vector<unsigned> &bits ) const;
+
+    /**
+    * @brief Finds the block table entry of a block.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] block The index of the block.
+    * @return Pointer to the first byte of the entry.
+    */
+    const char *GetBlockEntry( const unsigned &column, const unsigned &block ) const;
+
+    /**
+    * @brief Converts a raw 32 bit value of a column to a number.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] bits The raw value.
+    * @return The value, as an unsigned number or a float depending on the column type.
+    */
+    double ToValue( const unsigned &column, const unsigned &bits ) const;
+
+    /**
+    * @brief Reads a little endian 32 bit number.
+    *
+    * @param[in] bytes Pointer to the first byte.
+    * @return The number.
+    */
+    static unsigned GetUnsigned( const char *bytes );
+
+    /**
+    * @brief Reads a little endian 64 bit number.
+    *
+    * @param[in] bytes Pointer to the first byte.
+    * @return The number.
+    */
+    static unsigned long long GetUnsigned64( const char *bytes );
+};
+
+#endif // COLUMNARREADER_H_INCLUDED
@@ -0,0 +1,116 @@
+#include<iostream>
+#include<fstream>
+#include<sstream>
+#include<cstdio>
+
+#include "ColumnarReader.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+string ReadFile( const string &filePath );
+void WriteFile( const string &filePath, const string &contents );
+void TestRead();
+void TestInvalidFiles();
+
+int main()
+{
+    TestRead();
+    TestInvalidFiles();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+string ReadFile( const string &filePath )
+{
+    ifstream inputFile( filePath, ios::binary );
+    ostringstream contents;
+
+    contents << inputFile.rdbuf();
+    return contents.str();
+}
+
+void WriteFile( const string &filePath, const string &contents )
+{
+    ofstream outputFile( filePath, ios::binary );
+
+    outputFile << contents;
+}
+
+void TestRead()
+{
+    ColumnarWriter columnarWriter( 4 );
+    ColumnarReader columnarReader;
+    unsigned count = columnarWriter.AddColumn( "Count", ColumnType::UINT32 );
+    unsigned level = columnarWriter.AddColumn( "Level", ColumnType::FLOAT32 );
+    Vector<unsigned> counts;
+    Vector<float> levels;
+    unsigned column = 0;
+
+    for( unsigned row(0); row < 10; row++ )
+    {
+        columnarWriter.Append( count, 1000 - row * 300 % 7 );
+        columnarWriter.Append( level, row < 8 ? 0.0f : 2.5f );
+    }
+    columnarWriter.Write( "ColumnarReaderTest.col" );
+    bool isOpen = columnarReader.Open( "ColumnarReaderTest.col" );
+    remove( "ColumnarReaderTest.col" );
+
+    cout << "Test on reading" << endl;
+    Assert( isOpen && columnarReader.GetColumnCount() == 2 && columnarReader.GetRowCount() == 10 && columnarReader.GetBlockCount() == 3, "Header is read" );
+    Assert( columnarReader.GetColumnName( 1 ) == "Level" && columnarReader.GetColumnType( 1 ) == ColumnType::FLOAT32, "Column directory is read" );
+    Assert( columnarReader.FindColumn( "Count", column ) && column == 0 && !columnarReader.FindColumn( "Missing", column ), "Columns are found by name" );
+    Assert( columnarReader.GetBlockEncoding( 1, 0 ) == ColumnEncoding::RUN_LENGTH && columnarReader.GetBlockEncoding( 0, 0 ) == ColumnEncoding::PLAIN, "Runs of a value are run length encoded" );
+    Assert( columnarReader.ReadColumn( 0, counts ) && counts.GetUsed() == 10 && counts[9] == 1000 - 2700 % 7, "Unsigned column reads back" );
+    Assert( columnarReader.ReadColumn( 1, levels ) && levels.GetUsed() == 10 && levels[7] == 0.0f && levels[8] == 2.5f, "Float column reads back" );
+    Assert( !columnarReader.ReadColumn( 0, levels ) && !columnarReader.ReadColumn( 1, counts ), "Columns are only read as their own type" );
+    Assert( columnarReader.GetBlockMinimum( 0, 2 ) == 1000 - 2400 % 7 && columnarReader.GetBlockMaximum( 1, 2 ) == 2.5, "Block statistics are converted from the column type" );
+    cout << endl;
+}
+
+void TestInvalidFiles()
+{
+    ColumnarWriter columnarWriter( 4 );
+    ColumnarReader columnarReader;
+    unsigned count = columnarWriter.AddColumn( "Count", ColumnType::UINT32 );
+
+    for( unsigned row(0); row < 10; row++ )
+    {
+        columnarWriter.Append( count, row );
+    }
+    columnarWriter.Write( "ColumnarReaderTest.col" );
+    string contents = ReadFile( "ColumnarReaderTest.col" );
+
+    cout << "Test on invalid files" << endl;
+    Assert( !columnarReader.Open( "missing_directory/file.col" ), "Missing file is rejected" );
+    WriteFile( "ColumnarReaderTest.col", "WTSCOLS" );
+    Assert( !columnarReader.Open( "ColumnarReaderTest.col" ) && columnarReader.GetColumnCount() == 0, "Short file is rejected" );
+    WriteFile( "ColumnarReaderTest.col", "X" + contents.substr( 1 ) );
+    Assert( !columnarReader.Open( "ColumnarReaderTest.col" ), "Wrong magic is rejected" );
+    WriteFile( "ColumnarReaderTest.col", contents.substr( 0, contents.size() - 8 ) );
+    Assert( !columnarReader.Open( "ColumnarReaderTest.col" ), "Truncated block is rejected" );
+    WriteFile( "ColumnarReaderTest.col", contents.substr( 0, 12 ) + string( 4, '\xff' ) + contents.substr( 16 ) );
+    Assert( !columnarReader.Open( "ColumnarReaderTest.col" ), "Column count past the end of the file is rejected" );
+
+    // The first block offset is set to wrap around when its size is added
+    string wrapping = contents;
+    wrapping.replace( ColumnarWriter::HEADER_SIZE + ColumnarWriter::COLUMN_ENTRY_SIZE, 8, string( 8, '\xff' ) );
+    WriteFile( "ColumnarReaderTest.col", wrapping );
+    Assert( !columnarReader.Open( "ColumnarReaderTest.col" ), "Block offset that wraps around is rejected" );
+    WriteFile( "ColumnarReaderTest.col", contents );
+    Assert( columnarReader.Open( "ColumnarReaderTest.col" ), "Intact file is accepted" );
+    remove( "ColumnarReaderTest.col" );
+    cout << endl;
+}
@@ -0,0 +1,360 @@
+
+#include "ColumnarWriter.h"
+
+#include<algorithm>
+#include<cstdio>
+#include<cstring>
+
+#include "Timestamp.h"
+
+const char ColumnarWriter::MAGIC[8] = { 'W', 'T', 'S', 'C', 'O', 'L', 'S', '\0' };
+const unsigned ColumnarWriter::VERSION;
+const unsigned ColumnarWriter::HEADER_SIZE;
+const unsigned ColumnarWriter::COLUMN_ENTRY_SIZE;
+const unsigned ColumnarWriter::BLOCK_ENTRY_SIZE;
+const unsigned ColumnarWriter::MAXIMUM_NAME_LENGTH;
+const unsigned ColumnarWriter::BLOCK_ALIGNMENT;
+const unsigned ColumnarWriter::DEFAULT_BLOCK_ROWS;
+
+const string ColumnarWriter::TIMESTAMP_COLUMN = "Timestamp";
+const string ColumnarWriter::WINDSPEED_COLUMN = "S";
+const string ColumnarWriter::SOLARRADIATION_COLUMN = "SR";
+const string ColumnarWriter::TEMPERATURE_COLUMN = "T";
+
+ColumnarWriter::ColumnarWriter( const unsigned &blockRows, const bool &isCompressed )
+    : m_blockRows( blockRows > 0 ? blockRows : DEFAULT_BLOCK_ROWS ), m_isCompressed( isCompressed ) {}
+
+unsigned ColumnarWriter::AddColumn( const string &name, ColumnType columnType )
+{
+    if( name.size() > MAXIMUM_NAME_LENGTH )
+    {
+        return GetColumnCount();
+    }
+    for( unsigned column(0); column < m_columns.GetUsed(); column++ )
+    {
+        if( m_columns[column].name == name )
+        {
+            return GetColumnCount();
+        }
+    }
+
+    Column added;
+    added.name = name;
+    added.type = columnType;
+    m_columns.InsertLast( added );
+    return m_columns.GetUsed() - 1;
+}
+
+void ColumnarWriter::Append( const unsigned &column, const unsigned &value )
+{
+    m_columns[column].bits.InsertLast( value );
+}
+
+void ColumnarWriter::Append( const unsigned &column, const float &value )
+{
+    m_columns[column].bits.InsertLast( ToBits( value ) );
+}
+
+void ColumnarWriter::AddRecords( const Vector<WindRecType> &windRecLog )
+{
+    unsigned timestamp = AddColumn( TIMESTAMP_COLUMN, ColumnType::UINT32 );
+    unsigned windSpeed = AddColumn( WINDSPEED_COLUMN, ColumnType::FLOAT32 );
+    unsigned solarRadiation = AddColumn( SOLARRADIATION_COLUMN, ColumnType::FLOAT32 );
+    unsigned temperature = AddColumn( TEMPERATURE_COLUMN, ColumnType::FLOAT32 );
+
+    for( unsigned record(0); record < windRecLog.GetUsed(); record++ )
+    {
+        const WindRecType &windRecType = windRecLog[record];
+        Append( timestamp, Timestamp::Pack( windRecType.GetRecordDate(), windRecType.GetRecordTime() ) );
+        Append( windSpeed, windRecType.GetRecordWindSpeed().GetMeasurement() );
+        Append( solarRadiation, windRecType.GetRecordSolarRadiation().GetMeasurement() );
+        Append( temperature, windRecType.GetRecordTemperature().GetMeasurement() );
+    }
+}
+
+bool ColumnarWriter::AddSensors( const SensorRegistry &sensorRegistry )
+{
+    unsigned rows = sensorRegistry.GetRowCount();
+
+    if( GetColumnCount() > 0 && rows != GetRowCount() )
+    {
+        return false;
+    }
+
+    for( unsigned sensor(0); sensor < sensorRegistry.GetSensorCount(); sensor++ )
+    {
+        unsigned column = AddColumn( sensorRegistry.GetCode( sensor ), ColumnType::FLOAT32 );
+        if( column == GetColumnCount() )
+        {
+            continue;
+        }
+
+        const float *values = sensorRegistry.GetColumn( sensor );
+        m_columns[column].bits.SetSize( rows );
+        for( unsigned row(0); row < rows; row++ )
+        {
+            m_columns[column].bits[row] = ToBits( values[row] );
+        }
+    }
+    return true;
+}
+
+unsigned ColumnarWriter::GetColumnCount() const
+{
+    return m_columns.GetUsed();
+}
+
+unsigned ColumnarWriter::GetRowCount() const
+{
+    return m_columns.IsEmpty() ? 0 : m_columns[0].bits.GetUsed();
+}
+
+bool ColumnarWriter::Write( const string &filePath ) const
+{
+    const unsigned rows = GetRowCount();
+    const unsigned blocks = ( rows + m_blockRows - 1 ) / m_blockRows;
+    const unsigned columns = GetColumnCount();
+
+    for( unsigned column(0); column < columns; column++ )
+    {
+        if( m_columns[column].bits.GetUsed() != rows )
+        {
+            return false;
+        }
+    }
+
+    // Plan every block first, so the block table can be written ahead of the blocks
+    Vector<BlockEntry> entries;
+    unsigned long long offset = HEADER_SIZE + (unsigned long long) columns * ( COLUMN_ENTRY_SIZE + blocks * BLOCK_ENTRY_SIZE );
+    for( unsigned column(0); column < columns; column++ )
+    {
+        for( unsigned block(0); block < blocks; block++ )
+        {
+            unsigned first = block * m_blockRows;
+            BlockEntry entry = PlanBlock( m_columns[column], first, min( m_blockRows, rows - first ) );
+            offset = ( offset + BLOCK_ALIGNMENT - 1 ) / BLOCK_ALIGNMENT * BLOCK_ALIGNMENT;
+            entry.offset = offset;
+            offset += entry.size;
+            entries.InsertLast( entry );
+        }
+    }
+
+    string buffer;
+    buffer.append( MAGIC, sizeof( MAGIC ) );
+    PutUnsigned( buffer, VERSION );
+    PutUnsigned( buffer, columns );
+    PutUnsigned64( buffer, rows );
+    PutUnsigned( buffer, m_blockRows );
+    PutUnsigned( buffer, blocks );
+    for( unsigned column(0); column < columns; column++ )
+    {
+        buffer.append( m_columns[column].name );
+        buffer.append( MAXIMUM_NAME_LENGTH + 1 - m_columns[column].name.size(), '\0' );
+        PutUnsigned( buffer, unsigned( m_columns[column].type ) );
+        PutUnsigned( buffer, 0 );
+    }
+    for( unsigned entry(0); entry < entries.GetUsed(); entry++ )
+    {
+        PutUnsigned64( buffer, entries[entry].offset );
+        PutUnsigned( buffer, entries[entry].rows );
+        PutUnsigned( buffer, entries[entry].size );
+        PutUnsigned( buffer, unsigned( entries[entry].encoding ) );
+        PutUnsigned( buffer, entries[entry].width );
+        PutUnsigned( buffer, entries[entry].minimum );
+        PutUnsigned( buffer, entries[entry].maximum );
+    }
+
+    string writePath = filePath + ".tmp";
+    FILE *file = fopen( writePath.c_str(), "wb" );
+    if( file == nullptr )
+    {
+        return false;
+    }
+
+    // Blocks are encoded one at a time into the reused buffer, so only one block is held in memory
+    bool isWritten = fwrite( buffer.data(), 1, buffer.size(), file ) == buffer.size();
+    unsigned long long written = buffer.size();
+    for( unsigned column(0); column < columns && isWritten; column++ )
+    {
+        for( unsigned block(0); block < blocks && isWritten; block++ )
+        {
+            const BlockEntry &entry = entries[column * blocks + block];
+            buffer.assign( size_t( entry.offset - written ), '\0' );
+            EncodeBlock( m_columns[column], block * m_blockRows, entry, buffer );
+            isWritten = fwrite( buffer.data(), 1, buffer.size(), file ) == buffer.size();
+            written += buffer.size();
+        }
+    }
+    isWritten = ( fclose( file ) == 0 ) && isWritten;
+
+    if( !isWritten )
+    {
+        remove( writePath.c_str() );
+        return false;
+    }
+
+    // POSIX rename replaces the file atomically. Where it cannot replace an existing file, remove it first.
+    if( rename( writePath.c_str(), filePath.c_str() ) != 0 )
+    {
+        remove( filePath.c_str() );
+        if( rename( writePath.c_str(), filePath.c_str() ) != 0 )
+        {
+            remove( writePath.c_str() );
+            return false;
+        }
+    }
+    return true;
+}
+
+bool ColumnarWriter::Export( const Vector<WindRecType> &windRecLog, const string &filePath, const bool &isCompressed, const SensorRegistry *sensorRegistry )
+{
+    ColumnarWriter columnarWriter( DEFAULT_BLOCK_ROWS, isCompressed );
+
+    columnarWriter.AddRecords( windRecLog );
+    if( sensorRegistry != nullptr && !columnarWriter.AddSensors( *sensorRegistry ) )
+    {
+        return false;
+    }
+    return columnarWriter.Write( filePath );
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+ColumnarWriter::BlockEntry ColumnarWriter::PlanBlock( const Column &column, const unsigned &first, const unsigned &rows ) const
+{
+    const unsigned *bits = column.bits.Start() + first;
+    BlockEntry entry;
+    unsigned runs = 1;
+    unsigned largestIncrease = 0;
+    bool isAscending = true;
+
+    entry.offset = 0;
+    entry.rows = rows;
+    entry.minimum = bits[0];
+    entry.maximum = bits[0];
+    for( unsigned row(1); row < rows; row++ )
+    {
+        if( bits[row] != bits[row - 1] )
+        {
+            runs++;
+        }
+        if( column.type == ColumnType::UINT32 )
+        {
+            entry.minimum = min( entry.minimum, bits[row] );
+            entry.maximum = max( entry.maximum, bits[row] );
+            isAscending = isAscending && bits[row] >= bits[row - 1];
+            largestIncrease = isAscending ? max( largestIncrease, bits[row] - bits[row - 1] ) : largestIncrease;
+        }
+        else
+        {
+            // NaN never compares, so it does not widen the statistics
+            if( FromBits( bits[row] ) < FromBits( entry.minimum ) || FromBits( entry.minimum ) != FromBits( entry.minimum ) )
+            {
+                entry.minimum = bits[row];
+            }
+            if( FromBits( bits[row] ) > FromBits( entry.maximum ) || FromBits( entry.maximum ) != FromBits( entry.maximum ) )
+            {
+                entry.maximum = bits[row];
+            }
+        }
+    }
+
+    entry.encoding = ColumnEncoding::PLAIN;
+    entry.width = 4;
+    entry.size = rows * 4;
+    if( !m_isCompressed )
+    {
+        return entry;
+    }
+
+    if( column.type == ColumnType::UINT32 && isAscending )
+    {
+        unsigned width = largestIncrease <= 0xFF ? 1 : ( largestIncrease <= 0xFFFF ? 2 : 4 );
+        unsigned size = 4 + ( rows - 1 ) * width;
+        if( size < entry.size )
+        {
+            entry.encoding = ColumnEncoding::DELTA;
+            entry.width = width;
+            entry.size = size;
+        }
+    }
+    if( runs * 8 < entry.size )
+    {
+        entry.encoding = ColumnEncoding::RUN_LENGTH;
+        entry.width = 4;
+        entry.size = runs * 8;
+    }
+    return entry;
+}
+
+void ColumnarWriter::EncodeBlock( const Column &column, const unsigned &first, const BlockEntry &entry, string &buffer )
+{
+    const unsigned *bits = column.bits.Start() + first;
+
+    switch( entry.encoding )
+    {
+    case ColumnEncoding::DELTA:
+        PutUnsigned( buffer, bits[0] );
+        for( unsigned row(1); row < entry.rows; row++ )
+        {
+            unsigned increase = bits[row] - bits[row - 1];
+            for( unsigned byte(0); byte < entry.width; byte++ )
+            {
+                buffer.push_back( char( ( increase >> ( 8 * byte ) ) & 0xFF ) );
+            }
+        }
+        break;
+    case ColumnEncoding::RUN_LENGTH:
+        for( unsigned row(0); row < entry.rows; )
+        {
+            unsigned run = 1;
+            while( row + run < entry.rows && bits[row + run] == bits[row] )
+            {
+                run++;
+            }
+            PutUnsigned( buffer, run );
+            PutUnsigned( buffer, bits[row] );
+            row += run;
+        }
+        break;
+    case ColumnEncoding::PLAIN:
+    default:
+        for( unsigned row(0); row < entry.rows; row++ )
+        {
+            PutUnsigned( buffer, bits[row] );
+        }
+        break;
+    }
+}
+
+void ColumnarWriter::PutUnsigned( string &buffer, const unsigned &value )
+{
+    for( unsigned byte(0); byte < 4; byte++ )
+    {
+        buffer.push_back( char( ( value >> ( 8 * byte ) ) & 0xFF ) );
+    }
+}
+
+void ColumnarWriter::PutUnsigned64( string &buffer, const unsigned long long &value )
+{
+    for( unsigned byte(0); byte < 8; byte++ )
+    {
+        buffer.push_back( char( ( value >> ( 8 * byte ) ) & 0xFF ) );
+    }
+}
+
+unsigned ColumnarWriter::ToBits( const float &value )
+{
+    unsigned bits;
+
+    memcpy( &bits, &value, sizeof( bits ) );
+    return bits;
+}
+
+float ColumnarWriter::FromBits( const unsigned &bits )
+{
+    float value;
+
+    memcpy( &value, &bits, sizeof( value ) );
+    return value;
+}
@@ -0,0 +1,220 @@
+/**
+ * @file ColumnarWriter.h
+ * @brief Defines the ColumnarWriter class, which exports the dataset to a little endian columnar binary file.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef COLUMNARWRITER_H_INCLUDED
+#define COLUMNARWRITER_H_INCLUDED
+
+#include<string>
+
+#include "Vector.h"
+#include "WindRecType.h"
+#include "ColumnType.h"
+#include "ColumnEncoding.h"
+#include "SensorRegistry.h"
+
+using namespace std;
+
+/**
+* @brief Writes named columns of 32 bit values to a self describing columnar file.
+*
+* Every number of the file is little endian. The file is laid out as:
+*
+*   header           magic "WTSCOLS\0", version, column count, row count (64 bit), rows per block, block count
+*   column directory one 32 byte entry per column: NUL padded name of up to 23 characters, ColumnType, reserved
+*   block table      one 32 byte entry per block of each column, column by column: offset (64 bit),
+*                    row count, byte size, ColumnEncoding, delta width, minimum and maximum as raw 32 bit values
+*   blocks           the values of each block, each block starting on an 8 byte boundary
+*
+* Each column is cut into blocks of the same number of rows, and the block table records the
+* minimum and maximum of every block, so a reader can skip blocks without decoding them. With
+* compression, each block is written in the smallest of its PLAIN, DELTA and RUN_LENGTH encodings,
+* favouring PLAIN on ties; without it every block is PLAIN, and a mapped file can be read in place.
+* The file is written next to its path and renamed over it, so a reader never maps half a file.
+*/
+class ColumnarWriter
+{
+public:
+    static const char MAGIC[8];                         ///< First bytes of every columnar file.
+    static const unsigned VERSION = 1;                  ///< Version of the layout written.
+    static const unsigned HEADER_SIZE = 32;             ///< Size of the header, in bytes.
+    static const unsigned COLUMN_ENTRY_SIZE = 32;       ///< Size of a column directory entry, in bytes.
+    static const unsigned BLOCK_ENTRY_SIZE = 32;        ///< Size of a block table entry, in bytes.
+    static const unsigned MAXIMUM_NAME_LENGTH = 23;     ///< Longest column name, leaving room for its terminator.
+    static const unsigned BLOCK_ALIGNMENT = 8;          ///< Alignment of the blocks, in bytes.
+    static const unsigned DEFAULT_BLOCK_ROWS = 65536;   ///< Default number of rows in a block.
+
+    static const string TIMESTAMP_COLUMN;               ///< Name of the packed timestamp column of the dataset.
+    static const string WINDSPEED_COLUMN;               ///< Name of the wind speed column of the dataset.
+    static const string SOLARRADIATION_COLUMN;          ///< Name of the solar radiation column of the dataset.
+    static const string TEMPERATURE_COLUMN;             ///< Name of the ambient air temperature column of the dataset.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] blockRows The number of rows in a block, at least 1.
+    * @param[in] isCompressed Whether blocks may be DELTA or RUN_LENGTH encoded.
+    */
+    ColumnarWriter( const unsigned &blockRows = DEFAULT_BLOCK_ROWS, const bool &isCompressed = true );
+
+    /**
+    * @brief Adds an empty column.
+    *
+    * @param[in] name The name of the column, at most MAXIMUM_NAME_LENGTH characters.
+    * @param[in] columnType The type of the values.
+    * @return The index of the column, or GetColumnCount() if the name is too long or already used.
+    */
+    unsigned AddColumn( const string &name, ColumnType columnType );
+
+    /**
+    * @brief Appends a value to an UINT32 column.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] value The value.
+    */
+    void Append( const unsigned &column, const unsigned &value );
+
+    /**
+    * @brief Appends a value to a FLOAT32 column.
+    *
+    * @param[in] column The index of the column.
+    * @param[in] value The value.
+    */
+    void Append( const unsigned &column, const float &value );
+
+    /**
+    * @brief Adds the timestamp, wind speed, solar radiation and temperature columns of wind records.
+    *
+    * @param[in] windRecLog The loaded and validated wind records, written in their order.
+    * @pre None of the four columns was added yet.
+    */
+    void AddRecords( const Vector<WindRecType> &windRecLog );
+
+    /**
+    * @brief Adds a FLOAT32 column for every sensor of a registry that has no column of its code yet.
+    *
+    * Missing readings are written as NaN. Codes longer than MAXIMUM_NAME_LENGTH are left out.
+    *
+    * @param[in] sensorRegistry The sensor columns, row aligned with the columns already added.
+    * @return false, adding nothing, if the registry has another number of rows than the columns, true otherwise.
+    */
+    bool AddSensors( const SensorRegistry &sensorRegistry );
+
+    /**
+    * @brief Getter for the number of columns.
+    *
+    * @return The number of columns.
+    */
+    unsigned GetColumnCount() const;
+
+    /**
+    * @brief Getter for the number of rows.
+    *
+    * @return The number of values of the first column, or 0 without columns.
+    */
+    unsigned GetRowCount() const;
+
+    /**
+    * @brief Writes the columns to a file.
+    *
+    * @param[in] filePath The path of the file.
+    * @return false if the columns differ in length or the file could not be written, true otherwise.
+    */
+    bool Write( const string &filePath ) const;
+
+    /**
+    * @brief Writes the timestamp, wind speed, solar radiation and temperature of wind records to a file.
+    *
+    * @param[in] windRecLog The loaded and validated wind records.
+    * @param[in] filePath The path of the file.
+    * @param[in] isCompressed Whether blocks may be DELTA or RUN_LENGTH encoded.
+    * @param[in] sensorRegistry The other sensor columns of the records, or null to write only the four columns.
+    * @return false if the file could not be written, true otherwise.
+    */
+    static bool Export( const Vector<WindRecType> &windRecLog, const string &filePath, const bool &isCompressed = true, const SensorRegistry *sensorRegistry = nullptr );
+
+private:
+    /**
+    * @brief A named column, its values kept as raw 32 bit words whatever their type.
+    */
+    struct Column
+    {
+        string name;            ///< Name of the column.
+        ColumnType type;        ///< Type of the values.
+        Vector<unsigned> bits;  ///< Raw 32 bit value of each row.
+    };
+
+    /**
+    * @brief The block table entry of a block, worked out before the block is encoded.
+    */
+    struct BlockEntry
+    {
+        unsigned long long offset;  ///< Offset of the block from the start of the file.
+        unsigned rows;              ///< Number of rows in the block.
+        unsigned size;              ///< Size of the encoded block, in bytes.
+        ColumnEncoding encoding;    ///< Encoding of the block.
+        unsigned width;             ///< Bytes per increase of a DELTA block, 4 otherwise.
+        unsigned minimum;           ///< Raw 32 bit smallest value of the block.
+        unsigned maximum;           ///< Raw 32 bit largest value of the block.
+    };
+
+    Vector<Column> m_columns;       ///< Columns, in the order they were added.
+    unsigned m_blockRows;           ///< Number of rows in a block.
+    bool m_isCompressed;            ///< Whether blocks may be DELTA or RUN_LENGTH encoded.
+
+    /**
+    * @brief Works out the statistics, encoding and size of a block.
+    *
+    * @param[in] column The column.
+    * @param[in] first The first row of the block.
+    * @param[in] rows The number of rows in the block.
+    * @return The block table entry, without its offset.
+    */
+    BlockEntry PlanBlock( const Column &column, const unsigned &first, const unsigned &rows ) const;
+
+    /**
+    * @brief Encodes a block as planned.
+    *
+    * @param[in] column The column.
+    * @param[in] first The first row of the block.
+    * @param[in] entry The planned block table entry.
+    * @param[out] buffer The buffer the encoded block is appended to.
+    */
+    static void EncodeBlock( const Column &column, const unsigned &first, const BlockEntry &entry, string &buffer );
+
+    /**
+    * @brief Writes a 32 bit number in little endian order.
+    *
+    * @param[out] buffer The buffer appended to.
+    * @param[in] value The number.
+    */
+    static void PutUnsigned( string &buffer, const unsigned &value );
+
+    /**
+    * @brief Writes a 64 bit number in little endian order.
+    *
+    * @param[out] buffer The buffer appended to.
+    * @param[in] value The number.
+    */
+    static void PutUnsigned64( string &buffer, const unsigned long long &value );
+
+    /**
+    * @brief Converts a float to its raw 32 bit value.
+    *
+    * @param[in] value The float.
+    * @return The IEEE 754 bits of the float.
+    */
+    static unsigned ToBits( const float &value );
+
+    /**
+    * @brief Converts a raw 32 bit value back to a float.
+    *
+    * @param[in] bits The IEEE 754 bits of the float.
+    * @return The float.
+    */
+    static float FromBits( const unsigned &bits );
+};
+
+#endif // COLUMNARWRITER_H_INCLUDED
@@ -0,0 +1,208 @@
+#include<iostream>
+#include<fstream>
+#include<sstream>
+#include<cstdio>
+#include<cmath>
+
+#include "ColumnarWriter.h"
+#include "ColumnarReader.h"
+#include "Timestamp.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+string ReadFile( const string &filePath );
+void TestColumns();
+void TestRoundTrip( const Vector<WindRecType> &windRecLog );
+void TestCompression( const Vector<WindRecType> &windRecLog );
+void TestLayout( const Vector<WindRecType> &windRecLog );
+void TestSensors();
+
+int main()
+{
+    Vector<WindRecType> windRecLog;
+
+    // Four days of 10 minute readings, dark from 6 PM to 6 AM
+    for( unsigned reading(0); reading < 4 * 144; reading++ )
+    {
+        unsigned hour = ( reading / 6 ) % 24;
+        Date date( 1 + reading / 144, 3, 2016 );
+        Time time( hour, ( reading % 6 ) * 10 );
+        float solarRadiation = ( hour >= 6 && hour < 18 ) ? float( 100 + reading % 50 ) : 0.0f;
+        windRecLog.InsertLast( WindRecType( date, time, WindSpeed( float( reading % 13 ) / 2 ), SolarRadiation( solarRadiation ), Temperature( 15.5f + float( reading % 7 ) ) ) );
+    }
+
+    TestColumns();
+    TestRoundTrip( windRecLog );
+    TestCompression( windRecLog );
+    TestLayout( windRecLog );
+    TestSensors();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+string ReadFile( const string &filePath )
+{
+    ifstream inputFile( filePath, ios::binary );
+    ostringstream contents;
+
+    contents << inputFile.rdbuf();
+    return contents.str();
+}
+
+void TestColumns()
+{
+    ColumnarWriter columnarWriter;
+    unsigned first = columnarWriter.AddColumn( "Count", ColumnType::UINT32 );
+    unsigned second = columnarWriter.AddColumn( "Level", ColumnType::FLOAT32 );
+
+    cout << "Test on columns" << endl;
+    Assert( first == 0 && second == 1, "Columns are indexed in the order they are added" );
+    Assert( columnarWriter.AddColumn( "Count", ColumnType::FLOAT32 ) == 2, "A name can only be used once" );
+    Assert( columnarWriter.AddColumn( "AVeryLongColumnNameIndeed", ColumnType::FLOAT32 ) == 2, "A name longer than 23 characters is rejected" );
+
+    columnarWriter.Append( first, 7u );
+    Assert( !columnarWriter.Write( "ColumnarWriterTest.col" ) && !ifstream( "ColumnarWriterTest.col" ).good(), "Columns of different lengths are not written" );
+    cout << endl;
+}
+
+void TestRoundTrip( const Vector<WindRecType> &windRecLog )
+{
+    ColumnarWriter columnarWriter( 100 );
+    ColumnarReader columnarReader;
+    Vector<unsigned> timestamps;
+    Vector<float> windSpeeds;
+    Vector<float> solarRadiations;
+    Vector<float> temperatures;
+    unsigned column = 0;
+    bool isEqual = true;
+
+    columnarWriter.AddRecords( windRecLog );
+    bool isWritten = columnarWriter.Write( "ColumnarWriterTest.col" );
+    bool isRead = columnarReader.Open( "ColumnarWriterTest.col" )
+                  && columnarReader.FindColumn( ColumnarWriter::TIMESTAMP_COLUMN, column ) && columnarReader.ReadColumn( column, timestamps )
+                  && columnarReader.FindColumn( ColumnarWriter::WINDSPEED_COLUMN, column ) && columnarReader.ReadColumn( column, windSpeeds )
+                  && columnarReader.FindColumn( ColumnarWriter::SOLARRADIATION_COLUMN, column ) && columnarReader.ReadColumn( column, solarRadiations )
+                  && columnarReader.FindColumn( ColumnarWriter::TEMPERATURE_COLUMN, column ) && columnarReader.ReadColumn( column, temperatures );
+    remove( "ColumnarWriterTest.col" );
+
+    for( unsigned record(0); isRead && record < windRecLog.GetUsed(); record++ )
+    {
+        isEqual = isEqual && timestamps[record] == Timestamp::Pack( windRecLog[record].GetRecordDate(), windRecLog[record].GetRecordTime() )
+                  && windSpeeds[record] == windRecLog[record].GetRecordWindSpeed().GetMeasurement()
+                  && solarRadiations[record] == windRecLog[record].GetRecordSolarRadiation().GetMeasurement()
+                  && temperatures[record] == windRecLog[record].GetRecordTemperature().GetMeasurement();
+    }
+
+    cout << "Test on exporting wind records" << endl;
+    Assert( isWritten && isRead, "The four columns are written and read back" );
+    Assert( columnarReader.GetRowCount() == 576 && columnarReader.GetBlockCount() == 6, "Rows are cut into blocks of 100" );
+    Assert( isEqual && timestamps.GetUsed() == 576, "Every value reads back unchanged" );
+    Assert( columnarReader.GetBlockMinimum( 1, 0 ) == 0 && columnarReader.GetBlockMaximum( 1, 0 ) == 6, "Blocks record their minimum and maximum" );
+    Assert( columnarReader.GetBlockMinimum( 0, 5 ) == timestamps[500] && columnarReader.GetBlockMaximum( 0, 5 ) == timestamps[575], "The last, shorter block has its own statistics" );
+    cout << endl;
+}
+
+void TestCompression( const Vector<WindRecType> &windRecLog )
+{
+    ColumnarWriter compressedWriter;
+    ColumnarWriter plainWriter( ColumnarWriter::DEFAULT_BLOCK_ROWS, false );
+    ColumnarReader compressedReader;
+    ColumnarReader plainReader;
+    Vector<float> compressed;
+    Vector<float> plain;
+
+    compressedWriter.AddRecords( windRecLog );
+    plainWriter.AddRecords( windRecLog );
+    compressedWriter.Write( "ColumnarWriterTest.col" );
+    plainWriter.Write( "ColumnarWriterTest_plain.col" );
+    size_t compressedSize = ReadFile( "ColumnarWriterTest.col" ).size();
+    size_t plainSize = ReadFile( "ColumnarWriterTest_plain.col" ).size();
+    bool isRead = compressedReader.Open( "ColumnarWriterTest.col" ) && plainReader.Open( "ColumnarWriterTest_plain.col" )
+                  && compressedReader.ReadColumn( 2, compressed ) && plainReader.ReadColumn( 2, plain );
+    remove( "ColumnarWriterTest.col" );
+    remove( "ColumnarWriterTest_plain.col" );
+
+    bool isEqual = isRead && compressed.GetUsed() == plain.GetUsed();
+    for( unsigned row(0); isEqual && row < plain.GetUsed(); row++ )
+    {
+        isEqual = compressed[row] == plain[row];
+    }
+
+    cout << "Test on compression" << endl;
+    Assert( compressedReader.GetBlockEncoding( 0, 0 ) == ColumnEncoding::DELTA, "Ascending timestamps are delta encoded" );
+    Assert( compressedReader.GetBlockEncoding( 1, 0 ) == ColumnEncoding::PLAIN, "Varying measurements stay plain" );
+    Assert( plainReader.GetBlockEncoding( 0, 0 ) == ColumnEncoding::PLAIN, "Without compression every block is plain" );
+    Assert( compressedSize < plainSize, "Compressed file is smaller" );
+    Assert( isEqual, "Compressed and plain columns read back the same" );
+    cout << endl;
+}
+
+void TestLayout( const Vector<WindRecType> &windRecLog )
+{
+    ColumnarWriter columnarWriter( 100, false );
+
+    columnarWriter.AddRecords( windRecLog );
+    columnarWriter.Write( "ColumnarWriterTest.col" );
+    string contents = ReadFile( "ColumnarWriterTest.col" );
+    remove( "ColumnarWriterTest.col" );
+
+    const unsigned char *bytes = (const unsigned char *) contents.data();
+    const unsigned char *firstEntry = bytes + ColumnarWriter::HEADER_SIZE + 4 * ColumnarWriter::COLUMN_ENTRY_SIZE;
+    unsigned firstOffset = firstEntry[0] | firstEntry[1] << 8 | firstEntry[2] << 16 | firstEntry[3] << 24;
+
+    cout << "Test on file layout" << endl;
+    Assert( contents.compare( 0, 8, string( "WTSCOLS\0", 8 ) ) == 0 && bytes[8] == 1 && bytes[12] == 4, "Header holds the magic, version and column count" );
+    Assert( bytes[16] == 576 % 256 && bytes[17] == 576 / 256 && bytes[24] == 100, "Header holds the row count and rows per block in little endian order" );
+    Assert( contents.compare( ColumnarWriter::HEADER_SIZE, 10, string( "Timestamp\0", 10 ) ) == 0, "Column directory holds the NUL padded names" );
+    Assert( firstOffset % ColumnarWriter::BLOCK_ALIGNMENT == 0 && contents.size() > firstOffset, "Blocks start on an 8 byte boundary" );
+    cout << endl;
+}
+
+void TestSensors()
+{
+    SensorRegistry sensorRegistry;
+    Vector<WindRecType> windRecLog;
+    WindRecType windRecType;
+    ColumnarWriter columnarWriter;
+    ColumnarReader columnarReader;
+    Vector<float> relativeHumidity;
+    unsigned column = 0;
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T,RH" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,6,512,20,40" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,7,500,21," );
+    for( unsigned row(0); row < sensorRegistry.GetRowCount(); row++ )
+    {
+        sensorRegistry.GetRecord( row, windRecType );
+        windRecLog.InsertLast( windRecType );
+    }
+
+    cout << "Test on sensor columns" << endl;
+    columnarWriter.AddRecords( windRecLog );
+    Assert( columnarWriter.AddSensors( sensorRegistry ) && columnarWriter.GetColumnCount() == 1 + sensorRegistry.GetSensorCount(),
+            "Every sensor without a column of its code is added" );
+    Assert( columnarWriter.Write( "ColumnarWriterTest.col" ) && columnarReader.Open( "ColumnarWriterTest.col" )
+            && columnarReader.FindColumn( "RH", column ) && columnarReader.ReadColumn( column, relativeHumidity )
+            && relativeHumidity.GetUsed() == 2 && relativeHumidity[0] == 40.0f && std::isnan( relativeHumidity[1] ),
+            "Missing readings are written as NaN" );
+
+    ColumnarWriter shorter;
+    shorter.AddColumn( "Count", ColumnType::UINT32 );
+    shorter.Append( 0, 1u );
+    Assert( !shorter.AddSensors( sensorRegistry ) && shorter.GetColumnCount() == 1, "A registry with another number of rows is not added" );
+    remove( "ColumnarWriterTest.col" );
+    cout << endl;
+}
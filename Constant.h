@@ -12,6 +12,7 @@ const std::string POPULATING_DATA_MSG = "Populating data from file path ";
 const std::string TOTAL_READ_DATA_MSG = "Total Read Data: ";
 const std::string TOTAL_ERROR_DATA_MSG = "Total Error Data Skipped: ";
 const std::string TOTAL_SAVED_DATA_MSG = "Total Saved Data To Structure: ";
+const std::string TOTAL_FLAGGED_DATA_MSG = "Total Readings Flagged As Anomalies: ";
 const std::string OUTPUT = "\n[ OUTPUT ] --> ";
 const std::string SELECTION_INPUT = "[ SELECTION ] --> ";
 const std::string SELECTED_OPTION_ONE_MSG = "\n[ SELECTED ] : +++++ Option One +++++";
@@ -33,6 +34,36 @@ const std::string AVERAGE_WINDSPEED = "Average speed: ";
 const std::string AVERAGE_TEMPERATURE = "\n\tAverage Temperature: ";
 const std::string WINDSPEED_STANDARD_DEVIATION = "Sample stdev : ";
 const std::string TEMPERATURE_STANDARD_DEVIATION = "Temperature Standard Deviation: ";
+const std::string QUERY_CACHE_HITS_MSG = "Query Cache Hits: ";
+const std::string QUERY_CACHE_MISSES_MSG = "Query Cache Misses: ";
+const std::string QUERY_CACHE_INVALIDATIONS_MSG = "Query Cache Invalidations: ";
+const std::string REPORT_HEADER = "Month,Average Wind Speed(stdev),Average Ambient Temperature(stdev),Solar Radiation";
+const std::string REPORT_WRITE_ERROR_MSG = "[ ERROR ] Writing File: ";
+const std::string BATCH_OPTION = "--batch";
+const std::string BATCH_STANDARD_INPUT = "-";
+const std::string BATCH_USAGE_MSG = "Usage: <program> --batch <query file> | - [ --format text|json|ndjson ]";
+const std::string BATCH_OPEN_ERROR_MSG = "Error Opening Query File: ";
+const std::string FORMAT_OPTION = "--format";
+const std::string REPORTS_OPTION = "--reports";
+const std::string REPORTS_USAGE_MSG = "Usage: <program> --reports [ <first year> <last year> ]";
+const std::string REPORTS_WRITTEN_MSG = "Reports written: ";
+const std::string REPORTS_FAILED_MSG = "Reports failed: ";
+const std::string EXPORT_OPTION = "--export";
+const std::string EXPORT_PLAIN_OPTION = "--plain";
+const std::string EXPORT_USAGE_MSG = "Usage: <program> --export <columnar file> [ --plain ]";
+const std::string EXPORT_WRITE_ERROR_MSG = "[ ERROR ] Writing File: ";
+const std::string EXPORT_WRITTEN_MSG = "Records exported: ";
+const std::string ANOMALIES_OPTION = "--anomalies";
+const std::string ANOMALIES_USAGE_MSG = "Usage: <program> --anomalies <ndjson file>";
+const std::string WINDROSE_OPTION = "--windrose";
+const std::string WINDROSE_JSON_EXTENSION = ".json";
+const std::string WINDROSE_USAGE_MSG = "Usage: <program> --windrose <csv or .json file> <year> [ <month> ]";
+const std::string WINDROSE_WRITTEN_MSG = "Readings binned: ";
+const std::string SERVE_OPTION = "--serve";
+const std::string SERVE_USAGE_MSG = "Usage: <program> --serve <socket path>";
+const std::string SERVE_LISTEN_ERROR_MSG = "Error Listening On Socket: ";
+const std::string SERVE_LISTENING_MSG = "Serving queries on ";
+const std::string SERVE_STOPPED_MSG = "Server stopped. Queries answered: ";
 
 /**
  * @brief Returns a status message based on a condition.
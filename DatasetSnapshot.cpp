@@ -0,0 +1,74 @@
+
+#include "DatasetSnapshot.h"
+
+DatasetSnapshot::DatasetSnapshot() {}
+
+bool DatasetSnapshot::Append( const WindRecType &windRecType )
+{
+    if( !m_records.InsertLast( windRecType ) )
+    {
+        return false;
+    }
+    m_summaryCube.Add( windRecType );
+    m_aggregatePyramid.Add( windRecType );
+    m_prefixSumIndex.Append( windRecType );
+    if( m_prefixSumIndex.IsBuilt() )
+    {
+        m_rangeExtremumIndex.Extend( m_prefixSumIndex );
+    }
+    m_gapList.Append( Timestamp::Pack( windRecType.GetRecordDate(), windRecType.GetRecordTime() ) );
+    return true;
+}
+
+void DatasetSnapshot::BuildIndexes()
+{
+    m_prefixSumIndex.Build();
+    m_aggregatePyramid.Build();
+    m_rangeExtremumIndex.Build( m_prefixSumIndex );
+    m_gapList.Build( m_prefixSumIndex );
+}
+
+unsigned DatasetSnapshot::GetUsed() const
+{
+    return m_records.GetUsed();
+}
+
+const Vector<WindRecType> &DatasetSnapshot::GetRecords() const
+{
+    return m_records;
+}
+
+const SummaryCube &DatasetSnapshot::GetSummaryCube() const
+{
+    return m_summaryCube;
+}
+
+const PrefixSumIndex &DatasetSnapshot::GetPrefixSumIndex() const
+{
+    return m_prefixSumIndex;
+}
+
+const RangeExtremumIndex &DatasetSnapshot::GetRangeExtremumIndex() const
+{
+    return m_rangeExtremumIndex;
+}
+
+const AggregatePyramid &DatasetSnapshot::GetAggregatePyramid() const
+{
+    return m_aggregatePyramid;
+}
+
+const SensorRegistry &DatasetSnapshot::GetSensorRegistry() const
+{
+    return m_sensorRegistry;
+}
+
+SensorRegistry &DatasetSnapshot::GetSensorRegistry()
+{
+    return m_sensorRegistry;
+}
+
+const GapList &DatasetSnapshot::GetGapList() const
+{
+    return m_gapList;
+}
@@ -0,0 +1,129 @@
+/**
+ * @file DatasetSnapshot.h
+ * @brief Defines the DatasetSnapshot class, a self contained copy of a loaded dataset and its indexes.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef DATASETSNAPSHOT_H_INCLUDED
+#define DATASETSNAPSHOT_H_INCLUDED
+
+#include "WindRecType.h"
+#include "Vector.h"
+#include "SummaryCube.h"
+#include "PrefixSumIndex.h"
+#include "RangeExtremumIndex.h"
+#include "AggregatePyramid.h"
+#include "SensorRegistry.h"
+#include "GapList.h"
+
+/**
+* @brief Holds the wind records of one load together with every structure the queries read.
+*
+* A snapshot is filled by one loader with Append() and BuildIndexes(), then published by the
+* Processor as a shared pointer to const, after which it is never changed. Readers take their own
+* shared pointer to the snapshot they started on, so a reload builds and publishes a new snapshot
+* beside it without blocking them, and the old snapshot is freed when its last reader lets go.
+*/
+class DatasetSnapshot
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty DatasetSnapshot.
+    */
+    DatasetSnapshot();
+
+    DatasetSnapshot( const DatasetSnapshot & ) = delete;
+    DatasetSnapshot &operator = ( const DatasetSnapshot & ) = delete;
+
+    /**
+    * @brief Appends a wind record to the records, the summary cube, the pyramid, the prefix sums, the range extremes and the gaps.
+    *
+    * @param[in] windRecType The wind record to append.
+    * @return true if the record was inserted, false otherwise.
+    */
+    bool Append( const WindRecType &windRecType );
+
+    /**
+    * @brief Builds the time ordered indexes over every appended record.
+    *
+    * Must be called once all the records are appended and before the snapshot is published.
+    */
+    void BuildIndexes();
+
+    /**
+    * @brief Getter for the number of records.
+    *
+    * @return The number of records.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the wind records in load order.
+    *
+    * @return The records.
+    */
+    const Vector<WindRecType> &GetRecords() const;
+
+    /**
+    * @brief Getter for the monthly summary cube.
+    *
+    * @return The summary cube of every record.
+    */
+    const SummaryCube &GetSummaryCube() const;
+
+    /**
+    * @brief Getter for the time ordered prefix sums.
+    *
+    * @return The prefix sum index of every record.
+    */
+    const PrefixSumIndex &GetPrefixSumIndex() const;
+
+    /**
+    * @brief Getter for the range minimum and maximum index.
+    *
+    * @return The range extremum index of every record.
+    */
+    const RangeExtremumIndex &GetRangeExtremumIndex() const;
+
+    /**
+    * @brief Getter for the pyramid of pre-aggregated summaries.
+    *
+    * @return The aggregate pyramid of every record.
+    */
+    const AggregatePyramid &GetAggregatePyramid() const;
+
+    /**
+    * @brief Getter for every sensor column of the records.
+    *
+    * @return The sensor registry, one row per record.
+    */
+    const SensorRegistry &GetSensorRegistry() const;
+
+    /**
+    * @brief Getter for the sensor registry while the snapshot is loaded.
+    *
+    * @return The sensor registry the loader reads the CSV files into.
+    */
+    SensorRegistry &GetSensorRegistry();
+
+    /**
+    * @brief Getter for the missing intervals of the 10 minute cadence.
+    *
+    * @return The gap list of the records.
+    */
+    const GapList &GetGapList() const;
+
+private:
+    Vector<WindRecType> m_records;                  ///< Wind records in load order.
+    SummaryCube m_summaryCube;                      ///< Monthly rollup of the records.
+    PrefixSumIndex m_prefixSumIndex;                ///< Time ordered prefix sums of the records.
+    RangeExtremumIndex m_rangeExtremumIndex;        ///< Range minimum and maximum of the records.
+    AggregatePyramid m_aggregatePyramid;            ///< 10 minute to yearly summaries of the records.
+    SensorRegistry m_sensorRegistry;                ///< Every sensor column of the records.
+    GapList m_gapList;                              ///< Missing intervals of the records.
+};
+
+#endif // DATASETSNAPSHOT_H_INCLUDED
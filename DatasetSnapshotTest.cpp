@@ -0,0 +1,148 @@
+#include<iostream>
+#include<thread>
+#include<atomic>
+
+#include "Processor.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+std::shared_ptr<DatasetSnapshot> MakeSnapshot( const unsigned &records, const float &windSpeed );
+void TestInitialization( const DatasetSnapshot &datasetSnapshot );
+void TestAppend();
+void TestPublish();
+void TestReadWhileReload();
+
+int main()
+{
+    DatasetSnapshot datasetSnapshot;
+
+    TestInitialization( datasetSnapshot );
+    TestAppend();
+    TestPublish();
+    TestReadWhileReload();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+std::shared_ptr<DatasetSnapshot> MakeSnapshot( const unsigned &records, const float &windSpeed )
+{
+    std::shared_ptr<DatasetSnapshot> snapshot = std::make_shared<DatasetSnapshot>();
+
+    for( unsigned i(0); i < records; i++ )
+    {
+        snapshot->Append( WindRecType( Date( 1 + i / 144, 3, 2016 ), Time( i % 144 / 6, i % 6 * 10 ), WindSpeed( windSpeed ), SolarRadiation( 0 ), Temperature( 20 ) ) );
+    }
+    snapshot->BuildIndexes();
+    return snapshot;
+}
+
+void TestInitialization( const DatasetSnapshot &datasetSnapshot )
+{
+    cout << "Test on Default DatasetSnapshot Object" << endl;
+    Assert( datasetSnapshot.GetUsed() == 0, "Default DatasetSnapshot has no records" );
+    cout << endl;
+}
+
+void TestAppend()
+{
+    std::shared_ptr<DatasetSnapshot> snapshot = MakeSnapshot( 300, 5 );
+    unsigned start = Timestamp::Pack( 1, 3, 2016 );
+    unsigned end = Timestamp::Pack( 1, 4, 2016 );
+
+    cout << "Test on appending records" << endl;
+    Assert( snapshot->GetUsed() == 300 && snapshot->GetRecords().GetUsed() == 300, "Snapshot holds every record" );
+    Assert( snapshot->GetSummaryCube().GetMonthly( 3, 2016, MeasurementType::WINDSPEED ).GetCount() == 300, "Summary cube holds every record" );
+    Assert( snapshot->GetPrefixSumIndex().IsBuilt(), "Prefix sums are built" );
+    Assert( snapshot->GetRangeExtremumIndex().GetUsed() == 300, "Range extremum index is built" );
+    Assert( snapshot->GetAggregatePyramid().GetRangeSummary( start, end, MeasurementType::WINDSPEED ).GetMean() == 5, "Pyramid holds every record" );
+    Assert( snapshot->GetGapList().IsBuilt() && snapshot->GetGapList().GetUsed() == 0, "Records every 10 minutes leave no gap" );
+
+    float maximum = 0;
+    unsigned timestamp = 0;
+    snapshot->Append( WindRecType( Date( 2, 4, 2016 ), Time( 9, 0 ), WindSpeed( 50 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    Assert( snapshot->GetPrefixSumIndex().GetRangeSummary( start, end + Timestamp::MINUTES_PER_DAY * 2, MeasurementType::WINDSPEED ).GetCount() == 301,
+            "Prefix sums hold a record appended after the build" );
+    Assert( snapshot->GetRangeExtremumIndex().GetMaximum( start, end + Timestamp::MINUTES_PER_DAY * 2, MeasurementType::WINDSPEED, maximum, timestamp ) && maximum == 50,
+            "Range extremum index holds a record appended after the build" );
+    cout << endl;
+}
+
+void TestPublish()
+{
+    std::shared_ptr<DatasetSnapshot> first = MakeSnapshot( 10, 1 );
+    std::weak_ptr<DatasetSnapshot> firstWatch = first;
+    unsigned version = Processor::GetInstance().GetDataVersion();
+
+    Processor::GetInstance().PublishSnapshot( first );
+    first.reset();
+    std::shared_ptr<const DatasetSnapshot> reader = Processor::GetInstance().GetSnapshot();
+    Processor::GetInstance().PublishSnapshot( MakeSnapshot( 20, 2 ) );
+
+    cout << "Test on publishing" << endl;
+    Assert( Processor::GetInstance().GetDataVersion() == version + 2, "Each publish changes the data version" );
+    Assert( Processor::GetInstance().GetSnapshot()->GetUsed() == 20, "Readers get the latest snapshot" );
+    Assert( reader->GetUsed() == 10 && !firstWatch.expired(), "Earlier reader keeps its snapshot" );
+    reader.reset();
+    Assert( firstWatch.expired(), "Old snapshot is freed with its last reader" );
+    cout << endl;
+}
+
+void TestReadWhileReload()
+{
+    const unsigned readers = 4;
+    const unsigned reloads = 200;
+    std::atomic<bool> reloading( true );
+    std::atomic<unsigned> torn( 0 );
+    std::atomic<unsigned> reads( 0 );
+    thread threads[readers];
+
+    Processor::GetInstance().PublishSnapshot( MakeSnapshot( 144, 0 ) );
+    for( unsigned i(0); i < readers; i++ )
+    {
+        threads[i] = thread( [&]()
+        {
+            while( reloading )
+            {
+                // Every record of a snapshot has the same wind speed, so a mixed summary means a torn read
+                std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().GetSnapshot();
+                MeasurementAccumulator summary = snapshot->GetSummaryCube().GetMonthly( 3, 2016, MeasurementType::WINDSPEED );
+                if( summary.GetMinimum() != summary.GetMaximum() || summary.GetCount() != snapshot->GetUsed() )
+                {
+                    torn++;
+                }
+                reads++;
+            }
+        } );
+    }
+    while( reads == 0 )
+    {
+        this_thread::yield();
+    }
+    for( unsigned reload(1); reload <= reloads; reload++ )
+    {
+        Processor::GetInstance().PublishSnapshot( MakeSnapshot( 144 + reload % 7, float( reload ) ) );
+    }
+    reloading = false;
+    for( unsigned i(0); i < readers; i++ )
+    {
+        threads[i].join();
+    }
+
+    cout << "Test on reading while reloading" << endl;
+    Assert( torn == 0, "No reader saw a partly reloaded dataset" );
+    Assert( Processor::GetInstance().GetSnapshot()->GetSummaryCube().GetMonthly( 3, 2016, MeasurementType::WINDSPEED ).GetMean() == float( reloads ), "Last reload is published" );
+    cout << endl;
+}
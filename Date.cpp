@@ -46,56 +46,22 @@ void Date::SetYear(const unsigned &year)
 
 string Date::GetMonthInStr(const unsigned &month) const
 {
-    string strInMonth;
-    switch(month)
+    return string( GetMonthName( month ) );
+}
+
+string_view Date::GetMonthName(const unsigned &month)
+{
+    if( month < 1 || month > MONTHS_IN_YEAR )
     {
-    case 1:
-        strInMonth = "January";
-        break;
-    case 2:
-        strInMonth = "February";
-        break;
-    case 3:
-        strInMonth = "March";
-        break;
-    case 4:
-        strInMonth = "April";
-        break;
-    case 5:
-        strInMonth = "May";
-        break;
-    case 6:
-        strInMonth = "June";
-        break;
-    case 7:
-        strInMonth = "July";
-        break;
-    case 8:
-        strInMonth = "August";
-        break;
-    case 9:
-        strInMonth = "September";
-        break;
-    case 10:
-        strInMonth = "October";
-        break;
-    case 11:
-        strInMonth = "November";
-        break;
-    case 12:
-        strInMonth = "December";
-        break;
-    default:
-        strInMonth = "Error";
-        break;
+        return "Error";
     }
-    return strInMonth;
+    return MONTH_NAMES[month - 1];
 }
 
 ostream &operator << (ostream &outputStream, const Date &D)
 {
     outputStream << D.GetDay() << " "
-                                << D.GetMonthInStr(D.GetMonth()) << " "
+                                << Date::GetMonthName(D.GetMonth()) << " "
                                 << D.GetYear();
 
     return outputStream;
@@ -13,6 +13,7 @@
 #define DATE_H_INCLUDED
 
 #include<iostream>
+#include<string_view>
 
 using namespace std;
 
@@ -20,6 +21,17 @@ class Date
 {
 public:
 
+    static constexpr unsigned MONTHS_IN_YEAR = 12;  ///< Number of months in a year.
+
+    ///
+    /// @brief Names of the months, indexed by month - 1.
+    ///
+    static constexpr string_view MONTH_NAMES[MONTHS_IN_YEAR] =
+    {
+        "January", "February", "March", "April", "May", "June",
+        "July", "August", "September", "October", "November", "December"
+    };
+
     ///
     /// @brief Default constructor for Date class.
     ///
@@ -86,6 +98,14 @@ public:
     ///
     string GetMonthInStr(const unsigned &month) const;
 
+    ///
+    /// @brief Method that allows retrieving the name of a month without building a string.
+    ///
+    /// @param month referencing the month between 1 ~ 12.
+    /// @return The name of the month from MONTH_NAMES, or "Error" when the month is out of range.
+    ///
+    static string_view GetMonthName(const unsigned &month);
+
 private:
     unsigned INITIAL_VALUE = 0;
 
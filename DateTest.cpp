@@ -84,4 +84,6 @@ void TestGetMonthIntoString( Date &date )
 {
     cout << "\nTest on converting numeric month to string month: " << endl;
     Assert( date.GetMonthInStr( date.GetMonth() )=="February", "Converting month to February" );
+    Assert( Date::GetMonthName( 12 )=="December", "Month name of December from the month table" );
+    Assert( Date::GetMonthName( 13 )=="Error", "Month outside 1 ~ 12 has no name" );
 }
@@ -0,0 +1,110 @@
+#include "DirectionAccumulator.h"
+
+#include<cmath>
+#include<limits>
+
+#include "ColumnKernels.h"
+
+namespace
+{
+const double DEGREES_PER_RADIAN = 180.0 / 3.14159265358979323846;
+// Accuracy of the summed length of the approximated sines and cosines
+const double RESULTANT_TOLERANCE = 1e-6;
+}
+
+DirectionAccumulator::DirectionAccumulator()
+{
+    Clear();
+}
+
+DirectionAccumulator::DirectionAccumulator( const unsigned &count, const double &sumOfSines, const double &sumOfCosines )
+{
+    Clear();
+    if( count > 0 )
+    {
+        m_count = count;
+        m_sumOfSines = sumOfSines;
+        m_sumOfCosines = sumOfCosines;
+    }
+}
+
+void DirectionAccumulator::Add( const float &degrees )
+{
+    float sine;
+    float cosine;
+
+    ColumnKernels::SineCosine( degrees, sine, cosine );
+    m_count ++;
+    m_sumOfSines += sine;
+    m_sumOfCosines += cosine;
+}
+
+void DirectionAccumulator::Merge( const DirectionAccumulator &other )
+{
+    m_count += other.m_count;
+    m_sumOfSines += other.m_sumOfSines;
+    m_sumOfCosines += other.m_sumOfCosines;
+}
+
+void DirectionAccumulator::Clear()
+{
+    m_count = 0;
+    m_sumOfSines = 0.0;
+    m_sumOfCosines = 0.0;
+}
+
+unsigned DirectionAccumulator::GetCount() const
+{
+    return m_count;
+}
+
+double DirectionAccumulator::GetSumOfSines() const
+{
+    return m_sumOfSines;
+}
+
+double DirectionAccumulator::GetSumOfCosines() const
+{
+    return m_sumOfCosines;
+}
+
+float DirectionAccumulator::GetMeanDirection() const
+{
+    if( m_count == 0 )
+    {
+        return 0.0;
+    }
+
+    // Directions are measured clockwise from north, so the sine is the x of atan2
+    double degrees = atan2( m_sumOfSines, m_sumOfCosines ) * DEGREES_PER_RADIAN;
+    float mean = degrees < 0.0 ? degrees + 360.0 : degrees;
+    return mean >= 360.0f ? 0.0f : mean;
+}
+
+float DirectionAccumulator::GetResultantLength() const
+{
+    if( m_count == 0 )
+    {
+        return 0.0;
+    }
+
+    // The approximated sines and cosines are not exactly unit vectors, so equal directions can sum
+    // to a length just under or over the count, which would show as a small deviation
+    double length = sqrt( m_sumOfSines * m_sumOfSines + m_sumOfCosines * m_sumOfCosines ) / m_count;
+    return length > 1.0 - RESULTANT_TOLERANCE ? 1.0 : length;
+}
+
+float DirectionAccumulator::GetCircularStandardDeviation() const
+{
+    if( m_count == 0 )
+    {
+        return 0.0;
+    }
+
+    double length = GetResultantLength();
+    if( length <= 0.0 )
+    {
+        return std::numeric_limits<float>::infinity();
+    }
+    return sqrt( -2.0 * log( length ) ) * DEGREES_PER_RADIAN;
+}
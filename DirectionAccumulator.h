@@ -0,0 +1,115 @@
+/**
+ * @file DirectionAccumulator.h
+ * @brief Defines the DirectionAccumulator class for the circular mean and deviation of directions.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef DIRECTIONACCUMULATOR_H_INCLUDED
+#define DIRECTIONACCUMULATOR_H_INCLUDED
+
+/**
+* @brief Represents a mergeable accumulator of directions, in degrees.
+*
+* An arithmetic mean of angles is wrong across north: 350 and 10 degrees average to 180. Each
+* direction is instead added as a unit vector, and the accumulator keeps the count and the sums of
+* the sines and cosines. The mean direction is the angle of the summed vector, and its length over
+* the count, the mean resultant length, is 1 when every direction is the same and near 0 when they
+* cancel out. Sums merge by addition, so partial results from columns, threads or files combine
+* exactly, and can be reduced elsewhere with ColumnKernels::MaskedSumOfSinesAndCosines().
+*/
+class DirectionAccumulator
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty DirectionAccumulator with no directions.
+    */
+    DirectionAccumulator();
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * Builds an accumulator from partial results reduced elsewhere, such as a column scan.
+    *
+    * @param[in] count The number of directions.
+    * @param[in] sumOfSines The sum of the sines of the directions.
+    * @param[in] sumOfCosines The sum of the cosines of the directions.
+    * @post Creates a DirectionAccumulator holding the specified directions, empty when count is 0.
+    */
+    DirectionAccumulator( const unsigned &count, const double &sumOfSines, const double &sumOfCosines );
+
+    /**
+    * @brief Adds a single direction to the accumulator.
+    *
+    * @param[in] degrees The direction, in degrees.
+    * @post The count and the sums of the sines and cosines include the direction.
+    */
+    void Add( const float &degrees );
+
+    /**
+    * @brief Merges another accumulator into this accumulator.
+    *
+    * @param[in] other The accumulator holding the partial result to combine.
+    * @post This accumulator holds the result of both sets of directions.
+    */
+    void Merge( const DirectionAccumulator &other );
+
+    /**
+    * @brief Resets the accumulator back to no directions.
+    *
+    * @post The count and the sums are set back to zero.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of accumulated directions.
+    *
+    * @return The number of directions.
+    */
+    unsigned GetCount() const;
+
+    /**
+    * @brief Getter for the sum of the sines of the accumulated directions.
+    *
+    * @return The east component of the summed vector.
+    */
+    double GetSumOfSines() const;
+
+    /**
+    * @brief Getter for the sum of the cosines of the accumulated directions.
+    *
+    * @return The north component of the summed vector.
+    */
+    double GetSumOfCosines() const;
+
+    /**
+    * @brief Calculates the circular mean of the accumulated directions.
+    *
+    * @return The mean direction between 0 and 360 degrees, 0 when there are no directions.
+    */
+    float GetMeanDirection() const;
+
+    /**
+    * @brief Calculates the mean resultant length of the accumulated directions.
+    *
+    * @return The length of the summed vector over the count, between 0 and 1, 0 when there are no directions.
+    * Lengths within 1e-6 of 1, the accuracy of the approximated sines and cosines, are returned as 1.
+    */
+    float GetResultantLength() const;
+
+    /**
+    * @brief Calculates the circular standard deviation, sqrt( -2 ln R ) of the mean resultant length R.
+    *
+    * @return The deviation in degrees, 0 when there are no directions and infinity when they cancel out.
+    */
+    float GetCircularStandardDeviation() const;
+
+private:
+    unsigned m_count;       ///< Number of accumulated directions.
+    double m_sumOfSines;    ///< Sum of the sines of the directions.
+    double m_sumOfCosines;  ///< Sum of the cosines of the directions.
+};
+
+#endif // DIRECTIONACCUMULATOR_H_INCLUDED
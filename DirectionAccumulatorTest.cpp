@@ -0,0 +1,113 @@
+#include<iostream>
+#include<cmath>
+
+#include "DirectionAccumulator.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+bool IsClose( const double &actual, const double &expected );
+void TestEmpty();
+void TestMeanDirection();
+void TestDeviation();
+void TestMerge();
+
+int main()
+{
+    TestEmpty();
+    TestMeanDirection();
+    TestDeviation();
+    TestMerge();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+bool IsClose( const double &actual, const double &expected )
+{
+    return fabs( actual - expected ) < 0.01;
+}
+
+void TestEmpty()
+{
+    DirectionAccumulator directionAccumulator;
+
+    cout << "Test on an empty accumulator" << endl;
+    Assert( directionAccumulator.GetCount() == 0 && directionAccumulator.GetMeanDirection() == 0
+            && directionAccumulator.GetResultantLength() == 0 && directionAccumulator.GetCircularStandardDeviation() == 0,
+            "No directions give 0" );
+    Assert( DirectionAccumulator( 0, 1.0, 1.0 ).GetCount() == 0 && DirectionAccumulator( 0, 1.0, 1.0 ).GetSumOfSines() == 0,
+            "Partial results without directions are empty" );
+    cout << endl;
+}
+
+void TestMeanDirection()
+{
+    DirectionAccumulator acrossNorth;
+    DirectionAccumulator west;
+
+    acrossNorth.Add( 350 );
+    acrossNorth.Add( 10 );
+    west.Add( 250 );
+    west.Add( 290 );
+
+    cout << "Test on the circular mean" << endl;
+    Assert( IsClose( acrossNorth.GetMeanDirection(), 0 ) || IsClose( acrossNorth.GetMeanDirection(), 360 ), "Mean of 350 and 10 is north, not 180" );
+    Assert( IsClose( west.GetMeanDirection(), 270 ), "Mean of 250 and 290 is 270" );
+    Assert( acrossNorth.GetMeanDirection() >= 0 && acrossNorth.GetMeanDirection() < 360, "Mean is between 0 and 360" );
+    cout << endl;
+}
+
+void TestDeviation()
+{
+    DirectionAccumulator same;
+    DirectionAccumulator opposite;
+    DirectionAccumulator spread;
+
+    same.Add( 45 );
+    same.Add( 45 );
+    opposite.Add( 90 );
+    opposite.Add( 270 );
+    spread.Add( 350 );
+    spread.Add( 10 );
+
+    // R = cos( 10 degrees ), so the deviation is sqrt( -2 ln R ) in degrees
+    double expected = sqrt( -2 * log( cos( 10 * M_PI / 180 ) ) ) * 180 / M_PI;
+
+    cout << "Test on the circular deviation" << endl;
+    Assert( IsClose( same.GetResultantLength(), 1 ) && IsClose( same.GetCircularStandardDeviation(), 0 ), "Equal directions have no deviation" );
+    Assert( IsClose( opposite.GetResultantLength(), 0 ) && opposite.GetCircularStandardDeviation() > 100, "Opposite directions cancel out" );
+    Assert( IsClose( spread.GetCircularStandardDeviation(), expected ), "Deviation of 350 and 10 is about 10 degrees" );
+    cout << endl;
+}
+
+void TestMerge()
+{
+    DirectionAccumulator whole;
+    DirectionAccumulator first;
+    DirectionAccumulator second;
+    float directions[] = { 10, 20, 350, 340, 5, 15 };
+
+    for( unsigned i(0); i < 6; i++ )
+    {
+        whole.Add( directions[i] );
+        ( i < 3 ? first : second ).Add( directions[i] );
+    }
+    first.Merge( second );
+
+    cout << "Test on merging accumulators" << endl;
+    Assert( first.GetCount() == whole.GetCount() && IsClose( first.GetMeanDirection(), whole.GetMeanDirection() )
+            && IsClose( first.GetCircularStandardDeviation(), whole.GetCircularStandardDeviation() ), "Merged halves match one pass" );
+    cout << endl;
+}
@@ -0,0 +1,14 @@
+#ifndef FILLMETHOD_H_INCLUDED
+#define FILLMETHOD_H_INCLUDED
+
+/**
+* @brief How the empty buckets between two buckets holding data are filled in a derived series.
+*/
+enum class FillMethod
+{
+    NONE,           ///< Empty buckets are left out.
+    LINEAR,         ///< Empty buckets take the straight line between the means of their neighbours.
+    LAST_VALUE      ///< Empty buckets repeat the mean of the bucket before them.
+};
+
+#endif // FILLMETHOD_H_INCLUDED
@@ -0,0 +1,133 @@
+#include "GapList.h"
+
+const unsigned GapList::DEFAULT_CADENCE;
+
+GapList::GapList( const unsigned &cadence )
+    : m_cadence( cadence > 0 ? cadence : DEFAULT_CADENCE )
+{
+    Clear();
+}
+
+void GapList::Append( const unsigned &timestamp )
+{
+    if( !m_hasLast )
+    {
+        m_last = timestamp;
+        m_hasLast = true;
+        return;
+    }
+    if( timestamp < m_last )
+    {
+        m_isBuilt = false;
+        return;
+    }
+
+    if( m_isBuilt && timestamp - m_last > m_cadence )
+    {
+        m_starts.InsertLast( m_last + m_cadence );
+        m_ends.InsertLast( timestamp );
+    }
+    m_last = timestamp;
+}
+
+void GapList::Build( const PrefixSumIndex &prefixSumIndex )
+{
+    if( m_isBuilt )
+    {
+        return;
+    }
+
+    Clear();
+    for( unsigned row(0); row < prefixSumIndex.GetUsed(); row++ )
+    {
+        Append( prefixSumIndex.GetTimestampAt( row ) );
+    }
+}
+
+void GapList::Clear()
+{
+    m_last = 0;
+    m_hasLast = false;
+    m_isBuilt = true;
+    m_starts.SetSize( 0 );
+    m_ends.SetSize( 0 );
+}
+
+bool GapList::IsBuilt() const
+{
+    return m_isBuilt;
+}
+
+unsigned GapList::GetCadence() const
+{
+    return m_cadence;
+}
+
+unsigned GapList::GetUsed() const
+{
+    return m_starts.GetUsed();
+}
+
+unsigned GapList::GetStart( const unsigned &gap ) const
+{
+    return m_starts[gap];
+}
+
+unsigned GapList::GetEnd( const unsigned &gap ) const
+{
+    return m_ends[gap];
+}
+
+unsigned GapList::FindFirst( const unsigned &timestamp ) const
+{
+    unsigned low = 0;
+    unsigned high = m_ends.GetUsed();
+
+    while( low < high )
+    {
+        unsigned middle = low + ( high - low ) / 2;
+        if( m_ends[middle] <= timestamp )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+unsigned GapList::GetMissingCount( const unsigned &gap, const unsigned &start, const unsigned &end ) const
+{
+    if( end <= start )
+    {
+        return 0;
+    }
+    return CountBefore( gap, end ) - CountBefore( gap, start );
+}
+
+unsigned GapList::GetMissingCount( const unsigned &start, const unsigned &end ) const
+{
+    unsigned missing = 0;
+
+    // Gaps do not overlap, so only those from the first ending after start can fall in the range
+    for( unsigned gap( FindFirst( start ) ); gap < GetUsed() && m_starts[gap] < end; gap++ )
+    {
+        missing += GetMissingCount( gap, start, end );
+    }
+    return missing;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+unsigned GapList::CountBefore( const unsigned &gap, const unsigned &timestamp ) const
+{
+    // The missing readings are one cadence apart from the start, up to but not including the end
+    unsigned limit = timestamp < m_ends[gap] ? timestamp : m_ends[gap];
+    if( limit <= m_starts[gap] )
+    {
+        return 0;
+    }
+    return ( limit - m_starts[gap] + m_cadence - 1 ) / m_cadence;
+}
@@ -0,0 +1,147 @@
+/**
+ * @file GapList.h
+ * @brief Defines the GapList class recording the missing intervals of the 10 minute logging cadence.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef GAPLIST_H_INCLUDED
+#define GAPLIST_H_INCLUDED
+
+#include "Vector.h"
+#include "PrefixSumIndex.h"
+
+/**
+* @brief Represents the ranges of time where readings are missing, as a compact list of intervals.
+*
+* The loggers write one reading per cadence, every 10 minutes. When two consecutive timestamps are
+* more than one cadence apart, the interval from one cadence after the first up to the second is a
+* gap, holding one missing reading per cadence. Only the gaps are stored, two numbers each, so a
+* multi-year archive with a few outages costs a few entries and never a dense timeline.
+*
+* Timestamps appended in time order extend the list in the same pass that loads them. A timestamp
+* older than the last one marks the list as not built, and Build() must be called with the sorted
+* rows before it is queried again, as for the PrefixSumIndex. Repeated timestamps are ignored.
+*/
+class GapList
+{
+public:
+    static const unsigned DEFAULT_CADENCE = 10;     ///< Minutes between two readings of the loggers.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] cadence The minutes between two readings, at least 1.
+    * @post Creates an empty, built GapList.
+    */
+    GapList( const unsigned &cadence = DEFAULT_CADENCE );
+
+    /**
+    * @brief Appends the timestamp of a reading.
+    *
+    * @param[in] timestamp The packed timestamp of the reading.
+    * @post A gap is recorded if the timestamp is more than one cadence after the last one, or the list
+    * is marked as not built when the timestamp is out of time order.
+    */
+    void Append( const unsigned &timestamp );
+
+    /**
+    * @brief Rebuilds the gaps from the time ordered rows of a prefix sum index, if any timestamp was appended out of order.
+    *
+    * @param[in] prefixSumIndex The prefix sum index holding every appended reading.
+    * @pre prefixSumIndex.IsBuilt() is true.
+    * @post The list is built and can be queried.
+    */
+    void Build( const PrefixSumIndex &prefixSumIndex );
+
+    /**
+    * @brief Removes every gap and the last timestamp.
+    *
+    * @post The list is empty and built.
+    */
+    void Clear();
+
+    /**
+    * @brief Checks whether the list can be queried.
+    *
+    * @return false if a timestamp was appended out of time order since the last Build(), true otherwise.
+    */
+    bool IsBuilt() const;
+
+    /**
+    * @brief Getter for the minutes between two readings.
+    *
+    * @return The cadence in minutes.
+    */
+    unsigned GetCadence() const;
+
+    /**
+    * @brief Getter for the number of gaps.
+    *
+    * @return The number of gaps.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the start of a gap.
+    *
+    * @param[in] gap The gap, in time order.
+    * @return The packed timestamp of the first missing reading.
+    */
+    unsigned GetStart( const unsigned &gap ) const;
+
+    /**
+    * @brief Getter for the end of a gap.
+    *
+    * @param[in] gap The gap, in time order.
+    * @return The packed timestamp of the reading that ended the gap.
+    */
+    unsigned GetEnd( const unsigned &gap ) const;
+
+    /**
+    * @brief Finds the first gap ending after a timestamp.
+    *
+    * @param[in] timestamp The packed timestamp to search for.
+    * @return The index of the first gap whose end is later than timestamp, GetUsed() if there is none.
+    * @pre IsBuilt() is true.
+    */
+    unsigned FindFirst( const unsigned &timestamp ) const;
+
+    /**
+    * @brief Counts the missing readings of a gap within a time range.
+    *
+    * @param[in] gap The gap, in time order.
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @return The number of missing readings of the gap falling in the range.
+    */
+    unsigned GetMissingCount( const unsigned &gap, const unsigned &start, const unsigned &end ) const;
+
+    /**
+    * @brief Counts the missing readings within a time range.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @return The number of missing readings of every gap falling in the range.
+    * @pre IsBuilt() is true.
+    */
+    unsigned GetMissingCount( const unsigned &start, const unsigned &end ) const;
+
+private:
+    unsigned m_cadence;             ///< Minutes between two readings.
+    unsigned m_last;                ///< Packed timestamp of the last reading appended.
+    bool m_hasLast;                 ///< Whether a reading was appended since the last Clear().
+    bool m_isBuilt;                 ///< Whether every timestamp was appended in time order.
+    Vector<unsigned> m_starts;      ///< Packed timestamp of the first missing reading of each gap.
+    Vector<unsigned> m_ends;        ///< Packed timestamp of the reading ending each gap.
+
+    /**
+    * @brief Counts the missing readings of a gap before a time.
+    *
+    * @param[in] gap The gap, in time order.
+    * @param[in] timestamp The packed timestamp, excluded.
+    * @return The number of missing readings of the gap earlier than timestamp.
+    */
+    unsigned CountBefore( const unsigned &gap, const unsigned &timestamp ) const;
+};
+
+#endif // GAPLIST_H_INCLUDED
@@ -0,0 +1,103 @@
+#include<iostream>
+
+#include "GapList.h"
+#include "Timestamp.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestInOrder();
+void TestMissingCounts();
+void TestOutOfOrder();
+
+int main()
+{
+    TestInOrder();
+    TestMissingCounts();
+    TestOutOfOrder();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestInOrder()
+{
+    GapList gapList;
+
+    cout << "Test on readings in time order" << endl;
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, 0 ) );
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, 10 ) );
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, 10 ) );
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, 20 ) );
+    Assert( gapList.GetUsed() == 0 && gapList.IsBuilt(), "readings one cadence apart, or repeated, leave no gap" );
+
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 10, 0 ) );
+    Assert( gapList.GetUsed() == 1 && gapList.GetStart( 0 ) == Timestamp::Pack( 1, 3, 2016, 9, 30 )
+            && gapList.GetEnd( 0 ) == Timestamp::Pack( 1, 3, 2016, 10, 0 ), "a gap runs from the first missing reading to the next reading" );
+
+    // A year long outage is still a single interval
+    gapList.Append( Timestamp::Pack( 1, 3, 2017, 10, 0 ) );
+    Assert( gapList.GetUsed() == 2 && gapList.GetMissingCount( 1, 0, Timestamp::Pack( 1, 1, 2100 ) ) == 365 * 144 - 1,
+            "a long outage is one interval" );
+
+    gapList.Clear();
+    Assert( gapList.GetUsed() == 0 && gapList.GetCadence() == GapList::DEFAULT_CADENCE, "clearing keeps the cadence" );
+    cout << endl;
+}
+
+void TestMissingCounts()
+{
+    GapList gapList;
+
+    cout << "Test on missing counts" << endl;
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, 0 ) );
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 10, 0 ) );
+    gapList.Append( Timestamp::Pack( 1, 3, 2016, 10, 10 ) );
+    gapList.Append( Timestamp::Pack( 2, 3, 2016, 0, 0 ) );
+    gapList.Append( Timestamp::Pack( 2, 3, 2016, 0, 25 ) );
+
+    Assert( gapList.GetUsed() == 3, "three gaps are found" );
+    Assert( gapList.GetMissingCount( 0, Timestamp::Pack( 1, 1, 2016 ), Timestamp::Pack( 1, 1, 2017 ) ) == 5,
+            "a gap of an hour misses 5 readings" );
+    Assert( gapList.GetMissingCount( 2, 0, Timestamp::Pack( 1, 1, 2017 ) ) == 2, "a gap ended off the cadence misses the readings before its end" );
+    Assert( gapList.GetMissingCount( Timestamp::Pack( 1, 3, 2016 ), Timestamp::Pack( 3, 3, 2016 ) ) == 5 + 82 + 2,
+            "the missing readings of a range add up every gap" );
+    Assert( gapList.GetMissingCount( Timestamp::Pack( 1, 3, 2016, 9, 35 ), Timestamp::Pack( 1, 3, 2016, 9, 50 ) ) == 1,
+            "a range cutting a gap counts only its own readings" );
+    Assert( gapList.GetMissingCount( Timestamp::Pack( 2, 3, 2016 ), Timestamp::Pack( 3, 3, 2016 ) ) == 2
+            && gapList.FindFirst( Timestamp::Pack( 2, 3, 2016 ) ) == 2, "a gap ending on the start of a range is left out" );
+    cout << endl;
+}
+
+void TestOutOfOrder()
+{
+    GapList gapList;
+    PrefixSumIndex prefixSumIndex;
+    const unsigned minutes[] = { 40, 0, 10, 30 };
+
+    cout << "Test on readings out of time order" << endl;
+    for( const unsigned &minute : minutes )
+    {
+        WindRecType record( Date( 1, 3, 2016 ), Time( 9, minute ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 20 ) );
+        prefixSumIndex.Append( record );
+        gapList.Append( Timestamp::Pack( 1, 3, 2016, 9, minute ) );
+    }
+    Assert( !gapList.IsBuilt(), "a reading out of order marks the list as not built" );
+
+    prefixSumIndex.Build();
+    gapList.Build( prefixSumIndex );
+    Assert( gapList.IsBuilt() && gapList.GetUsed() == 1 && gapList.GetStart( 0 ) == Timestamp::Pack( 1, 3, 2016, 9, 20 )
+            && gapList.GetMissingCount( 0, 0, Timestamp::Pack( 2, 3, 2016 ) ) == 1, "building finds the gaps of the sorted readings" );
+    cout << endl;
+}
@@ -0,0 +1,178 @@
+
+#include "JsonWriter.h"
+
+#include<cmath>
+
+JsonWriter::JsonWriter( ostream &output, const unsigned &capacity )
+    : m_output( output, capacity ), m_afterKey( false ) {}
+
+JsonWriter &JsonWriter::BeginObject()
+{
+    Open( '{' );
+    return *this;
+}
+
+JsonWriter &JsonWriter::EndObject()
+{
+    Close( '}' );
+    return *this;
+}
+
+JsonWriter &JsonWriter::BeginArray()
+{
+    Open( '[' );
+    return *this;
+}
+
+JsonWriter &JsonWriter::EndArray()
+{
+    Close( ']' );
+    return *this;
+}
+
+JsonWriter &JsonWriter::Key( string_view key )
+{
+    BeginValue();
+    WriteString( key );
+    m_output.Append( ':' );
+    m_afterKey = true;
+    return *this;
+}
+
+JsonWriter &JsonWriter::Value( string_view text )
+{
+    BeginValue();
+    WriteString( text );
+    return *this;
+}
+
+JsonWriter &JsonWriter::Value( const unsigned &value )
+{
+    BeginValue();
+    m_output.Append( value );
+    return *this;
+}
+
+JsonWriter &JsonWriter::Value( const float &value, const int &precision )
+{
+    if( !std::isfinite( value ) )
+    {
+        return Null();
+    }
+    BeginValue();
+    m_output.Append( value, precision );
+    return *this;
+}
+
+JsonWriter &JsonWriter::Boolean( const bool &value )
+{
+    BeginValue();
+    m_output.Append( value ? "true" : "false" );
+    return *this;
+}
+
+JsonWriter &JsonWriter::Null()
+{
+    BeginValue();
+    m_output.Append( "null" );
+    return *this;
+}
+
+JsonWriter &JsonWriter::NewLine()
+{
+    m_output.Append( '\n' );
+    return *this;
+}
+
+void JsonWriter::Flush()
+{
+    m_output.Flush();
+}
+
+unsigned JsonWriter::GetDepth() const
+{
+    return m_hasMembers.GetUsed();
+}
+
+const string &JsonWriter::GetContents() const
+{
+    return m_output.GetContents();
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void JsonWriter::BeginValue()
+{
+    if( m_afterKey )
+    {
+        m_afterKey = false;
+        return;
+    }
+    if( m_hasMembers.IsEmpty() )
+    {
+        return;
+    }
+
+    bool &hasMembers = m_hasMembers[m_hasMembers.GetUsed() - 1];
+    if( hasMembers )
+    {
+        m_output.Append( ',' );
+    }
+    hasMembers = true;
+}
+
+void JsonWriter::Open( const char &bracket )
+{
+    BeginValue();
+    m_output.Append( bracket );
+    m_hasMembers.InsertLast( false );
+}
+
+void JsonWriter::Close( const char &bracket )
+{
+    m_hasMembers.RemoveLast();
+    m_output.Append( bracket );
+}
+
+void JsonWriter::WriteString( string_view text )
+{
+    static const char HEX_DIGITS[] = "0123456789abcdef";
+    size_t runStart = 0;
+
+    m_output.Append( '"' );
+    for( size_t index(0); index < text.size(); index++ )
+    {
+        unsigned char character = (unsigned char) text[index];
+        if( character != '"' && character != '\\' && character >= 0x20 )
+        {
+            continue;
+        }
+
+        // Copy the run of plain characters before the escaped one at once
+        m_output.Append( text.substr( runStart, index - runStart ) );
+        runStart = index + 1;
+        switch( character )
+        {
+        case '"':
+            m_output.Append( "\\\"" );
+            break;
+        case '\\':
+            m_output.Append( "\\\\" );
+            break;
+        case '\n':
+            m_output.Append( "\\n" );
+            break;
+        case '\r':
+            m_output.Append( "\\r" );
+            break;
+        case '\t':
+            m_output.Append( "\\t" );
+            break;
+        default:
+            m_output.Append( "\\u00" ).Append( HEX_DIGITS[character >> 4] ).Append( HEX_DIGITS[character & 0x0F] );
+            break;
+        }
+    }
+    m_output.Append( text.substr( runStart ) );
+    m_output.Append( '"' );
+}
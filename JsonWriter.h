@@ -0,0 +1,179 @@
+/**
+ * @file JsonWriter.h
+ * @brief Defines the JsonWriter class, which streams JSON text without building a document in memory.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef JSONWRITER_H_INCLUDED
+#define JSONWRITER_H_INCLUDED
+
+#include<iostream>
+#include<string_view>
+
+#include "OutputBuffer.h"
+#include "Vector.h"
+
+using namespace std;
+
+/**
+* @brief Writes JSON values to a stream as they are produced, through an OutputBuffer.
+*
+* There is no document tree: every call appends its text to the buffer straight away, and the
+* buffer is written out whenever it reaches its capacity, so an array of any length is written in
+* bounded memory. The writer only remembers, for each open object or array, whether it already
+* holds a member, which is enough to place the commas. Several values written at the top level,
+* each followed by NewLine(), make a newline delimited JSON (NDJSON) stream.
+*
+* The writer does not check that keys and values alternate inside objects; the caller writes a
+* Key() before every value of an object. Numbers that are not finite are written as null.
+*/
+class JsonWriter
+{
+public:
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] output The stream the JSON text is written to.
+    * @param[in] capacity The size of the buffer, written out once reached.
+    */
+    JsonWriter( ostream &output, const unsigned &capacity = OutputBuffer::DEFAULT_CAPACITY );
+
+    JsonWriter( const JsonWriter & ) = delete;
+    JsonWriter &operator = ( const JsonWriter & ) = delete;
+
+    /**
+    * @brief Opens an object.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &BeginObject();
+
+    /**
+    * @brief Closes the innermost open object.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &EndObject();
+
+    /**
+    * @brief Opens an array.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &BeginArray();
+
+    /**
+    * @brief Closes the innermost open array.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &EndArray();
+
+    /**
+    * @brief Writes the key of the next member of an object.
+    *
+    * @param[in] key The key, escaped as needed.
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Key( string_view key );
+
+    /**
+    * @brief Writes a string value.
+    *
+    * @param[in] text The string, escaped as needed.
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Value( string_view text );
+
+    /**
+    * @brief Writes an unsigned number.
+    *
+    * @param[in] value The number.
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Value( const unsigned &value );
+
+    /**
+    * @brief Writes a number to a number of significant digits, or null if it is not finite.
+    *
+    * @param[in] value The number.
+    * @param[in] precision The number of significant digits.
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Value( const float &value, const int &precision = OutputBuffer::DEFAULT_PRECISION );
+
+    /**
+    * @brief Writes true or false.
+    *
+    * @param[in] value The value.
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Boolean( const bool &value );
+
+    /**
+    * @brief Writes null.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &Null();
+
+    /**
+    * @brief Ends a top level value with a line break, as NDJSON does between records.
+    *
+    * @return This writer, for chaining.
+    */
+    JsonWriter &NewLine();
+
+    /**
+    * @brief Writes what is buffered to the stream and flushes it.
+    */
+    void Flush();
+
+    /**
+    * @brief Getter for the number of objects and arrays still open.
+    *
+    * @return The nesting depth of the next value.
+    */
+    unsigned GetDepth() const;
+
+    /**
+    * @brief Getter for the text not yet written to the stream.
+    *
+    * @return The buffered text.
+    */
+    const string &GetContents() const;
+
+private:
+    OutputBuffer m_output;          ///< Buffer the JSON text is formatted into.
+    Vector<bool> m_hasMembers;      ///< For each open object or array, whether it holds a member yet.
+    bool m_afterKey;                ///< Whether the next value completes a member of an object.
+
+    /**
+    * @brief Writes the comma separating a value from the previous member of its object or array.
+    */
+    void BeginValue();
+
+    /**
+    * @brief Opens an object or an array.
+    *
+    * @param[in] bracket '{' or '['.
+    */
+    void Open( const char &bracket );
+
+    /**
+    * @brief Closes the innermost object or array.
+    *
+    * @param[in] bracket '}' or ']'.
+    */
+    void Close( const char &bracket );
+
+    /**
+    * @brief Writes a quoted string, escaping quotes, backslashes and control characters.
+    *
+    * @param[in] text The string.
+    */
+    void WriteString( string_view text );
+};
+
+#endif // JSONWRITER_H_INCLUDED
@@ -0,0 +1,101 @@
+#include<iostream>
+#include<sstream>
+#include<limits>
+
+#include "JsonWriter.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestNesting();
+void TestValues();
+void TestEscaping();
+void TestStreaming();
+
+int main()
+{
+    TestNesting();
+    TestValues();
+    TestEscaping();
+    TestStreaming();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestNesting()
+{
+    ostringstream output;
+    JsonWriter jsonWriter( output );
+
+    jsonWriter.BeginObject().Key( "series" ).BeginArray();
+    jsonWriter.BeginObject().Key( "count" ).Value( 2u ).EndObject();
+    jsonWriter.BeginArray().EndArray();
+    jsonWriter.EndArray().Key( "empty" ).BeginObject().EndObject().EndObject();
+
+    cout << "Test on nesting" << endl;
+    Assert( jsonWriter.GetContents() == "{\"series\":[{\"count\":2},[]],\"empty\":{}}", "Commas separate members at every depth" );
+    Assert( jsonWriter.GetDepth() == 0, "Every object and array is closed" );
+    cout << endl;
+}
+
+void TestValues()
+{
+    ostringstream output;
+    JsonWriter jsonWriter( output );
+
+    jsonWriter.BeginArray()
+              .Value( 4.0f ).Value( 3.14159265f ).Value( 2.5f, 2 ).Value( 1234567.0f )
+              .Value( numeric_limits<float>::infinity() ).Value( numeric_limits<float>::quiet_NaN() )
+              .Boolean( true ).Boolean( false ).Null().Value( "text" )
+              .EndArray();
+
+    cout << "Test on values" << endl;
+    Assert( jsonWriter.GetContents() == "[4,3.14159,2.5,1.23457e+06,null,null,true,false,null,\"text\"]", "Numbers use 6 significant digits and non finite numbers are null" );
+    cout << endl;
+}
+
+void TestEscaping()
+{
+    ostringstream output;
+    JsonWriter jsonWriter( output );
+
+    jsonWriter.Value( string( "a\"b\\c\nd\te\x01" ) + '\0' );
+
+    cout << "Test on escaping" << endl;
+    Assert( jsonWriter.GetContents() == "\"a\\\"b\\\\c\\nd\\te\\u0001\\u0000\"", "Quotes, backslashes and control characters are escaped" );
+    cout << endl;
+}
+
+void TestStreaming()
+{
+    ostringstream output;
+    JsonWriter jsonWriter( output, 64 );
+    unsigned largestBuffer = 0;
+
+    jsonWriter.BeginArray();
+    for( unsigned index(0); index < 10000; index++ )
+    {
+        jsonWriter.Value( index );
+        largestBuffer = max( largestBuffer, unsigned( jsonWriter.GetContents().size() ) );
+    }
+    jsonWriter.EndArray().NewLine();
+    jsonWriter.BeginObject().Key( "last" ).Value( 1u ).EndObject().NewLine();
+    jsonWriter.Flush();
+
+    cout << "Test on streaming" << endl;
+    Assert( largestBuffer < 64, "A long array is written out in bounded memory" );
+    Assert( output.str().find( "[0,1,2," ) == 0 && output.str().find( ",9999]\n{\"last\":1}\n" ) != string::npos, "Top level values on separate lines make NDJSON" );
+    cout << endl;
+}
@@ -2,13 +2,29 @@
 #include<iostream>
 #include<fstream>
 #include<limits>
+#include<sstream>
+#include<csignal>
+#include<thread>
+#include<chrono>
 
 #include "Processor.h"
 #include "Client.h"
+#include "QueryEngine.h"
+#include "QueryServer.h"
+#include "ReportWriter.h"
+#include "BulkReportGenerator.h"
+#include "ColumnarWriter.h"
+#include "JsonWriter.h"
+#include "WindRose.h"
 
 using namespace std;
 
-int main()
+volatile sig_atomic_t stopRequested = 0;    ///< Set by HandleServerSignal() to stop the server.
+volatile sig_atomic_t reloadRequested = 0;  ///< Set by HandleServerSignal() to reload the dataset.
+
+void HandleServerSignal( int signalNumber );
+
+int main( int argc, char *argv[] )
 {
     // Initialize required variables for Processor class
     const string file = "data/data_source_test.txt";
@@ -16,33 +32,251 @@ int main()
     ifstream inFile( file );
     WindRecType windRecType;
     Vector<string> csvFilePath;
-    Vector<WindRecType> windRecTypeVector;
 
     // Initialize required variable for Client class
     Client client;
-    unsigned month = 0;
-    float monthlySum[12] = { 0.0 };
-    unsigned monthlyCount[12] = { 0 };
     unsigned clientInputMonth = 0;
     unsigned clientInputYear = 0;
-    float sum = 0.0;
-    unsigned count = 0;
     float mean = 0.0;
     float ssD = 0.0;
-    float temperatureSum = 0.0;
-    float windSpeedSum = 0.0;
     float solarRadiationSum = 0.0;
     float windSpeedMean = 0.0;
     float windSpeedSsD = 0.0;
     float temperatureMean = 0.0;
     float temperatureSsd = 0.0;
-    MeanFunctionPtr windSpeedMeanFunc = nullptr;
-    MeanFunctionPtr temperatureMeanFunc = nullptr;
+    MeasurementAccumulator summary;
+    MeasurementAccumulator windSpeedSummary[12];
+    MeasurementAccumulator temperatureSummary[12];
+    MeasurementAccumulator solarRadiationSummary[12];
+    ReportWriter reportWriter;
+
+    // Batch mode answers a file, or standard input, of queries after a single load, without the menu,
+    // as text records or, with --format json|ndjson, as JSON objects.
+    // Server mode answers queries from local clients over a Unix domain socket until interrupted,
+    // and publishes a freshly loaded snapshot on SIGHUP without pausing the queries.
+    // Reports mode writes the option 4 report of every year, or of a range of years, in parallel.
+    // Export mode writes the loaded dataset to a columnar binary file, compressed unless --plain is given.
+    // Anomalies mode writes every reading flagged while loading to a file, one JSON object per line.
+    // Wind rose mode writes the wind rose of a year, or of one of its months, as CSV, or as JSON for a .json file.
+    bool isReports = argc > 1 && argv[1] == Constant::REPORTS_OPTION;
+    bool isBatch = argc > 1 && argv[1] == Constant::BATCH_OPTION;
+    bool isServer = argc > 1 && argv[1] == Constant::SERVE_OPTION;
+    bool isExport = argc > 1 && argv[1] == Constant::EXPORT_OPTION;
+    bool isWindRose = argc > 1 && argv[1] == Constant::WINDROSE_OPTION;
+    bool isAnomalies = argc > 1 && argv[1] == Constant::ANOMALIES_OPTION;
+    ifstream queryFile;
+    OutputFormat outputFormat = OutputFormat::TEXT;
+    bool isValidFormat = ( argc == 3 )
+                         || ( isBatch && argc == 5 && argv[3] == Constant::FORMAT_OPTION
+                              && RecordWriter::ParseOutputFormat( argv[4], outputFormat ) );
+    if( ( isBatch && !isValidFormat ) || ( isServer && argc != 3 ) )
+    {
+        cerr << ( isBatch ? Constant::BATCH_USAGE_MSG : Constant::SERVE_USAGE_MSG ) << endl;
+        return 2;
+    }
+    if( isBatch && argv[2] != Constant::BATCH_STANDARD_INPUT )
+    {
+        queryFile.open( argv[2] );
+        if( !queryFile )
+        {
+            cerr << Constant::BATCH_OPEN_ERROR_MSG << argv[2] << endl;
+            return 2;
+        }
+    }
+
+    if( isReports )
+    {
+        unsigned firstYear = 0;
+        unsigned lastYear = ~0u;
+        bool isValidRange = ( argc == 2 );
+        if( argc == 4 )
+        {
+            istringstream years( string( argv[2] ) + " " + argv[3] );
+            isValidRange = ( years >> firstYear >> lastYear ) && firstYear <= lastYear;
+        }
+        if( !isValidRange )
+        {
+            cerr << Constant::REPORTS_USAGE_MSG << endl;
+            return 2;
+        }
+
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );
+        BulkReportGenerator bulkReportGenerator;
+        unsigned failures = 0;
+        unsigned written = bulkReportGenerator.Generate( snapshot->GetSummaryCube(), firstYear, lastYear, outputFilePath, failures );
+
+        cout << Constant::INFO( Constant::REPORTS_WRITTEN_MSG ) << written << endl;
+        if( failures > 0 )
+        {
+            cerr << Constant::INFO( Constant::REPORTS_FAILED_MSG ) << failures << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    if( isExport )
+    {
+        bool isPlain = ( argc == 4 && argv[3] == Constant::EXPORT_PLAIN_OPTION );
+        if( argc != 3 && !isPlain )
+        {
+            cerr << Constant::EXPORT_USAGE_MSG << endl;
+            return 2;
+        }
+
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );
+        if( !ColumnarWriter::Export( snapshot->GetRecords(), argv[2], !isPlain, &snapshot->GetSensorRegistry() ) )
+        {
+            cerr << Constant::EXPORT_WRITE_ERROR_MSG << argv[2] << endl;
+            return 1;
+        }
+        cout << Constant::INFO( Constant::EXPORT_WRITTEN_MSG ) << snapshot->GetUsed() << endl;
+        return 0;
+    }
+
+    if( isAnomalies )
+    {
+        if( argc != 3 )
+        {
+            cerr << Constant::ANOMALIES_USAGE_MSG << endl;
+            return 2;
+        }
+
+        ofstream anomalyFile( argv[2] );
+        RecordWriter anomalyWriter( anomalyFile, OutputFormat::NDJSON );
+        Processor::GetInstance().SetAnomalySink( [&anomalyWriter]( const AnomalyDetector::Anomaly &anomaly )
+        {
+            anomalyWriter.BeginRecord( "anomaly" );
+            anomalyWriter.AddField( "time", QueryEngine::FormatTimestamp( anomaly.timestamp ) );
+            anomalyWriter.AddField( "measurement", QueryEngine::GetMeasurementName( anomaly.measurementType ) );
+            anomalyWriter.AddField( "reading", anomaly.reading );
+            anomalyWriter.AddField( "median", anomaly.median );
+            anomalyWriter.AddField( "kinds", AnomalyDetector::GetKindNames( anomaly.kinds ) );
+            anomalyWriter.EndRecord();
+        } );
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        Processor::GetInstance().LoadSnapshot( csvFilePath );
+        Processor::GetInstance().SetAnomalySink( nullptr );
+        anomalyWriter.Finish();
+        anomalyFile.flush();
+        if( !anomalyFile )
+        {
+            cerr << Constant::EXPORT_WRITE_ERROR_MSG << argv[2] << endl;
+            return 1;
+        }
+        return 0;
+    }
+
+    if( isWindRose )
+    {
+        unsigned year = 0;
+        unsigned month = Client::ALL_MONTHS;
+        bool isValidPeriod = false;
+        if( argc == 4 || argc == 5 )
+        {
+            istringstream period( string( argv[3] ) + " " + ( argc == 5 ? argv[4] : "0" ) );
+            isValidPeriod = ( period >> year >> month ) && month <= 12;
+        }
+        if( !isValidPeriod )
+        {
+            cerr << Constant::WINDROSE_USAGE_MSG << endl;
+            return 2;
+        }
+
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );
+        WindRose windRose;
+        client.GetWindRose( snapshot->GetSensorRegistry(), month, year, windRose );
+
+        string windRosePath = argv[2];
+        const string &extension = Constant::WINDROSE_JSON_EXTENSION;
+        bool isJson = windRosePath.size() >= extension.size()
+                      && windRosePath.compare( windRosePath.size() - extension.size(), extension.size(), extension ) == 0;
+        ofstream windRoseFile( windRosePath );
+        if( isJson )
+        {
+            JsonWriter jsonWriter( windRoseFile );
+            windRose.WriteJson( jsonWriter );
+            jsonWriter.NewLine();
+            jsonWriter.Flush();
+        }
+        else
+        {
+            windRose.WriteCsv( windRoseFile );
+        }
+        windRoseFile.flush();
+        if( !windRoseFile )
+        {
+            cerr << Constant::EXPORT_WRITE_ERROR_MSG << windRosePath << endl;
+            return 1;
+        }
+        cout << Constant::INFO( Constant::WINDROSE_WRITTEN_MSG ) << windRose.GetTotal() << endl;
+        return 0;
+    }
+
+    if( isBatch )
+    {
+        // Loading messages go to the error stream to keep the answers parseable
+        streambuf *standardOutput = cout.rdbuf( cerr.rdbuf() );
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );
+        cout.rdbuf( standardOutput );
+
+        QueryEngine queryEngine(
+            client,
+            snapshot->GetSummaryCube(),
+            snapshot->GetPrefixSumIndex(),
+            snapshot->GetRangeExtremumIndex(),
+            &snapshot->GetSensorRegistry(),
+            &snapshot->GetGapList() );
+        unsigned failures = queryFile.is_open() ? queryEngine.ExecuteAll( queryFile, cout, outputFormat )
+                                                : queryEngine.ExecuteAll( cin, cout, outputFormat );
+        return failures == 0 ? 0 : 1;
+    }
+
+    if( isServer )
+    {
+        QueryServer queryServer;
+        Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );
+        Processor::GetInstance().LoadSnapshot( csvFilePath );
+        if( !queryServer.Listen( argv[2] ) )
+        {
+            cerr << Constant::SERVE_LISTEN_ERROR_MSG << argv[2] << endl;
+            return 2;
+        }
+        signal( SIGINT, HandleServerSignal );
+        signal( SIGTERM, HandleServerSignal );
+#ifdef SIGHUP
+        signal( SIGHUP, HandleServerSignal );
+#endif
+        cout << Constant::INFO( Constant::SERVE_LISTENING_MSG ) << argv[2] << endl;
+
+        // Serve on another thread, while this one reloads a fresh snapshot on SIGHUP until stopped
+        thread serving( &QueryServer::Serve, &queryServer );
+        while( !stopRequested )
+        {
+            if( reloadRequested )
+            {
+                reloadRequested = 0;
+                ifstream reloadFile( file );
+                Vector<string> reloadFilePath;
+                Processor::GetInstance().LoadCSVFilePathToVector( reloadFilePath, reloadFile, file );
+                Processor::GetInstance().LoadSnapshot( reloadFilePath );
+            }
+            this_thread::sleep_for( chrono::milliseconds( QueryServer::POLL_INTERVAL ) );
+        }
+        queryServer.Stop();
+        serving.join();
+        cout << Constant::INFO( Constant::SERVE_STOPPED_MSG ) << queryServer.GetQueryCount() << endl;
+        return 0;
+    }
 
     // routines
     Processor::GetInstance();                                                                       // create singleton instance
     Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );                  // Loading csv file path from txt file
-    Processor::GetInstance().LoadCSVDataToVector( csvFilePath, windRecTypeVector, windRecType );    // Loading data into vector
+    std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );    // Loading data into a published snapshot
+    const SummaryCube &summaryCube = snapshot->GetSummaryCube();                                    // Monthly rollup built during loading
 
     // Menu routines
     char user_choice;
@@ -60,17 +294,14 @@ int main()
             clientInputMonth = client.ClientMonthInputValidation();
             clientInputYear = client.ClientYearInputValidation();
 
-            // Calculate WindSpeed Mean
-            sum = client.GetSumFromSelectedInput( windRecTypeVector, clientInputMonth, clientInputYear );
-            count = client.GetClientMonthYearInputCount( windRecTypeVector, clientInputMonth, clientInputYear );
-            windSpeedMeanFunc = &WindSpeed::GetMean;
-            mean = client.GetMeanFromSelectedInput(windRecType, sum, count, windSpeedMeanFunc, MeasurementType::WINDSPEED);
-            //mean = client.GetMeanFromSelectedInput( windRecType, windSpeedSum, windSpeedCount );
+            // Read WindSpeed summary of the month from the summary cube
+            summary = client.GetMonthlySummary( summaryCube, clientInputMonth, clientInputYear, MeasurementType::WINDSPEED );
 
-            if( count > 0 )
+            if( summary.GetCount() > 0 )
             {
-                // Calculate Sample Standard Deviation & Display with data
-                ssD = client.GetSampleStandardDeviation( windRecTypeVector, windRecType, mean, count, MeasurementType::WINDSPEED );
+                // Mean & Sample Standard Deviation & Display with data
+                mean = summary.GetMean();
+                ssD = summary.GetSampleStandardDeviation();
                 client.DisplayOptionOneWithData( windRecType, mean, ssD, clientInputMonth, clientInputYear );
             }
             else
@@ -78,35 +309,23 @@ int main()
                 // Display without data
                 client.DisplayOptionOneWithOutData( windRecType, clientInputMonth, clientInputYear );
             }
+            client.FlushOutput();
             break;
         case '2':
             // Validation of user input year
             cout << Constant::SELECTED_OPTION_TWO_MSG << endl;
             clientInputYear = client.ClientYearInputValidation();
 
-            // Calculate each monthly Sum & monthly Count for each month array
-            sum = client.GetMonthlySumOfEachFromInput(windRecTypeVector, clientInputYear, monthlySum, month, MeasurementType::TEMPERATURE);
-            count = client.GetMonthlySumCountOfEachFromInput(windRecTypeVector, clientInputYear, monthlyCount, month );
+            // Read each monthly Temperature summary from the summary cube
+            client.GetYearlySummary( summaryCube, clientInputYear, MeasurementType::TEMPERATURE, temperatureSummary );
 
-            temperatureMeanFunc = &Temperature::GetMean;
-            cout << Constant::OUTPUT << '\n' <<
-                 setw(5) << " " << clientInputYear << endl;
+            client.DisplayYearHeader( clientInputYear );
             for (unsigned month = 0; month < 12; month++)
             {
-                if (monthlyCount[month] > 0)
+                if (temperatureSummary[month].GetCount() > 0)
                 {
-                    mean = client.GetMeanFromSelectedInput(
-                               windRecType,
-                               sum,
-                               count,
-                               temperatureMeanFunc,
-                               MeasurementType::TEMPERATURE);
-                    ssD = client.GetSampleStandardDeviation(
-                              windRecTypeVector,
-                              windRecType,
-                              mean,
-                              count,
-                              MeasurementType::TEMPERATURE);
+                    mean = temperatureSummary[month].GetMean();
+                    ssD = temperatureSummary[month].GetSampleStandardDeviation();
                     client.DisplayOptionTwoWithData( windRecType, mean, ssD, month );
                 }
                 else
@@ -114,70 +333,46 @@ int main()
                     client.DisplayOptionTwoWithOutData( windRecType, month );
                 }
             }
+            client.FlushOutput();
             break;
         case '3':
             cout << Constant::SELECTED_OPTION_THREE_MSG << endl;
             clientInputYear = client.ClientYearInputValidation();
 
-            sum = client.GetMonthlySumOfEachFromInput(windRecTypeVector, clientInputYear, monthlySum, month, MeasurementType::SOLARRADIATION);
-            count = client.GetMonthlySumCountOfEachFromInput(windRecTypeVector, clientInputYear, monthlyCount, month );
-            cout << Constant::OUTPUT << endl;
-            cout << setw(5) << " " << clientInputYear << endl;
+            client.GetYearlySummary( summaryCube, clientInputYear, MeasurementType::SOLARRADIATION, solarRadiationSummary );
+            client.DisplayYearHeader( clientInputYear );
             for (unsigned month = 0; month < 12; month++)
             {
-                if (monthlyCount[month] > 0)
+                if (solarRadiationSummary[month].GetCount() > 0)
                 {
-                    client.DisplayOptionThreeWithData( windRecType, month, sum );
+                    client.DisplayOptionThreeWithData( windRecType, month, float( solarRadiationSummary[month].GetSum() ) );
                 }
                 else
                 {
                     client.DisplayOptionThreeWithOutData( windRecType, month );
                 }
             }
+            client.FlushOutput();
             break;
         case '4':
             cout << Constant::SELECTED_OPTION_FOUR_MSG << endl;
             clientInputYear = client.ClientYearInputValidation();
 
-            windSpeedSum = client.GetMonthlySumOfEachFromInput(windRecTypeVector, clientInputYear, monthlySum, month, MeasurementType::WINDSPEED);
-            temperatureSum = client.GetMonthlySumOfEachFromInput(windRecTypeVector, clientInputYear, monthlySum, month, MeasurementType::TEMPERATURE);
-            solarRadiationSum = client.GetMonthlySumOfEachFromInput(windRecTypeVector, clientInputYear, monthlySum, month, MeasurementType::SOLARRADIATION);
-            count = client.GetMonthlySumCountOfEachFromInput(windRecTypeVector, clientInputYear, monthlyCount, month );
+            client.GetYearlySummary( summaryCube, clientInputYear, MeasurementType::WINDSPEED, windSpeedSummary );
+            client.GetYearlySummary( summaryCube, clientInputYear, MeasurementType::TEMPERATURE, temperatureSummary );
+            client.GetYearlySummary( summaryCube, clientInputYear, MeasurementType::SOLARRADIATION, solarRadiationSummary );
 
-            windSpeedMeanFunc = &WindSpeed::GetMean;
-            temperatureMeanFunc = &Temperature::GetMean;
-
-            cout << Constant::OUTPUT << endl;
-            cout << setw(5) << " " << clientInputYear << endl;
+            reportWriter.Clear();
+            client.DisplayYearHeader( clientInputYear );
             for (unsigned month = 0; month < 12; month++)
             {
-                if (monthlyCount[month] > 0)
+                if (windSpeedSummary[month].GetCount() > 0)
                 {
-                    windSpeedMean = client.GetMeanFromSelectedInput(
-                                        windRecType,
-                                        windSpeedSum,
-                                        count,
-                                        windSpeedMeanFunc,
-                                        MeasurementType::WINDSPEED);
-                    windSpeedSsD = client.GetSampleStandardDeviation(
-                                       windRecTypeVector,
-                                       windRecType,
-                                       windSpeedMean,
-                                       count,
-                                       MeasurementType::WINDSPEED);
-
-                    temperatureMean = client.GetMeanFromSelectedInput(
-                                          windRecType,
-                                          temperatureSum,
-                                          count,
-                                          temperatureMeanFunc,
-                                          MeasurementType::TEMPERATURE);
-                    temperatureSsd = client.GetSampleStandardDeviation(
-                                         windRecTypeVector,
-                                         windRecType,
-                                         temperatureMean,
-                                         count,
-                                         MeasurementType::TEMPERATURE);
+                    windSpeedMean = windSpeedSummary[month].GetMean();
+                    windSpeedSsD = windSpeedSummary[month].GetSampleStandardDeviation();
+                    temperatureMean = temperatureSummary[month].GetMean();
+                    temperatureSsd = temperatureSummary[month].GetSampleStandardDeviation();
+                    solarRadiationSum = float( solarRadiationSummary[month].GetSum() );
 
                     client.DisplayOptionFourWithData(
                         windRecType,
@@ -189,10 +384,8 @@ int main()
                         temperatureSsd,
                         solarRadiationSum);
 
-                    client.OutputStreamMeasurement(
-                        windRecType,
-                        outputFilePath,
-                        month,
+                    reportWriter.AddRow(
+                        month + 1,
                         windSpeedMean,
                         windSpeedSsD,
                         temperatureMean,
@@ -204,11 +397,22 @@ int main()
                     client.DisplayOptionFourWithOutData( windRecType, month );
                 }
             }
-            cout << '\n' << setw(5) << " " << "[ INFO ] Data has been written to " << outputFilePath << endl;
+            client.FlushOutput();
+
+            // Every month of the report is written to the file at once
+            if( reportWriter.Write( outputFilePath ) )
+            {
+                cout << '\n' << setw(5) << " " << "[ INFO ] Data has been written to " << outputFilePath << endl;
+            }
+            else
+            {
+                cerr << '\n' << setw(5) << " " << Constant::REPORT_WRITE_ERROR_MSG << outputFilePath << endl;
+            }
             cout << endl;
             break;
         case '5':
             cout << Constant::SELECTED_OPTION_FIVE_MSG << endl;
+            client.DisplayQueryCacheStatistics();
             exit(0);
             break;
         default:
@@ -221,3 +425,15 @@ int main()
 
     return 0;
 }
+
+void HandleServerSignal( int signalNumber )
+{
+#ifdef SIGHUP
+    if( signalNumber == SIGHUP )
+    {
+        reloadRequested = 1;
+        return;
+    }
+#endif
+    stopRequested = 1;
+}
@@ -35,3 +35,8 @@ float Measurement::GetStandardDeviation( float &sumSquareDifferences, unsigned &
     sumSquareDifferences /= count;
     return sqrt( sumSquareDifferences );
 }
+
+void Measurement::Accumulate( MeasurementAccumulator &accumulator ) const
+{
+    accumulator.Add( m_measurement );
+}
@@ -3,6 +3,8 @@
 
 #include<cmath>
 
+#include "MeasurementAccumulator.h"
+
 /**
  * @name Measurement
  * @brief Represents a base class.
@@ -50,8 +52,21 @@ public:
 
     float GetSumSquareDifferences( float &sumSquareDifferences, float &perSquareDifference, float &mean );
 
+    /**
+     * @brief Calculates the population standard deviation from a sum of squared differences.
+     *
+     * @note Divides by count, for the sample standard deviation use a MeasurementAccumulator.
+     */
     float GetStandardDeviation( float &sumSquareDifferences, unsigned &count );
 
+    /**
+     * @brief Adds the measurement variable to a one pass accumulator.
+     *
+     * @param[in,out] accumulator The accumulator to add the measurement into.
+     * @post The accumulator includes this measurement.
+     */
+    void Accumulate( MeasurementAccumulator &accumulator ) const;
+
 
 private:
     unsigned INITIAL_VALUE = 0.0;   ///< Initial value for the Measurement.
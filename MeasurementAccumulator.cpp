@@ -0,0 +1,134 @@
+
+#include "MeasurementAccumulator.h"
+
+MeasurementAccumulator::MeasurementAccumulator()
+{
+    Clear();
+}
+
+MeasurementAccumulator::MeasurementAccumulator( const unsigned &count, const double &sum, const double &m2, const float &minimum, const float &maximum )
+{
+    Clear();
+    if( count > 0 )
+    {
+        m_count = count;
+        m_sum = sum;
+        m_mean = sum / count;
+        m_m2 = m2;
+        m_minimum = minimum;
+        m_maximum = maximum;
+    }
+}
+
+void MeasurementAccumulator::Add( const float &measurement )
+{
+    if( m_count == 0 || measurement < m_minimum )
+    {
+        m_minimum = measurement;
+    }
+    if( m_count == 0 || measurement > m_maximum )
+    {
+        m_maximum = measurement;
+    }
+
+    m_count ++;
+    m_sum += measurement;
+    double delta = measurement - m_mean;
+    m_mean += delta / m_count;
+    m_m2 += delta * ( measurement - m_mean );
+}
+
+void MeasurementAccumulator::Merge( const MeasurementAccumulator &other )
+{
+    if( other.m_count == 0 )
+    {
+        return;
+    }
+    if( m_count == 0 )
+    {
+        *this = other;
+        return;
+    }
+
+    double total = double( m_count ) + other.m_count;
+    double delta = other.m_mean - m_mean;
+
+    m_mean += delta * other.m_count / total;
+    m_m2 += other.m_m2 + delta * delta * m_count * other.m_count / total;
+    m_count += other.m_count;
+    m_sum += other.m_sum;
+    m_minimum = ( other.m_minimum < m_minimum ) ? other.m_minimum : m_minimum;
+    m_maximum = ( other.m_maximum > m_maximum ) ? other.m_maximum : m_maximum;
+}
+
+void MeasurementAccumulator::Clear()
+{
+    m_count = 0;
+    m_sum = 0.0;
+    m_mean = 0.0;
+    m_m2 = 0.0;
+    m_minimum = 0.0;
+    m_maximum = 0.0;
+}
+
+void MeasurementAccumulator::SetExtremes( const float &minimum, const float &maximum )
+{
+    if( m_count > 0 )
+    {
+        m_minimum = minimum;
+        m_maximum = maximum;
+    }
+}
+
+unsigned MeasurementAccumulator::GetCount() const
+{
+    return m_count;
+}
+
+double MeasurementAccumulator::GetSum() const
+{
+    return m_sum;
+}
+
+double MeasurementAccumulator::GetSumOfSquares() const
+{
+    return m_m2 + m_mean * m_mean * m_count;
+}
+
+double MeasurementAccumulator::GetM2() const
+{
+    return m_m2;
+}
+
+float MeasurementAccumulator::GetMinimum() const
+{
+    return m_minimum;
+}
+
+float MeasurementAccumulator::GetMaximum() const
+{
+    return m_maximum;
+}
+
+float MeasurementAccumulator::GetMean() const
+{
+    return m_mean;
+}
+
+float MeasurementAccumulator::GetPopulationStandardDeviation() const
+{
+    if( m_count == 0 )
+    {
+        return 0.0;
+    }
+    return sqrt( m_m2 / m_count );
+}
+
+float MeasurementAccumulator::GetSampleStandardDeviation() const
+{
+    if( m_count < 2 )
+    {
+        return 0.0;
+    }
+    return sqrt( m_m2 / ( m_count - 1 ) );
+}
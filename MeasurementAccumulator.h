@@ -0,0 +1,150 @@
+/**
+ * @file MeasurementAccumulator.h
+ * @brief Defines the MeasurementAccumulator class for one pass mean and standard deviation.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef MEASUREMENTACCUMULATOR_H_INCLUDED
+#define MEASUREMENTACCUMULATOR_H_INCLUDED
+
+#include<cmath>
+
+/**
+* @brief Represents a one pass, mergeable accumulator of measurement readings.
+*
+* Readings are accumulated with Welford's update, tracking the count, the running mean
+* and M2 ( the sum of squared differences from the running mean ), alongside the sum,
+* minimum and maximum of the readings. Two accumulators are combined with Chan's
+* parallel update, so partial results built from separate threads, chunks or files
+* can be merged into the same result as a single pass.
+*/
+class MeasurementAccumulator
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty MeasurementAccumulator with no readings.
+    */
+    MeasurementAccumulator();
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * Builds an accumulator from partial results reduced elsewhere, such as a column scan.
+    *
+    * @param[in] count The number of readings.
+    * @param[in] sum The sum of the readings.
+    * @param[in] m2 The sum of squared differences from the mean of the readings.
+    * @param[in] minimum The smallest reading.
+    * @param[in] maximum The largest reading.
+    * @post Creates a MeasurementAccumulator holding the specified readings, empty when count is 0.
+    */
+    MeasurementAccumulator( const unsigned &count, const double &sum, const double &m2, const float &minimum, const float &maximum );
+
+    /**
+    * @brief Adds a single reading to the accumulator.
+    *
+    * @param[in] measurement The reading to accumulate.
+    * @post The count, sum, mean, M2, minimum and maximum are updated to include the reading.
+    */
+    void Add( const float &measurement );
+
+    /**
+    * @brief Merges another accumulator into this accumulator.
+    *
+    * @param[in] other The accumulator holding the partial result to combine.
+    * @post This accumulator holds the result of both sets of readings.
+    */
+    void Merge( const MeasurementAccumulator &other );
+
+    /**
+    * @brief Resets the accumulator back to no readings.
+    *
+    * @post The count, sum, mean, M2, minimum and maximum are set back to zero.
+    */
+    void Clear();
+
+    /**
+    * @brief Replaces the extremes with ones found elsewhere, such as a range extremum index.
+    *
+    * @param[in] minimum The smallest reading.
+    * @param[in] maximum The largest reading.
+    * @post The minimum and maximum are set, keeping the count, sum, mean and M2. No change when there are no readings.
+    */
+    void SetExtremes( const float &minimum, const float &maximum );
+
+    /**
+    * @brief Getter for the number of accumulated readings.
+    *
+    * @return The number of readings.
+    */
+    unsigned GetCount() const;
+
+    /**
+    * @brief Getter for the sum of the accumulated readings.
+    *
+    * @return The sum of the readings, kept in double precision.
+    */
+    double GetSum() const;
+
+    /**
+    * @brief Getter for the sum of squares of the accumulated readings.
+    *
+    * @return The sum of each reading squared.
+    */
+    double GetSumOfSquares() const;
+
+    /**
+    * @brief Getter for M2 of the accumulated readings.
+    *
+    * @return The sum of squared differences from the mean of the readings.
+    */
+    double GetM2() const;
+
+    /**
+    * @brief Getter for the smallest accumulated reading.
+    *
+    * @return The minimum reading, 0 when there are no readings.
+    */
+    float GetMinimum() const;
+
+    /**
+    * @brief Getter for the largest accumulated reading.
+    *
+    * @return The maximum reading, 0 when there are no readings.
+    */
+    float GetMaximum() const;
+
+    /**
+    * @brief Getter for the mean of the accumulated readings.
+    *
+    * @return The mean of the readings, 0 when there are no readings.
+    */
+    float GetMean() const;
+
+    /**
+    * @brief Calculates the population standard deviation ( divided by n ).
+    *
+    * @return The population standard deviation, 0 when there are no readings.
+    */
+    float GetPopulationStandardDeviation() const;
+
+    /**
+    * @brief Calculates the sample standard deviation ( divided by n - 1 ).
+    *
+    * @return The sample standard deviation, 0 when there are fewer than two readings.
+    */
+    float GetSampleStandardDeviation() const;
+
+private:
+    unsigned m_count;   ///< Number of accumulated readings.
+    double m_sum;       ///< Sum of the readings.
+    double m_mean;      ///< Running mean of the readings.
+    double m_m2;        ///< Sum of squared differences from the running mean.
+    float m_minimum;    ///< Smallest reading.
+    float m_maximum;    ///< Largest reading.
+};
+
+#endif // MEASUREMENTACCUMULATOR_H_INCLUDED
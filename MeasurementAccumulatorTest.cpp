@@ -0,0 +1,146 @@
+
+#include<iostream>
+
+#include "MeasurementAccumulator.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+bool IsClose( const float &actual, const float &expected );
+void TestInitialization( const MeasurementAccumulator &accumulator );
+void TestOnePassStatistics( const MeasurementAccumulator &accumulator );
+void TestMergePartialResults( const MeasurementAccumulator &accumulator, const float readings[], const unsigned &size );
+void TestLargeOffsetStability();
+void TestDoublePrecisionSum();
+void TestSetExtremes();
+
+int main()
+{
+    const unsigned size = 8;
+    float readings[size] = { 2, 4, 4, 4, 5, 5, 7, 9 };
+    MeasurementAccumulator emptyAccumulator;
+    MeasurementAccumulator accumulator;
+
+    for( unsigned i(0); i<size; i++ )
+    {
+        accumulator.Add( readings[i] );
+    }
+
+    TestInitialization( emptyAccumulator );
+    TestOnePassStatistics( accumulator );
+    TestMergePartialResults( accumulator, readings, size );
+    TestLargeOffsetStability();
+    TestDoublePrecisionSum();
+    TestSetExtremes();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+bool IsClose( const float &actual, const float &expected )
+{
+    return fabs( actual - expected ) < 0.0001;
+}
+
+void TestInitialization( const MeasurementAccumulator &accumulator )
+{
+    cout << "Test on Default MeasurementAccumulator Object" << endl;
+    Assert( accumulator.GetCount() == 0, "Default count set as 0" );
+    Assert( accumulator.GetMean() == 0.0, "Default mean set as 0.0" );
+    Assert( accumulator.GetSampleStandardDeviation() == 0.0, "Sample stdev of no readings is 0.0" );
+    cout << endl;
+}
+
+void TestOnePassStatistics( const MeasurementAccumulator &accumulator )
+{
+    cout << "Test on one pass mean and standard deviation" << endl;
+    Assert( accumulator.GetCount() == 8, "Count accumulated to be 8" );
+    Assert( IsClose( accumulator.GetSum(), 40 ), "Sum accumulated to be 40" );
+    Assert( IsClose( accumulator.GetMean(), 5 ), "Mean accumulated to be 5" );
+    Assert( IsClose( accumulator.GetPopulationStandardDeviation(), 2 ), "Population stdev calculated to be 2" );
+    Assert( IsClose( accumulator.GetSampleStandardDeviation(), sqrt( 32.0 / 7 ) ), "Sample stdev calculated to be sqrt(32/7)" );
+    cout << endl;
+}
+
+void TestMergePartialResults( const MeasurementAccumulator &accumulator, const float readings[], const unsigned &size )
+{
+    MeasurementAccumulator firstHalf;
+    MeasurementAccumulator secondHalf;
+    MeasurementAccumulator empty;
+
+    for( unsigned i(0); i<size; i++ )
+    {
+        if( i < 3 )
+        {
+            firstHalf.Add( readings[i] );
+        }
+        else
+        {
+            secondHalf.Add( readings[i] );
+        }
+    }
+    firstHalf.Merge( secondHalf );
+    firstHalf.Merge( empty );
+    empty.Merge( firstHalf );
+
+    cout << "Test on merging partial accumulators" << endl;
+    Assert( firstHalf.GetCount() == accumulator.GetCount(), "Merged count matches single pass" );
+    Assert( IsClose( firstHalf.GetMean(), accumulator.GetMean() ), "Merged mean matches single pass" );
+    Assert( IsClose( firstHalf.GetSampleStandardDeviation(), accumulator.GetSampleStandardDeviation() ), "Merged sample stdev matches single pass" );
+    Assert( IsClose( empty.GetSampleStandardDeviation(), accumulator.GetSampleStandardDeviation() ), "Merging into an empty accumulator copies the result" );
+    cout << endl;
+}
+
+void TestLargeOffsetStability()
+{
+    MeasurementAccumulator accumulator;
+
+    accumulator.Add( 100000.5 );
+    accumulator.Add( 100001.5 );
+    accumulator.Add( 100002.5 );
+
+    cout << "Test on stability of readings with a large offset" << endl;
+    Assert( IsClose( accumulator.GetSampleStandardDeviation(), 1 ), "Sample stdev of offset readings is 1" );
+    cout << endl;
+}
+
+void TestDoublePrecisionSum()
+{
+    MeasurementAccumulator accumulator;
+
+    // 2^24 + 1 is not representable as a float, so a float sum would drop the second reading
+    accumulator.Add( 16777216 );
+    accumulator.Add( 1 );
+
+    cout << "Test on the sum kept in double precision" << endl;
+    Assert( accumulator.GetSum() == 16777217.0, "Sum of 2^24 and 1 is 2^24 + 1" );
+    cout << endl;
+}
+
+void TestSetExtremes()
+{
+    MeasurementAccumulator empty;
+    MeasurementAccumulator accumulator;
+
+    accumulator.Add( 16777216 );
+    accumulator.Add( 1 );
+    accumulator.SetExtremes( 0, 20000000 );
+    empty.SetExtremes( 1, 2 );
+
+    cout << "Test on setting the extremes" << endl;
+    Assert( accumulator.GetMinimum() == 0 && accumulator.GetMaximum() == 20000000, "Extremes are replaced" );
+    Assert( accumulator.GetCount() == 2 && accumulator.GetSum() == 16777217.0, "Count and double sum are kept" );
+    Assert( empty.GetMinimum() == 0 && empty.GetMaximum() == 0, "An empty accumulator keeps no extremes" );
+    cout << endl;
+}
@@ -0,0 +1,130 @@
+/**
+ * @file MeasurementTag.h
+ * @brief Defines the measurement tags used to pick a measurement of a wind record at compile time.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef MEASUREMENTTAG_H_INCLUDED
+#define MEASUREMENTTAG_H_INCLUDED
+
+#include "WindRecType.h"
+#include "MeasurementType.h"
+#include "SensorRegistry.h"
+
+/**
+* @brief Tag selecting the wind speed of a wind record.
+*/
+struct WindSpeedTag
+{
+    static constexpr MeasurementType TYPE = MeasurementType::WINDSPEED;     ///< Runtime measurement type of the tag.
+
+    /**
+    * @brief Reads the wind speed of a wind record.
+    *
+    * @param[in] windRecType The wind record.
+    * @return The wind speed measurement.
+    */
+    static float Get( const WindRecType &windRecType )
+    {
+        return windRecType.GetRecordWindSpeed().GetMeasurement();
+    }
+
+    /**
+    * @brief Gets the code of the wind speed sensor, which names its column in a SensorRegistry.
+    *
+    * @return The sensor code.
+    */
+    static const string &GetCode()
+    {
+        return SensorRegistry::WINDSPEED_CODE;
+    }
+};
+
+/**
+* @brief Tag selecting the temperature of a wind record.
+*/
+struct TemperatureTag
+{
+    static constexpr MeasurementType TYPE = MeasurementType::TEMPERATURE;   ///< Runtime measurement type of the tag.
+
+    /**
+    * @brief Reads the temperature of a wind record.
+    *
+    * @param[in] windRecType The wind record.
+    * @return The temperature measurement.
+    */
+    static float Get( const WindRecType &windRecType )
+    {
+        return windRecType.GetRecordTemperature().GetMeasurement();
+    }
+
+    /**
+    * @brief Gets the code of the temperature sensor, which names its column in a SensorRegistry.
+    *
+    * @return The sensor code.
+    */
+    static const string &GetCode()
+    {
+        return SensorRegistry::TEMPERATURE_CODE;
+    }
+};
+
+/**
+* @brief Tag selecting the solar radiation of a wind record.
+*/
+struct SolarRadiationTag
+{
+    static constexpr MeasurementType TYPE = MeasurementType::SOLARRADIATION;    ///< Runtime measurement type of the tag.
+
+    /**
+    * @brief Reads the solar radiation of a wind record.
+    *
+    * @param[in] windRecType The wind record.
+    * @return The solar radiation measurement.
+    */
+    static float Get( const WindRecType &windRecType )
+    {
+        return windRecType.GetRecordSolarRadiation().GetMeasurement();
+    }
+
+    /**
+    * @brief Gets the code of the solar radiation sensor, which names its column in a SensorRegistry.
+    *
+    * @return The sensor code.
+    */
+    static const string &GetCode()
+    {
+        return SensorRegistry::SOLARRADIATION_CODE;
+    }
+};
+
+/**
+* @brief Converts a runtime measurement type into its tag, once, outside of any loop.
+*
+* Calls function with a WindSpeedTag, TemperatureTag or SolarRadiationTag object, so the
+* function body is instantiated once per measurement and its loops carry no switch.
+*
+* @param[in] measurementType Type of measurement.
+* @param[in] function Generic callable taking the tag object.
+* @return false if the measurement type is invalid, true otherwise.
+*/
+template<class Function>
+bool DispatchMeasurement( MeasurementType measurementType, Function function )
+{
+    switch( measurementType )
+    {
+    case MeasurementType::WINDSPEED:
+        function( WindSpeedTag() );
+        return true;
+    case MeasurementType::TEMPERATURE:
+        function( TemperatureTag() );
+        return true;
+    case MeasurementType::SOLARRADIATION:
+        function( SolarRadiationTag() );
+        return true;
+    default:
+        return false;
+    }
+}
+
+#endif // MEASUREMENTTAG_H_INCLUDED
@@ -0,0 +1,82 @@
+#include<iostream>
+
+#include "MeasurementTag.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestTagReadings( const WindRecType &windRecType );
+void TestTagTypes();
+void TestDispatch( const WindRecType &windRecType );
+
+int main()
+{
+    WindRecType windRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 6 ), SolarRadiation( 512 ), Temperature( 20.5 ) );
+
+    TestTagReadings( windRecType );
+    TestTagTypes();
+    TestDispatch( windRecType );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestTagReadings( const WindRecType &windRecType )
+{
+    cout << "Test on tag readings" << endl;
+    Assert( WindSpeedTag::Get( windRecType ) == 6, "WindSpeedTag reads the wind speed" );
+    Assert( TemperatureTag::Get( windRecType ) == 20.5, "TemperatureTag reads the temperature" );
+    Assert( SolarRadiationTag::Get( windRecType ) == 512, "SolarRadiationTag reads the solar radiation" );
+    cout << endl;
+}
+
+void TestTagTypes()
+{
+    cout << "Test on tag measurement types" << endl;
+    Assert( WindSpeedTag::TYPE == MeasurementType::WINDSPEED, "WindSpeedTag is WINDSPEED" );
+    Assert( TemperatureTag::TYPE == MeasurementType::TEMPERATURE, "TemperatureTag is TEMPERATURE" );
+    Assert( SolarRadiationTag::TYPE == MeasurementType::SOLARRADIATION, "SolarRadiationTag is SOLARRADIATION" );
+    Assert( WindSpeedTag::GetCode() == SensorRegistry::WINDSPEED_CODE && TemperatureTag::GetCode() == SensorRegistry::TEMPERATURE_CODE
+            && SolarRadiationTag::GetCode() == SensorRegistry::SOLARRADIATION_CODE, "Each tag names the column of its sensor" );
+    cout << endl;
+}
+
+void TestDispatch( const WindRecType &windRecType )
+{
+    MeasurementType types[] = { MeasurementType::WINDSPEED, MeasurementType::TEMPERATURE, MeasurementType::SOLARRADIATION };
+    float expected[] = { 6, 20.5, 512 };
+
+    cout << "Test on DispatchMeasurement" << endl;
+    for( unsigned i(0); i < 3; i++ )
+    {
+        MeasurementType dispatchedType = MeasurementType::WINDSPEED;
+        float reading = 0;
+        bool dispatched = DispatchMeasurement( types[i], [&]( auto tag )
+        {
+            dispatchedType = decltype( tag )::TYPE;
+            reading = decltype( tag )::Get( windRecType );
+        } );
+
+        Assert( dispatched && dispatchedType == types[i], "Dispatch picks the tag of the runtime type" );
+        Assert( reading == expected[i], "Dispatched tag reads the matching measurement" );
+    }
+
+    bool called = false;
+    bool dispatched = DispatchMeasurement( MeasurementType( 7 ), [&]( auto )
+    {
+        called = true;
+    } );
+    Assert( !dispatched && !called, "Dispatch rejects an invalid type" );
+    cout << endl;
+}
@@ -8,6 +8,4 @@ enum class MeasurementType
     SOLARRADIATION
 };
 
-//using MeanFunctionPtr = float (Measurement::*)(float&, unsigned&);
-
 #endif // MEASUREMENTTYPE_H_INCLUDED
@@ -0,0 +1,92 @@
+
+#include "OutputBuffer.h"
+
+#include<charconv>
+
+#include "Date.h"
+
+const unsigned OutputBuffer::DEFAULT_CAPACITY;
+const int OutputBuffer::DEFAULT_PRECISION;
+
+OutputBuffer::OutputBuffer( ostream &output, const unsigned &capacity )
+    : m_output( output ), m_capacity( capacity )
+{
+    m_buffer.reserve( m_capacity );
+}
+
+OutputBuffer::~OutputBuffer()
+{
+    Flush();
+}
+
+OutputBuffer &OutputBuffer::Append( string_view text )
+{
+    m_buffer.append( text.data(), text.size() );
+    FlushIfFull();
+    return *this;
+}
+
+OutputBuffer &OutputBuffer::Append( const char &character )
+{
+    m_buffer.push_back( character );
+    FlushIfFull();
+    return *this;
+}
+
+OutputBuffer &OutputBuffer::Append( const unsigned &value )
+{
+    char digits[16];
+
+    m_buffer.append( digits, std::to_chars( digits, digits + sizeof( digits ), value ).ptr );
+    FlushIfFull();
+    return *this;
+}
+
+OutputBuffer &OutputBuffer::Append( const float &value, const int &precision )
+{
+    char digits[32];
+
+    m_buffer.append( digits, std::to_chars( digits, digits + sizeof( digits ), value, std::chars_format::general, precision ).ptr );
+    FlushIfFull();
+    return *this;
+}
+
+OutputBuffer &OutputBuffer::AppendSpaces( const unsigned &count )
+{
+    m_buffer.append( count, ' ' );
+    FlushIfFull();
+    return *this;
+}
+
+OutputBuffer &OutputBuffer::AppendMonth( const unsigned &month )
+{
+    return Append( Date::GetMonthName( month ) );
+}
+
+void OutputBuffer::Flush()
+{
+    if( m_buffer.empty() )
+    {
+        return;
+    }
+    m_output.write( m_buffer.data(), streamsize( m_buffer.size() ) );
+    m_output.flush();
+    m_buffer.clear();
+}
+
+const string &OutputBuffer::GetContents() const
+{
+    return m_buffer;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void OutputBuffer::FlushIfFull()
+{
+    if( m_buffer.size() < m_capacity )
+    {
+        return;
+    }
+    m_output.write( m_buffer.data(), streamsize( m_buffer.size() ) );
+    m_buffer.clear();
+}
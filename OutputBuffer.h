@@ -0,0 +1,121 @@
+/**
+ * @file OutputBuffer.h
+ * @brief Defines the OutputBuffer class, which formats text into a reusable buffer and writes it to a stream at once.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef OUTPUTBUFFER_H_INCLUDED
+#define OUTPUTBUFFER_H_INCLUDED
+
+#include<iostream>
+#include<string>
+#include<string_view>
+
+using namespace std;
+
+/**
+* @brief Collects formatted output in one reusable buffer and writes it to a stream with a single write.
+*
+* Numbers are formatted with std::to_chars, and padding and month names are appended directly,
+* so no stream state such as setw or setprecision is involved. Nothing reaches the stream until
+* Flush(), which is called once per report, or when the buffer grows past its capacity, so a long
+* report is written in a few large writes instead of one flush per line. The destructor flushes
+* whatever is left.
+*/
+class OutputBuffer
+{
+public:
+    static const unsigned DEFAULT_CAPACITY = 16384;     ///< Default size of the buffer, in bytes.
+    static const int DEFAULT_PRECISION = 6;             ///< Significant digits of a default output stream.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] output The stream the buffer is written to.
+    * @param[in] capacity The size the buffer is allocated with, and flushed beyond.
+    */
+    OutputBuffer( ostream &output, const unsigned &capacity = DEFAULT_CAPACITY );
+
+    /**
+    * @brief Destructor, flushing what is left in the buffer.
+    */
+    ~OutputBuffer();
+
+    OutputBuffer( const OutputBuffer & ) = delete;
+    OutputBuffer &operator = ( const OutputBuffer & ) = delete;
+
+    /**
+    * @brief Appends text.
+    *
+    * @param[in] text The text.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &Append( string_view text );
+
+    /**
+    * @brief Appends a character.
+    *
+    * @param[in] character The character.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &Append( const char &character );
+
+    /**
+    * @brief Appends an unsigned number.
+    *
+    * @param[in] value The number.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &Append( const unsigned &value );
+
+    /**
+    * @brief Appends a number to a number of significant digits, as setprecision() does on a default stream.
+    *
+    * @param[in] value The number.
+    * @param[in] precision The number of significant digits.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &Append( const float &value, const int &precision = DEFAULT_PRECISION );
+
+    /**
+    * @brief Appends blanks, as setw( count ) << " " does.
+    *
+    * @param[in] count The number of blanks.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &AppendSpaces( const unsigned &count );
+
+    /**
+    * @brief Appends the name of a month from the Date month table.
+    *
+    * @param[in] month The month between 1 ~ 12.
+    * @return This buffer, for chaining.
+    */
+    OutputBuffer &AppendMonth( const unsigned &month );
+
+    /**
+    * @brief Writes the buffer to the stream with one write, flushes the stream and empties the buffer.
+    *
+    * Does nothing when the buffer is empty.
+    */
+    void Flush();
+
+    /**
+    * @brief Getter for the text not yet written.
+    *
+    * @return The buffered text.
+    */
+    const string &GetContents() const;
+
+private:
+    ostream &m_output;      ///< Stream the buffer is written to.
+    string m_buffer;        ///< Text not yet written.
+    unsigned m_capacity;    ///< Size of the buffer, flushed beyond.
+
+    /**
+    * @brief Writes the buffer out once it has grown past its capacity.
+    */
+    void FlushIfFull();
+};
+
+#endif // OUTPUTBUFFER_H_INCLUDED
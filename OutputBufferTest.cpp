@@ -0,0 +1,102 @@
+#include<iostream>
+#include<sstream>
+#include<iomanip>
+
+#include "OutputBuffer.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestFormatting();
+void TestMonthNames();
+void TestFlush();
+void TestCapacity();
+
+int main()
+{
+    TestFormatting();
+    TestMonthNames();
+    TestFlush();
+    TestCapacity();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestFormatting()
+{
+    ostringstream stream;
+    ostringstream expected;
+    OutputBuffer outputBuffer( stream );
+    const float values[] = { 0.0f, 4.0f, 3.14159265f, 12.3456f, 0.000123f, 1234567.0f, -5.5f };
+
+    for( float value : values )
+    {
+        outputBuffer.Append( value ).Append( ',' ).Append( value, 3 ).Append( ',' ).Append( value, 4 ).Append( '\n' );
+        expected << value << ',' << setprecision(3) << value << ',' << setprecision(4) << value << setprecision(6) << '\n';
+    }
+    outputBuffer.AppendSpaces( 7 ).Append( 2015u ).Append( ":" );
+    expected << setw(7) << " " << 2015 << ":";
+
+    cout << "Test on formatting" << endl;
+    Assert( outputBuffer.GetContents() == expected.str(), "Numbers match the default stream formatting" );
+    cout << endl;
+}
+
+void TestMonthNames()
+{
+    ostringstream stream;
+    OutputBuffer outputBuffer( stream );
+
+    outputBuffer.AppendMonth( 1 ).Append( ' ' ).AppendMonth( 12 );
+
+    cout << "Test on month names" << endl;
+    Assert( outputBuffer.GetContents() == "January December", "Month names come from the month table" );
+    cout << endl;
+}
+
+void TestFlush()
+{
+    ostringstream stream;
+    OutputBuffer outputBuffer( stream );
+
+    outputBuffer.Append( "March: " ).Append( 4.5f, 3 ).Append( '\n' );
+    bool heldBack = stream.str().empty();
+    outputBuffer.Flush();
+
+    cout << "Test on flushing" << endl;
+    Assert( heldBack, "Nothing is written before the flush" );
+    Assert( stream.str() == "March: 4.5\n" && outputBuffer.GetContents().empty(), "The flush writes the buffer and empties it" );
+    {
+        OutputBuffer scopedBuffer( stream );
+        scopedBuffer.Append( "April" );
+    }
+    Assert( stream.str() == "March: 4.5\nApril", "The destructor writes what is left" );
+    cout << endl;
+}
+
+void TestCapacity()
+{
+    ostringstream stream;
+    OutputBuffer outputBuffer( stream, 16 );
+
+    outputBuffer.Append( "0123456789" );
+    bool heldBack = stream.str().empty();
+    outputBuffer.Append( "0123456789" );
+
+    cout << "Test on capacity" << endl;
+    Assert( heldBack, "Text under the capacity is held back" );
+    Assert( stream.str().size() == 20 && outputBuffer.GetContents().empty(), "The buffer is written once it reaches its capacity" );
+    cout << endl;
+}
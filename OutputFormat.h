@@ -0,0 +1,14 @@
+#ifndef OUTPUTFORMAT_H_INCLUDED
+#define OUTPUTFORMAT_H_INCLUDED
+
+/**
+* @brief Format the records of query answers are written in.
+*/
+enum class OutputFormat
+{
+    TEXT,       ///< One line of tab separated key=value fields per record.
+    JSON,       ///< One JSON array holding an object per record.
+    NDJSON      ///< One JSON object per line per record.
+};
+
+#endif // OUTPUTFORMAT_H_INCLUDED
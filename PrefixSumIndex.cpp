@@ -0,0 +1,158 @@
+
+#include<algorithm>
+
+#include "PrefixSumIndex.h"
+
+const unsigned PrefixSumIndex::MEASUREMENT_TYPES;
+
+PrefixSumIndex::PrefixSumIndex()
+{
+    for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+    {
+        m_sums[i].InsertLast( 0.0 );
+        m_sumsOfSquares[i].InsertLast( 0.0 );
+        m_shifts[i] = 0.0;
+    }
+    m_built = true;
+}
+
+void PrefixSumIndex::Append( const WindRecType &windRecType )
+{
+    Row row;
+    row.timestamp = Timestamp::Pack( windRecType.GetRecordDate(), windRecType.GetRecordTime() );
+    row.readings[unsigned( MeasurementType::WINDSPEED )] = windRecType.GetRecordWindSpeed().GetMeasurement();
+    row.readings[unsigned( MeasurementType::TEMPERATURE )] = windRecType.GetRecordTemperature().GetMeasurement();
+    row.readings[unsigned( MeasurementType::SOLARRADIATION )] = windRecType.GetRecordSolarRadiation().GetMeasurement();
+
+    if( m_rows.IsEmpty() )
+    {
+        for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+        {
+            m_shifts[i] = row.readings[i];
+        }
+    }
+    else if( row.timestamp < m_rows[m_rows.GetUsed() - 1].timestamp )
+    {
+        m_built = false;
+    }
+
+    m_rows.InsertLast( row );
+    if( m_built )
+    {
+        ExtendPrefixSums( row );
+    }
+}
+
+void PrefixSumIndex::Build()
+{
+    if( m_built )
+    {
+        return;
+    }
+
+    std::stable_sort( m_rows.Start(), m_rows.Finish(), []( const Row &left, const Row &right )
+    {
+        return left.timestamp < right.timestamp;
+    } );
+
+    for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+    {
+        m_sums[i].SetSize( 1 );
+        m_sumsOfSquares[i].SetSize( 1 );
+    }
+    for( unsigned row(0); row < m_rows.GetUsed(); row++ )
+    {
+        ExtendPrefixSums( m_rows[row] );
+    }
+    m_built = true;
+}
+
+void PrefixSumIndex::Clear()
+{
+    m_rows.SetSize( 0 );
+    for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+    {
+        m_sums[i].SetSize( 1 );
+        m_sumsOfSquares[i].SetSize( 1 );
+        m_shifts[i] = 0.0;
+    }
+    m_built = true;
+}
+
+bool PrefixSumIndex::IsBuilt() const
+{
+    return m_built;
+}
+
+unsigned PrefixSumIndex::GetUsed() const
+{
+    return m_rows.GetUsed();
+}
+
+unsigned PrefixSumIndex::GetTimestampAt( const unsigned &index ) const
+{
+    return m_rows[index].timestamp;
+}
+
+float PrefixSumIndex::GetReadingAt( const unsigned &index, MeasurementType measurementType ) const
+{
+    return m_rows[index].readings[unsigned( measurementType )];
+}
+
+unsigned PrefixSumIndex::LowerBound( const unsigned &timestamp ) const
+{
+    unsigned low = 0;
+    unsigned high = m_rows.GetUsed();
+
+    while( low < high )
+    {
+        unsigned middle = low + ( high - low ) / 2;
+        if( m_rows[middle].timestamp < timestamp )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+MeasurementAccumulator PrefixSumIndex::GetRangeSummary( const unsigned &start, const unsigned &end, MeasurementType measurementType ) const
+{
+    // The prefix sums stop at the first row appended out of order, until Build() sorts the rows again
+    if( end <= start || !m_built )
+    {
+        return MeasurementAccumulator();
+    }
+
+    unsigned type = unsigned( measurementType );
+    unsigned first = LowerBound( start );
+    unsigned last = LowerBound( end );
+    unsigned count = last - first;
+    if( count == 0 )
+    {
+        return MeasurementAccumulator();
+    }
+
+    double shiftedSum = m_sums[type][last] - m_sums[type][first];
+    double shiftedSumOfSquares = m_sumsOfSquares[type][last] - m_sumsOfSquares[type][first];
+    double m2 = shiftedSumOfSquares - shiftedSum * shiftedSum / count;
+
+    return MeasurementAccumulator( count, shiftedSum + m_shifts[type] * count, ( m2 > 0.0 ) ? m2 : 0.0, 0.0f, 0.0f );
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void PrefixSumIndex::ExtendPrefixSums( const Row &row )
+{
+    for( unsigned i(0); i < MEASUREMENT_TYPES; i++ )
+    {
+        double shifted = row.readings[i] - m_shifts[i];
+        unsigned used = m_sums[i].GetUsed();
+
+        m_sums[i].InsertLast( m_sums[i][used - 1] + shifted );
+        m_sumsOfSquares[i].InsertLast( m_sumsOfSquares[i][used - 1] + shifted * shifted );
+    }
+}
@@ -0,0 +1,136 @@
+/**
+ * @file PrefixSumIndex.h
+ * @brief Defines the PrefixSumIndex class for constant time aggregation over any time range.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef PREFIXSUMINDEX_H_INCLUDED
+#define PREFIXSUMINDEX_H_INCLUDED
+
+#include "Vector.h"
+#include "WindRecType.h"
+#include "MeasurementType.h"
+#include "MeasurementAccumulator.h"
+#include "Timestamp.h"
+
+/**
+* @brief Represents a time ordered index of cumulative count, sum and sum of squares of each measurement.
+*
+* Each record is keyed by its packed Timestamp. Once the rows are in time order, the sums of any
+* [start, end) range are the difference of two prefix entries, so a range summary costs two binary
+* searches and no rescan of the records. The prefix sums are kept about the first reading of each
+* measurement, which keeps the sum of squares small enough for the variance not to cancel out.
+*
+* Records appended in time order extend the prefix sums directly. A record older than the last one
+* marks the index as not built, and Build() must be called before it is queried again. Until then a
+* range summary is empty.
+*/
+class PrefixSumIndex
+{
+public:
+    static const unsigned MEASUREMENT_TYPES = 3;    ///< Number of measurement types indexed.
+
+    /**
+    * @brief Default constructor.
+    * @post Creates an empty, built PrefixSumIndex.
+    */
+    PrefixSumIndex();
+
+    /**
+    * @brief Appends a wind record to the index.
+    *
+    * @param[in] windRecType The wind record to append.
+    * @post The prefix sums include the record, or the index is marked as not built when the record is out of time order.
+    */
+    void Append( const WindRecType &windRecType );
+
+    /**
+    * @brief Sorts the rows by timestamp and rebuilds the prefix sums, if any row was appended out of order.
+    * @post The index is built and can be queried.
+    */
+    void Build();
+
+    /**
+    * @brief Removes every row from the index.
+    * @post The index is empty and built.
+    */
+    void Clear();
+
+    /**
+    * @brief Checks whether the index can be queried.
+    *
+    * @return false if a row was appended out of time order since the last Build(), true otherwise.
+    */
+    bool IsBuilt() const;
+
+    /**
+    * @brief Getter for the number of indexed rows.
+    *
+    * @return The number of rows.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the timestamp of a row.
+    *
+    * @param[in] index The row, in time order.
+    * @return The packed timestamp of the row.
+    */
+    unsigned GetTimestampAt( const unsigned &index ) const;
+
+    /**
+    * @brief Getter for a reading of a row.
+    *
+    * @param[in] index The row, in time order.
+    * @param[in] measurementType Type of measurement.
+    * @return The reading of the measurement in the row.
+    */
+    float GetReadingAt( const unsigned &index, MeasurementType measurementType ) const;
+
+    /**
+    * @brief Finds the first row at or after a timestamp.
+    *
+    * @param[in] timestamp The packed timestamp to search for.
+    * @return The index of the first row not earlier than timestamp, GetUsed() if there is none.
+    * @pre IsBuilt() is true.
+    */
+    unsigned LowerBound( const unsigned &timestamp ) const;
+
+    /**
+    * @brief Summarises a measurement over a time range.
+    *
+    * The prefix sums carry no extremes, so the minimum and maximum of the result are 0.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @return The count, sum and M2 of the readings in the range, empty if the index is not built.
+    */
+    MeasurementAccumulator GetRangeSummary( const unsigned &start, const unsigned &end, MeasurementType measurementType ) const;
+
+private:
+
+    /**
+    * @brief One indexed record: its timestamp and its readings, indexed by MeasurementType.
+    */
+    struct Row
+    {
+        unsigned timestamp;
+        float readings[MEASUREMENT_TYPES];
+    };
+
+    Vector<Row> m_rows;                                         ///< Rows, in time order once built.
+    Vector<double> m_sums[MEASUREMENT_TYPES];                   ///< Prefix sums of the shifted readings, with a leading 0.
+    Vector<double> m_sumsOfSquares[MEASUREMENT_TYPES];          ///< Prefix sums of the squared shifted readings, with a leading 0.
+    double m_shifts[MEASUREMENT_TYPES];                         ///< Reading subtracted before summing, the first reading of each measurement.
+    bool m_built;                                               ///< False while rows are out of time order.
+
+    /**
+    * @brief Extends the prefix sums with a row.
+    *
+    * @param[in] row The row following the last summed row.
+    */
+    void ExtendPrefixSums( const Row &row );
+};
+
+#endif // PREFIXSUMINDEX_H_INCLUDED
@@ -0,0 +1,99 @@
+#include<iostream>
+#include<cmath>
+
+#include "PrefixSumIndex.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestInitialization( const PrefixSumIndex &prefixSumIndex );
+void TestRangeSummary( const PrefixSumIndex &prefixSumIndex );
+void TestOutOfOrderAppend();
+void TestClear( PrefixSumIndex &prefixSumIndex );
+
+int main()
+{
+    PrefixSumIndex emptyIndex;
+    PrefixSumIndex prefixSumIndex;
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 100 ), Temperature( 20 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 4 ), SolarRadiation( 200 ), Temperature( 22 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 2, 3, 2016 ), Time( 9, 0 ), WindSpeed( 6 ), SolarRadiation( 300 ), Temperature( 24 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 3, 3, 2016 ), Time( 9, 0 ), WindSpeed( 8 ), SolarRadiation( 400 ), Temperature( 26 ) ) );
+
+    TestInitialization( emptyIndex );
+    TestRangeSummary( prefixSumIndex );
+    TestOutOfOrderAppend();
+    TestClear( prefixSumIndex );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestInitialization( const PrefixSumIndex &prefixSumIndex )
+{
+    cout << "Test on Default PrefixSumIndex Object" << endl;
+    Assert( prefixSumIndex.GetUsed() == 0, "Default PrefixSumIndex has no rows" );
+    Assert( prefixSumIndex.IsBuilt(), "Default PrefixSumIndex is built" );
+    Assert( prefixSumIndex.GetRangeSummary( 0, 4000000000u, MeasurementType::WINDSPEED ).GetCount() == 0, "Default PrefixSumIndex has an empty range" );
+    cout << endl;
+}
+
+void TestRangeSummary( const PrefixSumIndex &prefixSumIndex )
+{
+    unsigned firstDay = Timestamp::Pack( 1, 3, 2016 );
+    unsigned secondDay = Timestamp::Pack( 2, 3, 2016 );
+    unsigned fourthDay = Timestamp::Pack( 4, 3, 2016 );
+
+    MeasurementAccumulator all = prefixSumIndex.GetRangeSummary( firstDay, fourthDay, MeasurementType::WINDSPEED );
+    MeasurementAccumulator first = prefixSumIndex.GetRangeSummary( firstDay, secondDay, MeasurementType::SOLARRADIATION );
+    MeasurementAccumulator later = prefixSumIndex.GetRangeSummary( secondDay, fourthDay, MeasurementType::TEMPERATURE );
+
+    cout << "Test on range summaries" << endl;
+    Assert( prefixSumIndex.IsBuilt() && prefixSumIndex.GetUsed() == 4, "Index in time order is built with 4 rows" );
+    Assert( all.GetCount() == 4 && all.GetMean() == 5, "Whole range of wind speed has mean 5" );
+    Assert( fabs( all.GetSampleStandardDeviation() - sqrt( 20.0 / 3.0 ) ) < 1e-5, "Whole range of wind speed has sample stdev sqrt(20/3)" );
+    Assert( first.GetCount() == 2 && first.GetSum() == 300, "First day of solar radiation sums to 300" );
+    Assert( later.GetCount() == 2 && later.GetMean() == 25, "End of the range is excluded and start included" );
+    Assert( fabs( later.GetPopulationStandardDeviation() - 1.0 ) < 1e-5, "Later temperature has population stdev 1" );
+    Assert( prefixSumIndex.GetRangeSummary( fourthDay, firstDay, MeasurementType::WINDSPEED ).GetCount() == 0, "Reversed range is empty" );
+    cout << endl;
+}
+
+void TestOutOfOrderAppend()
+{
+    PrefixSumIndex prefixSumIndex;
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 1, 2016 ), Time( 0, 0 ), WindSpeed( 10 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 1, 1, 2015 ), Time( 0, 0 ), WindSpeed( 20 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+
+    cout << "Test on out of order append" << endl;
+    Assert( !prefixSumIndex.IsBuilt(), "Out of order append leaves the index unbuilt" );
+    Assert( prefixSumIndex.GetRangeSummary( 0, 4000000000u, MeasurementType::WINDSPEED ).GetCount() == 0, "An unbuilt index has an empty range" );
+    prefixSumIndex.Build();
+    Assert( prefixSumIndex.IsBuilt(), "Build() builds the index" );
+    Assert( prefixSumIndex.GetTimestampAt( 0 ) < prefixSumIndex.GetTimestampAt( 1 ), "Build() sorts the rows by timestamp" );
+    Assert( prefixSumIndex.GetRangeSummary( Timestamp::Pack( 1, 1, 2015 ), Timestamp::Pack( 1, 1, 2016 ), MeasurementType::WINDSPEED ).GetSum() == 20, "2015 holds the record appended second" );
+    cout << endl;
+}
+
+void TestClear( PrefixSumIndex &prefixSumIndex )
+{
+    prefixSumIndex.Clear();
+
+    cout << "Test on Clear" << endl;
+    Assert( prefixSumIndex.GetUsed() == 0, "Cleared PrefixSumIndex has no rows" );
+    Assert( prefixSumIndex.GetRangeSummary( 0, 4000000000u, MeasurementType::WINDSPEED ).GetCount() == 0, "Cleared PrefixSumIndex has an empty range" );
+    cout << endl;
+}
@@ -7,12 +7,58 @@ Processor::Processor()
 {
     m_dataRead = 0;
     m_dataInserted = 0;
+    m_dataVersion = 0;
+}
+
+void Processor::ReadCSVFiles( Vector<string> &csvFilePath, WindRecType &windRecType, SensorRegistry &sensorRegistry, const std::function<bool( const WindRecType & )> &append )
+{
+    for( unsigned i(0); i<csvFilePath.GetUsed(); i++ )
+    {
+        string modifiedFilePath = "data/" + csvFilePath[i];
+        ifstream CSVFile( modifiedFilePath );
+        if( !CSVFile )
+        {
+            cerr << "Error Opening CSV File Path: " << modifiedFilePath << endl;
+        }
+        else
+        {
+            cout << "Opening CSV File Path: " << modifiedFilePath << endl;
+        }
+
+        // The header names the column of every sensor, so each file may order them differently
+        string line;
+        if( !getline( CSVFile, line ) || !sensorRegistry.ReadHeader( line ) )
+        {
+            continue;
+        }
+        while( getline( CSVFile, line ) )
+        {
+            if( line.empty() || line == "\r" )
+            {
+                continue;
+            }
+            m_dataRead ++;
+
+            // A row is kept in the registry only if its wind record was stored, so both stay row aligned
+            if( !sensorRegistry.AppendLine( line ) )
+            {
+                continue;
+            }
+            if( !sensorRegistry.GetRecord( sensorRegistry.GetRowCount() - 1, windRecType ) || !append( windRecType ) )
+            {
+                sensorRegistry.RemoveLastRow();
+                continue;
+            }
+            m_anomalyDetector.Check( windRecType, m_anomalySink );
+        }
+    }
 }
 
 void Processor::LoadDisplayCount()
 {
     std::cout   << Constant::INFO( Constant::TOTAL_READ_DATA_MSG ) << m_dataRead << '\n'
                 << Constant::INFO( Constant::TOTAL_SAVED_DATA_MSG ) << m_dataInserted << '\n'
+                << Constant::INFO( Constant::TOTAL_FLAGGED_DATA_MSG ) << m_anomalyDetector.GetFlaggedCount() << '\n'
                 << "+++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++++\n"
                 << endl;
 }
@@ -45,32 +91,58 @@ void Processor::LoadCSVFilePathToVector( Vector<string> &csvFilePath, ifstream &
     }
 }
 
-void Processor::LoadCSVDataToVector( Vector<string> &csvFilePath, Vector<WindRecType> &windRecTypeVec, WindRecType &windRecType )
+bool Processor::AppendRecord( DatasetSnapshot &snapshot, const WindRecType &windRecType )
 {
-    for( unsigned i(0); i<csvFilePath.GetUsed(); i++ )
+    if( !snapshot.Append( windRecType ) )
     {
-        string modifiedFilePath = "data/" + csvFilePath[i];
-        ifstream CSVFile( modifiedFilePath );
-        if( !CSVFile )
-        {
-            cerr << "Error Opening CSV File Path: " << modifiedFilePath << endl;
-        }
-        else
-        {
-            cout << "Opening CSV File Path: " << modifiedFilePath << endl;
-        }
+        return false;
+    }
+    m_dataInserted ++;
+    m_dataVersion ++;
+    return true;
+}
 
-        string line;
-        getline( CSVFile, line );
-        while( CSVFile.peek() != EOF )
-        {
-            CSVFile >> windRecType;
-            m_dataRead ++;
+void Processor::SetAnomalySink( const std::function<void( const AnomalyDetector::Anomaly & )> &sink )
+{
+    m_anomalySink = sink;
+}
 
-            windRecTypeVec.InsertLast( windRecType );
-            m_dataInserted ++;
-        }
-    }
+unsigned Processor::GetAnomalyCount() const
+{
+    return m_anomalyDetector.GetFlaggedCount();
+}
+
+unsigned Processor::GetDataVersion() const
+{
+    return m_dataVersion;
+}
+
+std::shared_ptr<const DatasetSnapshot> Processor::LoadSnapshot( Vector<string> &csvFilePath )
+{
+    std::shared_ptr<DatasetSnapshot> snapshot = std::make_shared<DatasetSnapshot>();
+    WindRecType windRecType;
+
+    m_dataRead = 0;
+    m_dataInserted = 0;
+    m_anomalyDetector.Clear();
+    ReadCSVFiles( csvFilePath, windRecType, snapshot->GetSensorRegistry(), [this, &snapshot]( const WindRecType &record )
+    {
+        return AppendRecord( *snapshot, record );
+    } );
+    snapshot->BuildIndexes();
     LoadDisplayCount();
+
+    PublishSnapshot( snapshot );
+    return snapshot;
 }
 
+void Processor::PublishSnapshot( const std::shared_ptr<const DatasetSnapshot> &snapshot )
+{
+    std::atomic_store( &m_snapshot, snapshot );
+    m_dataVersion ++;
+}
+
+std::shared_ptr<const DatasetSnapshot> Processor::GetSnapshot() const
+{
+    return std::atomic_load( &m_snapshot );
+}
@@ -4,18 +4,23 @@
 #include<iostream>
 #include<fstream>
 #include<string>
+#include<memory>
+#include<atomic>
+#include<functional>
 
 #include "WindRecType.h"
 #include "Vector.h"
 #include "Constant.h"
+#include "DatasetSnapshot.h"
+#include "AnomalyDetector.h"
 
 using namespace std;
 
 /**
  * @brief The Processor class handles processing of CSV data as a singleton.
  *
- * This class provides functionality to load CSV file paths from a txt file and processes data into vectors,
- * and perform other processing tasks. It follows the singleton design pattern.
+ * This class provides functionality to load CSV file paths from a txt file, load their data into a
+ * dataset snapshot and publish it to the readers, and perform other processing tasks. It follows the singleton design pattern.
  */
 class Processor
 {
@@ -38,18 +43,74 @@ public:
     void LoadCSVFilePathToVector( Vector<string> &csvFilePath, ifstream &input, const string &filename );
 
     /**
-     * @brief Loads CSV data from a vector of file paths into a vector of WindRecType objects.
+     * @brief Appends a single wind record to a snapshot that is not published yet.
+     *
+     * Used by the CSV load and by incremental appends, so the summary cube and the indexes of the
+     * snapshot are always consistent with its records. The data version changes, so cached query
+     * results computed before the append are known to be stale.
+     *
+     * @param[in] snapshot The snapshot to append to.
+     * @param[in] windRecType The wind record to append.
+     * @return true if the record was inserted, false otherwise.
+     */
+    bool AppendRecord( DatasetSnapshot &snapshot, const WindRecType &windRecType );
+
+    /**
+     * @brief Sets the side channel the readings flagged during loading are sent to.
+     * Every stored record is checked against the rolling baseline of each of its measurements as it is
+     * read, and each flagged reading is passed to the sink. The records themselves are stored as read.
+     * @param[in] sink Called once for each flagged reading, or empty to only count them.
+     */
+    void SetAnomalySink( const std::function<void( const AnomalyDetector::Anomaly & )> &sink );
+
+    /**
+     * @brief Getter for the number of readings flagged by the last load.
+     * @return The number of flagged readings.
+     */
+    unsigned GetAnomalyCount() const;
+
+    /**
+     * @brief Getter for the version of the loaded data.
+     * The version changes on every append and snapshot publish, so cached query results
+     * computed at an older version are known to be stale.
+     * @return The data version.
+     */
+    unsigned GetDataVersion() const;
+
+    /**
+     * @brief Loads CSV data from a vector of file paths into a new snapshot and publishes it.
+     *
+     * The snapshot is built aside while readers keep querying the one published before, then
+     * replaces it in a single atomic swap. Only one thread should load at a time.
      *
      * @param[in] csvFilePath The vector containing the CSV file paths.
-     * @param[in] windRecTypeVec The vector to store the WindRecType objects.
-     * @param[in] windRecType An object of type WindRecType.
+     * @return The snapshot published.
+     */
+    std::shared_ptr<const DatasetSnapshot> LoadSnapshot( Vector<string> &csvFilePath );
+
+    /**
+     * @brief Publishes a snapshot to the readers, replacing the one published before.
+     * Readers that already hold the old snapshot finish on it, and it is freed with its last reader.
+     * The data version changes, so cached query results of the old snapshot are dropped.
+     * @param[in] snapshot The snapshot, with its indexes built.
+     */
+    void PublishSnapshot( const std::shared_ptr<const DatasetSnapshot> &snapshot );
+
+    /**
+     * @brief Getter for the published snapshot, never blocking on a reload.
+     * Hold the returned pointer for the whole of a query, so the query reads one consistent dataset.
+     * @return The published snapshot, or null if none was published.
      */
-    void LoadCSVDataToVector( Vector<string> &csvFilePath, Vector<WindRecType> &windRecTypeVec, WindRecType &windRecType );
+    std::shared_ptr<const DatasetSnapshot> GetSnapshot() const;
 
 private:
     static Processor *s_instance;   /**< Pointer to the singleton instance. */
     unsigned m_dataRead;            /**< Counter for the number of data read. */
     unsigned m_dataInserted;        /**< Counter for the number of data inserted. */
+    std::atomic<unsigned> m_dataVersion;/**< Version of the loaded data, changed on every append and publish. */
+    std::shared_ptr<const DatasetSnapshot> m_snapshot;/**< Published snapshot, only accessed with atomic loads and stores. */
+    AnomalyDetector m_anomalyDetector;/**< Rolling baselines the loaded records are checked against. */
+    std::function<void( const AnomalyDetector::Anomaly & )> m_anomalySink;/**< Side channel of the flagged readings. */
 
      /**
      * @brief Private constructor to prevent instantiation.
@@ -62,6 +123,20 @@ private:
      * This function loads the display count for the Processor instance.
      */
     void LoadDisplayCount();
+
+    /**
+     * @brief Reads every record of the CSV files of a vector of file paths.
+     *
+     * Each file is parsed by the names of its header line, so the columns may come in any order.
+     * Blank lines and lines without a valid date, time, wind speed, solar radiation and temperature
+     * are counted as read but not stored. Every stored record is checked for anomalies, see SetAnomalySink().
+     *
+     * @param[in] csvFilePath The vector containing the CSV file paths.
+     * @param[in] windRecType An object of type WindRecType, holding the last record read.
+     * @param[in] sensorRegistry The registry every sensor column is read into, one row per stored record.
+     * @param[in] append Stores one record, returning true if it was inserted.
+     */
+    void ReadCSVFiles( Vector<string> &csvFilePath, WindRecType &windRecType, SensorRegistry &sensorRegistry, const std::function<bool( const WindRecType & )> &append );
 };
 
 #endif // PROCESSOR_H_INCLUDED
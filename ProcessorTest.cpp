@@ -5,19 +5,58 @@
 
 using namespace std;
 
+void Assert( bool condition, const string &message );
+void TestLoadSnapshot();
+void TestAppendRecord();
+
 int main()
+{
+    TestLoadSnapshot();
+    TestAppendRecord();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestLoadSnapshot()
 {
     // Initialize required variables
     const string file = "data/data_source.txt";
     ifstream inFile( file );
-    WindRecType windRecType;
     Vector<string> csvFilePath;
-    Vector<WindRecType> windRecTypeVector;
 
     // routines
     Processor::GetInstance();                                                                       // create singleton instance
     Processor::GetInstance().LoadCSVFilePathToVector( csvFilePath, inFile, file );                  // Loading csv file path from txt file
-    Processor::GetInstance().LoadCSVDataToVector( csvFilePath, windRecTypeVector, windRecType );    // Loading data into vector
+    std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().LoadSnapshot( csvFilePath );
 
-    return 0;
+    cout << "Test Load Snapshot" << endl;
+    Assert( snapshot == Processor::GetInstance().GetSnapshot(), "The loaded snapshot is published" );
+    Assert( snapshot->GetSensorRegistry().GetRowCount() == snapshot->GetUsed(), "Every stored record has its sensor row" );
+    cout << endl;
+}
+
+void TestAppendRecord()
+{
+    DatasetSnapshot snapshot;
+    unsigned version = Processor::GetInstance().GetDataVersion();
+
+    cout << "Test Append Record" << endl;
+    Assert( Processor::GetInstance().AppendRecord( snapshot, WindRecType( Date( 1, 5, 2014 ), Time( 9, 0 ), WindSpeed( 10 ), SolarRadiation( 500 ), Temperature( 20 ) ) ),
+            "A record is appended" );
+    Assert( snapshot.GetUsed() == 1 && snapshot.GetSummaryCube().GetMonthly( 5, 2014, MeasurementType::WINDSPEED ).GetCount() == 1,
+            "The appended record is in the records and the summary cube" );
+    Assert( Processor::GetInstance().GetDataVersion() == version + 1, "An append changes the data version" );
+    cout << endl;
 }
@@ -0,0 +1,184 @@
+
+#include<algorithm>
+#include<cmath>
+
+#include "QuantileSketch.h"
+
+const unsigned QuantileSketch::DEFAULT_K;
+const unsigned QuantileSketch::MINIMUM_K;
+
+QuantileSketch::QuantileSketch( const unsigned &k )
+{
+    m_k = ( k < MINIMUM_K ) ? MINIMUM_K : k;
+    m_random = 2463534242u;
+    Clear();
+}
+
+void QuantileSketch::Add( const float &measurement )
+{
+    m_compactors[0].InsertLast( measurement );
+    m_count ++;
+    m_retained ++;
+    if( m_retained > m_totalCapacity )
+    {
+        Compress();
+    }
+}
+
+void QuantileSketch::Merge( const QuantileSketch &other )
+{
+    if( &other == this )
+    {
+        QuantileSketch copy( other );
+        Merge( copy );
+        return;
+    }
+
+    AddLevels( other.m_compactors.GetUsed() );
+    for( unsigned level(0); level < other.m_compactors.GetUsed(); level++ )
+    {
+        const Vector<float> &items = other.m_compactors[level];
+        for( unsigned i(0); i < items.GetUsed(); i++ )
+        {
+            m_compactors[level].InsertLast( items[i] );
+        }
+    }
+    m_count += other.m_count;
+    m_retained += other.m_retained;
+    m_random ^= other.m_random;
+    if( m_random == 0 )
+    {
+        m_random = 2463534242u;
+    }
+    Compress();
+}
+
+void QuantileSketch::Clear()
+{
+    while( m_compactors.RemoveLast() );
+    AddLevels( 1 );
+    m_count = 0;
+    m_retained = 0;
+}
+
+unsigned QuantileSketch::GetCount() const
+{
+    return m_count;
+}
+
+unsigned QuantileSketch::GetRetained() const
+{
+    return m_retained;
+}
+
+float QuantileSketch::GetQuantile( const double &fraction ) const
+{
+    if( m_count == 0 )
+    {
+        return 0.0;
+    }
+
+    struct WeightedItem
+    {
+        float value;
+        unsigned long long weight;
+    };
+
+    Vector<WeightedItem> items;
+    for( unsigned level(0); level < m_compactors.GetUsed(); level++ )
+    {
+        for( unsigned i(0); i < m_compactors[level].GetUsed(); i++ )
+        {
+            WeightedItem item;
+            item.value = m_compactors[level][i];
+            item.weight = 1ull << level;
+            items.InsertLast( item );
+        }
+    }
+    std::sort( items.Start(), items.Finish(), []( const WeightedItem &left, const WeightedItem &right )
+    {
+        return left.value < right.value;
+    } );
+
+    double clamped = ( fraction < 0.0 ) ? 0.0 : ( fraction > 1.0 ) ? 1.0 : fraction;
+    double target = clamped * m_count;
+    unsigned long long cumulative = 0;
+    for( unsigned i(0); i < items.GetUsed(); i++ )
+    {
+        cumulative += items[i].weight;
+        if( cumulative >= target )
+        {
+            return items[i].value;
+        }
+    }
+    return items[items.GetUsed() - 1].value;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void QuantileSketch::AddLevels( const unsigned &levels )
+{
+    if( m_compactors.GetUsed() >= levels )
+    {
+        return;
+    }
+    while( m_compactors.GetUsed() < levels )
+    {
+        m_compactors.InsertLast( Vector<float>() );
+    }
+
+    m_capacities.SetSize( levels );
+    m_totalCapacity = 0;
+    for( unsigned level(0); level < levels; level++ )
+    {
+        unsigned depth = levels - 1 - level;
+        unsigned capacity = unsigned( std::ceil( m_k * std::pow( 2.0 / 3.0, double( depth ) ) ) );
+        m_capacities[level] = ( capacity < 2 ) ? 2 : capacity;
+        m_totalCapacity += m_capacities[level];
+    }
+}
+
+void QuantileSketch::Compress()
+{
+    unsigned level = 0;
+
+    while( m_retained > m_totalCapacity && level < m_compactors.GetUsed() )
+    {
+        if( m_compactors[level].GetUsed() < m_capacities[level] )
+        {
+            level++;
+            continue;
+        }
+        AddLevels( level + 2 );
+
+        Vector<float> &items = m_compactors[level];
+        unsigned used = items.GetUsed();
+        unsigned paired = used - used % 2;
+        unsigned offset = NextRandomBit();
+
+        std::sort( items.Start(), items.Finish() );
+        for( unsigned i(0); i < paired; i += 2 )
+        {
+            m_compactors[level + 1].InsertLast( items[i + offset] );
+        }
+        if( paired < used )
+        {
+            items[0] = items[used - 1];
+            items.SetSize( 1 );
+        }
+        else
+        {
+            items.SetSize( 0 );
+        }
+        m_retained -= paired / 2;
+        level = 0;
+    }
+}
+
+unsigned QuantileSketch::NextRandomBit()
+{
+    m_random ^= m_random << 13;
+    m_random ^= m_random >> 17;
+    m_random ^= m_random << 5;
+    return m_random & 1u;
+}
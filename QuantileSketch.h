@@ -0,0 +1,111 @@
+/**
+ * @file QuantileSketch.h
+ * @brief Defines the QuantileSketch class, a mergeable streaming quantile sketch.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef QUANTILESKETCH_H_INCLUDED
+#define QUANTILESKETCH_H_INCLUDED
+
+#include "Vector.h"
+
+/**
+* @brief Represents a KLL quantile sketch of measurement readings.
+*
+* Readings are kept in a stack of compactors. An item in compactor h stands for 2^h readings.
+* When the sketch is over capacity, the lowest full compactor is sorted and every other item,
+* from a random offset, is promoted to the compactor above, halving it. Capacities shrink by
+* 2/3 per level below the top, so memory stays near 3k items however many readings are added,
+* and the rank error of a quantile is about 1.7 / k with high probability ( under 1% for the
+* default k of 200 ). Two sketches merge by concatenating their compactors and compacting, so
+* monthly sketches built during ingest combine into yearly ones without the raw readings.
+*/
+class QuantileSketch
+{
+public:
+    static const unsigned DEFAULT_K = 200;      ///< Default size of the top compactor.
+    static const unsigned MINIMUM_K = 8;        ///< Smallest accepted size of the top compactor.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] k The size of the top compactor, trading memory for accuracy.
+    * @post Creates an empty QuantileSketch.
+    */
+    QuantileSketch( const unsigned &k = DEFAULT_K );
+
+    /**
+    * @brief Adds a single reading to the sketch.
+    *
+    * @param[in] measurement The reading to add.
+    */
+    void Add( const float &measurement );
+
+    /**
+    * @brief Merges another sketch into this sketch.
+    *
+    * @param[in] other The sketch to combine.
+    * @post This sketch summarises the readings of both sketches.
+    */
+    void Merge( const QuantileSketch &other );
+
+    /**
+    * @brief Removes every reading from the sketch.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of readings added to the sketch.
+    *
+    * @return The number of readings.
+    */
+    unsigned GetCount() const;
+
+    /**
+    * @brief Getter for the number of items retained by the sketch.
+    *
+    * @return The number of items across every compactor.
+    */
+    unsigned GetRetained() const;
+
+    /**
+    * @brief Estimates a quantile of the readings.
+    *
+    * @param[in] fraction The quantile as a fraction, 0.5 for the median and 0.99 for p99.
+    * @return The reading at that rank, 0 when the sketch is empty.
+    */
+    float GetQuantile( const double &fraction ) const;
+
+private:
+    Vector< Vector<float> > m_compactors;   ///< Compactor h holds items of weight 2^h.
+    unsigned m_k;                           ///< Size of the top compactor.
+    unsigned m_count;                       ///< Number of readings added.
+    unsigned m_retained;                    ///< Number of items across every compactor.
+    unsigned m_random;                      ///< Xorshift state choosing the compaction offsets.
+    Vector<unsigned> m_capacities;          ///< Capacity of each compactor, for the current number of compactors.
+    unsigned m_totalCapacity;               ///< Sum of the compactor capacities.
+
+    /**
+    * @brief Adds compactors on top until there are at least a number of them.
+    *
+    * Capacities depend on the distance from the top compactor, so they are recalculated
+    * here, the only place the number of compactors grows.
+    *
+    * @param[in] levels The number of compactors needed.
+    */
+    void AddLevels( const unsigned &levels );
+
+    /**
+    * @brief Compacts the lowest full compactors until the sketch is within capacity.
+    */
+    void Compress();
+
+    /**
+    * @brief Draws the next random bit for a compaction offset.
+    *
+    * @return 0 or 1.
+    */
+    unsigned NextRandomBit();
+};
+
+#endif // QUANTILESKETCH_H_INCLUDED
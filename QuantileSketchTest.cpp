@@ -0,0 +1,149 @@
+#include<iostream>
+#include<cstdlib>
+#include<algorithm>
+
+#include "QuantileSketch.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestInitialization( const QuantileSketch &quantileSketch );
+void TestSmallSketch();
+void TestRankError();
+void TestMerge();
+void TestClear();
+
+double GetRankError( const QuantileSketch &quantileSketch, Vector<float> &sorted, const double &fraction );
+
+int main()
+{
+    QuantileSketch quantileSketch;
+
+    TestInitialization( quantileSketch );
+    TestSmallSketch();
+    TestRankError();
+    TestMerge();
+    TestClear();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+double GetRankError( const QuantileSketch &quantileSketch, Vector<float> &sorted, const double &fraction )
+{
+    float estimate = quantileSketch.GetQuantile( fraction );
+    unsigned low = unsigned( lower_bound( sorted.Start(), sorted.Finish(), estimate ) - sorted.Start() );
+    unsigned high = unsigned( upper_bound( sorted.Start(), sorted.Finish(), estimate ) - sorted.Start() );
+    double target = fraction * sorted.GetUsed();
+
+    if( target < low )
+    {
+        return ( low - target ) / sorted.GetUsed();
+    }
+    if( target > high )
+    {
+        return ( target - high ) / sorted.GetUsed();
+    }
+    return 0.0;
+}
+
+void TestInitialization( const QuantileSketch &quantileSketch )
+{
+    cout << "Test on Default QuantileSketch Object" << endl;
+    Assert( quantileSketch.GetCount() == 0, "Default QuantileSketch has no readings" );
+    Assert( quantileSketch.GetQuantile( 0.5 ) == 0, "Default QuantileSketch has a median of 0" );
+    cout << endl;
+}
+
+void TestSmallSketch()
+{
+    QuantileSketch quantileSketch;
+
+    for( unsigned i(1); i <= 100; i++ )
+    {
+        quantileSketch.Add( float( 101 - i ) );
+    }
+
+    cout << "Test on a sketch within capacity" << endl;
+    Assert( quantileSketch.GetCount() == 100 && quantileSketch.GetRetained() == 100, "Sketch within capacity keeps every reading" );
+    Assert( quantileSketch.GetQuantile( 0.5 ) == 50, "Median of 1 ~ 100 is 50" );
+    Assert( quantileSketch.GetQuantile( 0.99 ) == 99, "p99 of 1 ~ 100 is 99" );
+    Assert( quantileSketch.GetQuantile( 0.0 ) == 1 && quantileSketch.GetQuantile( 1.0 ) == 100, "Quantiles 0 and 1 are the extremes" );
+    cout << endl;
+}
+
+void TestRankError()
+{
+    QuantileSketch quantileSketch;
+    Vector<float> sorted;
+
+    srand( 283 );
+    for( unsigned i(0); i < 200000; i++ )
+    {
+        float reading = float( rand() % 100000 ) / 100.0f;
+        quantileSketch.Add( reading );
+        sorted.InsertLast( reading );
+    }
+    sort( sorted.Start(), sorted.Finish() );
+
+    cout << "Test on rank error of a large sketch" << endl;
+    Assert( quantileSketch.GetCount() == 200000, "Sketch counts every reading" );
+    Assert( quantileSketch.GetRetained() < 1000, "Sketch retains fewer than 1000 items" );
+    Assert( GetRankError( quantileSketch, sorted, 0.5 ) < 0.01, "Median is within 1% rank" );
+    Assert( GetRankError( quantileSketch, sorted, 0.9 ) < 0.01, "p90 is within 1% rank" );
+    Assert( GetRankError( quantileSketch, sorted, 0.95 ) < 0.01, "p95 is within 1% rank" );
+    Assert( GetRankError( quantileSketch, sorted, 0.99 ) < 0.01, "p99 is within 1% rank" );
+    cout << endl;
+}
+
+void TestMerge()
+{
+    QuantileSketch merged;
+    Vector<float> sorted;
+
+    srand( 3394804 );
+    for( unsigned part(0); part < 12; part++ )
+    {
+        QuantileSketch monthly;
+        for( unsigned i(0); i < 5000; i++ )
+        {
+            float reading = float( part * 10 + rand() % 100 );
+            monthly.Add( reading );
+            sorted.InsertLast( reading );
+        }
+        merged.Merge( monthly );
+    }
+    sort( sorted.Start(), sorted.Finish() );
+
+    cout << "Test on Merge" << endl;
+    Assert( merged.GetCount() == 60000, "Merged sketch counts every reading" );
+    Assert( GetRankError( merged, sorted, 0.5 ) < 0.01, "Merged median is within 1% rank" );
+    Assert( GetRankError( merged, sorted, 0.99 ) < 0.01, "Merged p99 is within 1% rank" );
+    cout << endl;
+}
+
+void TestClear()
+{
+    QuantileSketch quantileSketch;
+
+    for( unsigned i(0); i < 10000; i++ )
+    {
+        quantileSketch.Add( float( i ) );
+    }
+    quantileSketch.Clear();
+
+    cout << "Test on Clear" << endl;
+    Assert( quantileSketch.GetCount() == 0 && quantileSketch.GetRetained() == 0, "Cleared QuantileSketch has no readings" );
+    cout << endl;
+}
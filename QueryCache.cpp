@@ -0,0 +1,121 @@
+
+#include "QueryCache.h"
+
+const unsigned QueryCache::DEFAULT_CAPACITY;
+
+bool QueryCache::Key::operator == ( const Key &other ) const
+{
+    return kind == other.kind
+           && measurementType == other.measurementType
+           && start == other.start
+           && end == other.end
+           && source == other.source
+           && secondarySource == other.secondarySource;
+}
+
+QueryCache::QueryCache( const unsigned &capacity )
+{
+    m_capacity = ( capacity == 0 ) ? 1 : capacity;
+    m_dataVersion = 0;
+    m_hits = 0;
+    m_misses = 0;
+    m_invalidations = 0;
+}
+
+bool QueryCache::Lookup( const Key &key, const unsigned &dataVersion, MeasurementAccumulator &result )
+{
+    Synchronise( dataVersion );
+
+    auto found = m_index.find( key );
+    if( found == m_index.end() )
+    {
+        m_misses ++;
+        return false;
+    }
+
+    m_entries.splice( m_entries.begin(), m_entries, found->second );
+    result = found->second->result;
+    m_hits ++;
+    return true;
+}
+
+void QueryCache::Insert( const Key &key, const unsigned &dataVersion, const MeasurementAccumulator &result )
+{
+    Synchronise( dataVersion );
+
+    auto found = m_index.find( key );
+    if( found != m_index.end() )
+    {
+        found->second->result = result;
+        m_entries.splice( m_entries.begin(), m_entries, found->second );
+        return;
+    }
+
+    if( m_entries.size() >= m_capacity )
+    {
+        m_index.erase( m_entries.back().key );
+        m_entries.pop_back();
+    }
+    m_entries.push_front( Entry{ key, result } );
+    m_index[key] = m_entries.begin();
+}
+
+void QueryCache::Clear()
+{
+    m_entries.clear();
+    m_index.clear();
+}
+
+unsigned QueryCache::GetUsed() const
+{
+    return unsigned( m_entries.size() );
+}
+
+unsigned QueryCache::GetCapacity() const
+{
+    return m_capacity;
+}
+
+unsigned QueryCache::GetHitCount() const
+{
+    return m_hits;
+}
+
+unsigned QueryCache::GetMissCount() const
+{
+    return m_misses;
+}
+
+unsigned QueryCache::GetInvalidationCount() const
+{
+    return m_invalidations;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+size_t QueryCache::KeyHash::operator () ( const Key &key ) const
+{
+    size_t hash = std::hash<const void *>()( key.source );
+
+    hash = hash * 31 + std::hash<const void *>()( key.secondarySource );
+
+    hash = hash * 31 + size_t( key.kind );
+    hash = hash * 31 + size_t( key.measurementType );
+    hash = hash * 1000003 + key.start;
+    hash = hash * 1000003 + key.end;
+    return hash;
+}
+
+void QueryCache::Synchronise( const unsigned &dataVersion )
+{
+    if( dataVersion == m_dataVersion )
+    {
+        return;
+    }
+    if( !m_entries.empty() )
+    {
+        m_invalidations ++;
+    }
+    Clear();
+    m_dataVersion = dataVersion;
+}
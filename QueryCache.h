@@ -0,0 +1,163 @@
+/**
+ * @file QueryCache.h
+ * @brief Defines the QueryCache class, a bounded least recently used cache of query results.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef QUERYCACHE_H_INCLUDED
+#define QUERYCACHE_H_INCLUDED
+
+#include<list>
+#include<unordered_map>
+
+#include "MeasurementType.h"
+#include "MeasurementAccumulator.h"
+
+/**
+* @brief Kind of query whose result is cached.
+*/
+enum class QueryKind
+{
+    MONTHLY_SUMMARY,
+    RANGE_SUMMARY,
+    RANGE_SUMMARY_WITH_EXTREMES,
+    PYRAMID_RANGE_SUMMARY
+};
+
+/**
+* @brief Represents a bounded cache of query results, evicting the least recently used result when full.
+*
+* Results are keyed by the kind of query, the measurement, the [start, end) time range and the
+* structures the query ran against. Every lookup and insert carries the data version of the source
+* data; when it differs from the version the cached results were computed at, the cache is emptied
+* first, so a load or append never serves a stale result. Hits and misses are counted for reporting.
+*/
+class QueryCache
+{
+public:
+    static const unsigned DEFAULT_CAPACITY = 256;   ///< Default number of cached results.
+
+    /**
+    * @brief Identifies a query.
+    */
+    struct Key
+    {
+        QueryKind kind;                     ///< Kind of query.
+        MeasurementType measurementType;    ///< Measurement queried.
+        unsigned start;                     ///< Packed timestamp or key of the start of the range.
+        unsigned end;                       ///< Packed timestamp or key of the end of the range.
+        const void *source;                 ///< Structure the query ran against.
+        const void *secondarySource;        ///< Second structure the query ran against, nullptr for a query on one structure.
+
+        /**
+        * @brief Compares two keys.
+        *
+        * @param[in] other The key to compare against.
+        * @return true if every field is equal, false otherwise.
+        */
+        bool operator == ( const Key &other ) const;
+    };
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] capacity The largest number of results held, at least 1.
+    * @post Creates an empty QueryCache.
+    */
+    QueryCache( const unsigned &capacity = DEFAULT_CAPACITY );
+
+    /**
+    * @brief Looks up the result of a query, marking it as the most recently used.
+    *
+    * @param[in] key The query.
+    * @param[in] dataVersion The current version of the source data.
+    * @param[out] result The cached result, when found.
+    * @return true on a hit, false on a miss.
+    */
+    bool Lookup( const Key &key, const unsigned &dataVersion, MeasurementAccumulator &result );
+
+    /**
+    * @brief Stores the result of a query, evicting the least recently used result when full.
+    *
+    * @param[in] key The query.
+    * @param[in] dataVersion The version of the source data the result was computed from.
+    * @param[in] result The result to cache.
+    */
+    void Insert( const Key &key, const unsigned &dataVersion, const MeasurementAccumulator &result );
+
+    /**
+    * @brief Removes every cached result, keeping the hit and miss counts.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of cached results.
+    *
+    * @return The number of results.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the largest number of cached results.
+    *
+    * @return The capacity.
+    */
+    unsigned GetCapacity() const;
+
+    /**
+    * @brief Getter for the number of lookups that found a result.
+    *
+    * @return The number of hits.
+    */
+    unsigned GetHitCount() const;
+
+    /**
+    * @brief Getter for the number of lookups that did not find a result.
+    *
+    * @return The number of misses.
+    */
+    unsigned GetMissCount() const;
+
+    /**
+    * @brief Getter for the number of times the cache was emptied by a new data version.
+    *
+    * @return The number of invalidations.
+    */
+    unsigned GetInvalidationCount() const;
+
+private:
+
+    /**
+    * @brief Hashes a key for the index.
+    */
+    struct KeyHash
+    {
+        size_t operator () ( const Key &key ) const;
+    };
+
+    /**
+    * @brief One cached result.
+    */
+    struct Entry
+    {
+        Key key;                            ///< The query.
+        MeasurementAccumulator result;      ///< The cached result.
+    };
+
+    std::list<Entry> m_entries;                                                             ///< Results, most recently used first.
+    std::unordered_map<Key, std::list<Entry>::iterator, KeyHash> m_index;                   ///< Position of each result by key.
+    unsigned m_capacity;                                                                    ///< Largest number of results.
+    unsigned m_dataVersion;                                                                 ///< Data version of the cached results.
+    unsigned m_hits;                                                                        ///< Number of lookups that found a result.
+    unsigned m_misses;                                                                      ///< Number of lookups that did not find a result.
+    unsigned m_invalidations;                                                               ///< Number of times a new data version emptied the cache.
+
+    /**
+    * @brief Empties the cache if the data version changed.
+    *
+    * @param[in] dataVersion The current version of the source data.
+    */
+    void Synchronise( const unsigned &dataVersion );
+};
+
+#endif // QUERYCACHE_H_INCLUDED
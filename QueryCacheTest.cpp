@@ -0,0 +1,116 @@
+#include<iostream>
+
+#include "QueryCache.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+QueryCache::Key MakeKey( const unsigned &start, MeasurementType measurementType = MeasurementType::WINDSPEED );
+void TestInitialization( const QueryCache &queryCache );
+void TestHitAndMiss();
+void TestEviction();
+void TestInvalidation();
+void TestSecondarySource();
+
+int main()
+{
+    QueryCache queryCache;
+
+    TestInitialization( queryCache );
+    TestHitAndMiss();
+    TestEviction();
+    TestInvalidation();
+    TestSecondarySource();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+QueryCache::Key MakeKey( const unsigned &start, MeasurementType measurementType )
+{
+    QueryCache::Key key = { QueryKind::RANGE_SUMMARY, measurementType, start, start + 1, nullptr, nullptr };
+    return key;
+}
+
+void TestInitialization( const QueryCache &queryCache )
+{
+    cout << "Test on Default QueryCache Object" << endl;
+    Assert( queryCache.GetUsed() == 0, "Default QueryCache is empty" );
+    Assert( queryCache.GetCapacity() == QueryCache::DEFAULT_CAPACITY, "Default QueryCache has the default capacity" );
+    Assert( queryCache.GetHitCount() == 0 && queryCache.GetMissCount() == 0, "Default QueryCache has no hits or misses" );
+    cout << endl;
+}
+
+void TestHitAndMiss()
+{
+    QueryCache queryCache;
+    MeasurementAccumulator result;
+
+    cout << "Test on hits and misses" << endl;
+    Assert( !queryCache.Lookup( MakeKey( 1 ), 0, result ), "First lookup misses" );
+    queryCache.Insert( MakeKey( 1 ), 0, MeasurementAccumulator( 2, 10.0, 2.0, 4.0f, 6.0f ) );
+    Assert( queryCache.Lookup( MakeKey( 1 ), 0, result ) && result.GetMean() == 5, "Lookup after insert hits with the result" );
+    Assert( !queryCache.Lookup( MakeKey( 1, MeasurementType::TEMPERATURE ), 0, result ), "Other measurement misses" );
+    Assert( queryCache.GetHitCount() == 1 && queryCache.GetMissCount() == 2, "Hits and misses are counted" );
+    cout << endl;
+}
+
+void TestEviction()
+{
+    QueryCache queryCache( 2 );
+    MeasurementAccumulator result;
+
+    queryCache.Insert( MakeKey( 1 ), 0, result );
+    queryCache.Insert( MakeKey( 2 ), 0, result );
+    queryCache.Lookup( MakeKey( 1 ), 0, result );
+    queryCache.Insert( MakeKey( 3 ), 0, result );
+
+    cout << "Test on eviction" << endl;
+    Assert( queryCache.GetUsed() == 2, "Cache holds at most its capacity" );
+    Assert( !queryCache.Lookup( MakeKey( 2 ), 0, result ), "Least recently used result is evicted" );
+    Assert( queryCache.Lookup( MakeKey( 1 ), 0, result ), "Recently looked up result is kept" );
+    Assert( queryCache.Lookup( MakeKey( 3 ), 0, result ), "Newest result is kept" );
+    cout << endl;
+}
+
+void TestInvalidation()
+{
+    QueryCache queryCache;
+    MeasurementAccumulator result;
+
+    queryCache.Insert( MakeKey( 1 ), 5, result );
+
+    cout << "Test on invalidation" << endl;
+    Assert( queryCache.Lookup( MakeKey( 1 ), 5, result ), "Same data version hits" );
+    Assert( !queryCache.Lookup( MakeKey( 1 ), 6, result ), "New data version misses" );
+    Assert( queryCache.GetUsed() == 0 && queryCache.GetInvalidationCount() == 1, "New data version empties the cache" );
+    cout << endl;
+}
+
+void TestSecondarySource()
+{
+    QueryCache queryCache;
+    MeasurementAccumulator result;
+    int first = 0;
+    int second = 0;
+    QueryCache::Key firstKey = { QueryKind::RANGE_SUMMARY_WITH_EXTREMES, MeasurementType::WINDSPEED, 1, 2, nullptr, &first };
+    QueryCache::Key secondKey = { QueryKind::RANGE_SUMMARY_WITH_EXTREMES, MeasurementType::WINDSPEED, 1, 2, nullptr, &second };
+
+    queryCache.Insert( firstKey, 0, result );
+
+    cout << "Test on the secondary source" << endl;
+    Assert( queryCache.Lookup( firstKey, 0, result ), "Same secondary source hits" );
+    Assert( !queryCache.Lookup( secondKey, 0, result ), "Other secondary source misses" );
+    cout << endl;
+}
@@ -0,0 +1,697 @@
+
+#include "QueryEngine.h"
+
+#include<cmath>
+#include<cstdio>
+#include<charconv>
+
+QueryEngine::QueryEngine(
+    Client &client,
+    const SummaryCube &summaryCube,
+    const PrefixSumIndex &prefixSumIndex,
+    const RangeExtremumIndex &rangeExtremumIndex,
+    const SensorRegistry *sensorRegistry,
+    const GapList *gapList )
+    : m_client( client ),
+      m_summaryCube( summaryCube ),
+      m_prefixSumIndex( prefixSumIndex ),
+      m_rangeExtremumIndex( rangeExtremumIndex ),
+      m_sensorRegistry( sensorRegistry ),
+      m_gapList( gapList ) {}
+
+bool QueryEngine::Execute( const string &query, RecordWriter &recordWriter )
+{
+    istringstream arguments( query );
+    string command;
+
+    if( !( arguments >> command ) || command[0] == '#' )
+    {
+        return true;
+    }
+
+    const string yearSuffix = "-year";
+    string measurementName = command;
+    bool isYear = command.size() > yearSuffix.size()
+                  && command.compare( command.size() - yearSuffix.size(), yearSuffix.size(), yearSuffix ) == 0;
+    if( isYear )
+    {
+        measurementName = command.substr( 0, command.size() - yearSuffix.size() );
+    }
+
+    bool answered = false;
+    MeasurementType measurementType;
+    if( ParseMeasurement( measurementName, measurementType ) )
+    {
+        answered = isYear ? ExecuteYear( command, measurementType, arguments, recordWriter )
+                          : ExecuteMonth( command, measurementType, arguments, recordWriter );
+    }
+    else if( measurementName == "direction" )
+    {
+        answered = ExecuteDirection( command, isYear, arguments, recordWriter );
+    }
+    else if( measurementName == "windrose" )
+    {
+        answered = ExecuteWindRose( command, isYear, arguments, recordWriter );
+    }
+    else if( command == "report" )
+    {
+        answered = ExecuteReport( command, arguments, recordWriter );
+    }
+    else if( command == "percentiles" )
+    {
+        answered = ExecutePercentiles( command, arguments, recordWriter );
+    }
+    else if( command == "above" )
+    {
+        answered = ExecuteAbove( command, arguments, recordWriter );
+    }
+    else if( command == "range" )
+    {
+        answered = ExecuteRange( command, arguments, recordWriter );
+    }
+    else if( command == "resample" )
+    {
+        answered = ExecuteResample( command, arguments, recordWriter );
+    }
+    else if( command == "rolling" )
+    {
+        answered = ExecuteRolling( command, arguments, recordWriter );
+    }
+    else if( command == "gaps" )
+    {
+        answered = ExecuteGaps( command, arguments, recordWriter );
+    }
+    else if( command == "sensor" )
+    {
+        answered = ExecuteSensor( command, arguments, recordWriter );
+    }
+    else
+    {
+        WriteError( query, "unknown command", recordWriter );
+        return false;
+    }
+
+    if( !answered )
+    {
+        WriteError( query, "invalid arguments", recordWriter );
+    }
+    return answered;
+}
+
+bool QueryEngine::Execute( const string &query, ostream &output )
+{
+    RecordWriter recordWriter( output );
+
+    return Execute( query, recordWriter );
+}
+
+unsigned QueryEngine::ExecuteAll( istream &input, ostream &output, OutputFormat outputFormat )
+{
+    RecordWriter recordWriter( output, outputFormat );
+    unsigned failures = 0;
+    string query;
+
+    while( getline( input, query ) )
+    {
+        if( !query.empty() && query.back() == '\r' )
+        {
+            query.pop_back();
+        }
+        if( !Execute( query, recordWriter ) )
+        {
+            failures++;
+        }
+    }
+    recordWriter.Finish();
+    return failures;
+}
+
+bool QueryEngine::ParseMeasurement( const string &name, MeasurementType &measurementType )
+{
+    if( name == "windspeed" )
+    {
+        measurementType = MeasurementType::WINDSPEED;
+    }
+    else if( name == "temperature" )
+    {
+        measurementType = MeasurementType::TEMPERATURE;
+    }
+    else if( name == "solar" )
+    {
+        measurementType = MeasurementType::SOLARRADIATION;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+string QueryEngine::GetMeasurementName( MeasurementType measurementType )
+{
+    switch( measurementType )
+    {
+    case MeasurementType::WINDSPEED:
+        return "windspeed";
+    case MeasurementType::TEMPERATURE:
+        return "temperature";
+    case MeasurementType::SOLARRADIATION:
+    default:
+        return "solar";
+    }
+}
+
+bool QueryEngine::ParseResolution( const string &name, Resolution &resolution )
+{
+    if( name == "hourly" )
+    {
+        resolution = Resolution::HOURLY;
+    }
+    else if( name == "daily" )
+    {
+        resolution = Resolution::DAILY;
+    }
+    else if( name == "weekly" )
+    {
+        resolution = Resolution::WEEKLY;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool QueryEngine::ParseWindow( const string &name, unsigned &width )
+{
+    unsigned count = 0;
+    const char *last = name.data() + name.size();
+    std::from_chars_result result = std::from_chars( name.data(), last, count );
+
+    // A number, then exactly one unit letter
+    if( result.ec != std::errc() || result.ptr + 1 != last || count == 0 )
+    {
+        return false;
+    }
+
+    char unit = *result.ptr;
+    if( unit == 'm' )
+    {
+        width = count;
+    }
+    else if( unit == 'h' )
+    {
+        width = count * Timestamp::MINUTES_PER_HOUR;
+    }
+    else if( unit == 'd' )
+    {
+        width = count * Timestamp::MINUTES_PER_DAY;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+bool QueryEngine::ParseFillMethod( const string &name, FillMethod &fillMethod )
+{
+    if( name == "linear" )
+    {
+        fillMethod = FillMethod::LINEAR;
+    }
+    else if( name == "last" )
+    {
+        fillMethod = FillMethod::LAST_VALUE;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+bool QueryEngine::ExecuteMonth( const string &command, MeasurementType measurementType, istream &arguments, RecordWriter &recordWriter )
+{
+    unsigned month = 0;
+    unsigned year = 0;
+
+    if( !ReadMonthYear( arguments, month, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    recordWriter.BeginRecord( command );
+    recordWriter.AddField( "year", year );
+    recordWriter.AddField( "month", month );
+    WriteSummary( m_client.GetMonthlySummary( m_summaryCube, month, year, measurementType ), measurementType, recordWriter );
+    recordWriter.EndRecord();
+    return true;
+}
+
+bool QueryEngine::ExecuteYear( const string &command, MeasurementType measurementType, istream &arguments, RecordWriter &recordWriter )
+{
+    unsigned year = 0;
+    MeasurementAccumulator monthlySummary[SummaryCube::MONTHS_IN_YEAR];
+
+    if( !ReadYear( arguments, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    m_client.GetYearlySummary( m_summaryCube, year, measurementType, monthlySummary );
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "year", year );
+        recordWriter.AddField( "month", month + 1 );
+        WriteSummary( monthlySummary[month], measurementType, recordWriter );
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteReport( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    unsigned year = 0;
+    MeasurementAccumulator windSpeedSummary[SummaryCube::MONTHS_IN_YEAR];
+    MeasurementAccumulator temperatureSummary[SummaryCube::MONTHS_IN_YEAR];
+    MeasurementAccumulator solarRadiationSummary[SummaryCube::MONTHS_IN_YEAR];
+
+    if( !ReadYear( arguments, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    m_client.GetYearlySummary( m_summaryCube, year, MeasurementType::WINDSPEED, windSpeedSummary );
+    m_client.GetYearlySummary( m_summaryCube, year, MeasurementType::TEMPERATURE, temperatureSummary );
+    m_client.GetYearlySummary( m_summaryCube, year, MeasurementType::SOLARRADIATION, solarRadiationSummary );
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "year", year );
+        recordWriter.AddField( "month", month + 1 );
+        recordWriter.AddField( "count", windSpeedSummary[month].GetCount() );
+        if( windSpeedSummary[month].GetCount() > 0 )
+        {
+            recordWriter.AddField( "windspeed_mean", windSpeedSummary[month].GetMean() );
+            recordWriter.AddField( "windspeed_stdev", windSpeedSummary[month].GetSampleStandardDeviation() );
+            recordWriter.AddField( "temperature_mean", temperatureSummary[month].GetMean() );
+            recordWriter.AddField( "temperature_stdev", temperatureSummary[month].GetSampleStandardDeviation() );
+            recordWriter.AddField( "solar_total", float( solarRadiationSummary[month].GetSum() / 60000 ) );
+        }
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecutePercentiles( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string measurementName;
+    MeasurementType measurementType;
+    unsigned month = 0;
+    unsigned year = 0;
+    float median = 0;
+    float p90 = 0;
+    float p95 = 0;
+    float p99 = 0;
+
+    if( !( arguments >> measurementName ) || !ParseMeasurement( measurementName, measurementType )
+            || !ReadMonthYear( arguments, month, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    recordWriter.BeginRecord( command );
+    recordWriter.AddField( "measurement", measurementName );
+    recordWriter.AddField( "year", year );
+    recordWriter.AddField( "month", month );
+    if( m_client.GetMonthlyPercentiles( m_summaryCube, month, year, measurementType, median, p90, p95, p99 ) )
+    {
+        recordWriter.AddField( "p50", median );
+        recordWriter.AddField( "p90", p90 );
+        recordWriter.AddField( "p95", p95 );
+        recordWriter.AddField( "p99", p99 );
+    }
+    else
+    {
+        recordWriter.AddField( "count", 0u );
+    }
+    recordWriter.EndRecord();
+    return true;
+}
+
+bool QueryEngine::ExecuteAbove( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string measurementName;
+    MeasurementType measurementType;
+    float threshold = 0;
+    unsigned year = 0;
+    MeasurementAccumulator monthlySummary[SummaryCube::MONTHS_IN_YEAR];
+
+    if( m_sensorRegistry == nullptr || !( arguments >> measurementName ) || !ParseMeasurement( measurementName, measurementType )
+            || !( arguments >> threshold ) || !isfinite( threshold ) || !ReadYear( arguments, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    m_client.GetMonthlySummariesAbove( *m_sensorRegistry, year, measurementType, threshold, monthlySummary );
+    for( unsigned month(0); month < SummaryCube::MONTHS_IN_YEAR; month++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "measurement", measurementName );
+        recordWriter.AddField( "threshold", threshold );
+        recordWriter.AddField( "year", year );
+        recordWriter.AddField( "month", month + 1 );
+        WriteSummary( monthlySummary[month], measurementType, recordWriter );
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteRange( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string measurementName;
+    MeasurementType measurementType;
+    Date startDate;
+    Date endDate;
+
+    if( !( arguments >> measurementName ) || !ParseMeasurement( measurementName, measurementType )
+            || !ReadDate( arguments, startDate ) || !ReadDate( arguments, endDate ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    recordWriter.BeginRecord( command );
+    recordWriter.AddField( "measurement", measurementName );
+    recordWriter.AddField( "start", FormatDate( startDate ) );
+    recordWriter.AddField( "end", FormatDate( endDate ) );
+    WriteSummary(
+        m_client.GetRangeSummary( m_prefixSumIndex, m_rangeExtremumIndex, startDate, endDate, measurementType ),
+        measurementType,
+        recordWriter );
+    recordWriter.EndRecord();
+    return true;
+}
+
+bool QueryEngine::ExecuteResample( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string measurementName;
+    string resolutionName;
+    MeasurementType measurementType;
+    Resolution resolution;
+    Date startDate;
+    Date endDate;
+    string fillName;
+    FillMethod fillMethod = FillMethod::NONE;
+    ResampledSeries series;
+
+    if( !( arguments >> measurementName ) || !ParseMeasurement( measurementName, measurementType )
+            || !( arguments >> resolutionName ) || !ParseResolution( resolutionName, resolution )
+            || !ReadDate( arguments, startDate ) || !ReadDate( arguments, endDate ) )
+    {
+        return false;
+    }
+    if( !IsExhausted( arguments )
+            && ( !( arguments >> fillName ) || !ParseFillMethod( fillName, fillMethod ) || !IsExhausted( arguments ) ) )
+    {
+        return false;
+    }
+
+    // One record per bucket holding data, or filled in, written as the series is walked
+    m_client.GetResampledSeries( m_prefixSumIndex, startDate, endDate, measurementType, resolution, series, fillMethod );
+    for( unsigned bucket(0); bucket < series.GetUsed(); bucket++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "measurement", measurementName );
+        recordWriter.AddField( "resolution", resolutionName );
+        recordWriter.AddField( "bucket", FormatTimestamp( series.GetBucketStarts()[bucket] ) );
+        recordWriter.AddField( "count", series.GetCounts()[bucket] );
+        recordWriter.AddField( "mean", series.GetMeans()[bucket] );
+        recordWriter.AddField( "min", series.GetMinimums()[bucket] );
+        recordWriter.AddField( "max", series.GetMaximums()[bucket] );
+        if( measurementType == MeasurementType::SOLARRADIATION )
+        {
+            recordWriter.AddField( "total", float( series.GetSums()[bucket] / 60000 ) );
+        }
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteRolling( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string measurementName;
+    string windowName;
+    MeasurementType measurementType;
+    unsigned width = 0;
+    Date startDate;
+    Date endDate;
+    RollingSeries series;
+
+    if( !( arguments >> measurementName ) || !ParseMeasurement( measurementName, measurementType )
+            || !( arguments >> windowName ) || !ParseWindow( windowName, width )
+            || !ReadDate( arguments, startDate ) || !ReadDate( arguments, endDate ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    m_client.GetRollingSeries( m_prefixSumIndex, startDate, endDate, measurementType, width, series );
+    for( unsigned entry(0); entry < series.GetUsed(); entry++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "measurement", measurementName );
+        recordWriter.AddField( "window", windowName );
+        recordWriter.AddField( "time", FormatTimestamp( series.GetTimestamps()[entry] ) );
+        recordWriter.AddField( "count", series.GetCounts()[entry] );
+        recordWriter.AddField( "mean", series.GetMeans()[entry] );
+        recordWriter.AddField( "stdev", series.GetStandardDeviations()[entry] );
+        recordWriter.AddField( "min", series.GetMinimums()[entry] );
+        recordWriter.AddField( "max", series.GetMaximums()[entry] );
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteGaps( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    Date startDate;
+    Date endDate;
+
+    if( m_gapList == nullptr || !ReadDate( arguments, startDate ) || !ReadDate( arguments, endDate ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    unsigned start = Timestamp::Pack( startDate, Time( 0, 0 ) );
+    unsigned end = Timestamp::Pack( endDate, Time( 0, 0 ) );
+    for( unsigned gap( m_gapList->FindFirst( start ) ); gap < m_gapList->GetUsed() && m_gapList->GetStart( gap ) < end; gap++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "start", FormatTimestamp( m_gapList->GetStart( gap ) ) );
+        recordWriter.AddField( "end", FormatTimestamp( m_gapList->GetEnd( gap ) ) );
+        recordWriter.AddField( "missing", m_gapList->GetMissingCount( gap, start, end ) );
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteSensor( const string &command, istream &arguments, RecordWriter &recordWriter )
+{
+    string code;
+    unsigned month = 0;
+    unsigned year = 0;
+
+    if( m_sensorRegistry == nullptr || !( arguments >> code ) || !ReadMonthYear( arguments, month, year ) || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    unsigned sensor = m_sensorRegistry->Find( code );
+    if( sensor == SensorRegistry::NOT_FOUND )
+    {
+        return false;
+    }
+
+    recordWriter.BeginRecord( command );
+    recordWriter.AddField( "sensor", code );
+    if( !m_sensorRegistry->GetName( sensor ).empty() )
+    {
+        recordWriter.AddField( "name", m_sensorRegistry->GetName( sensor ) );
+        recordWriter.AddField( "unit", m_sensorRegistry->GetUnit( sensor ) );
+    }
+    recordWriter.AddField( "year", year );
+    recordWriter.AddField( "month", month );
+    WriteStatistics( m_sensorRegistry->GetMonthlySummary( sensor, month, year ), recordWriter );
+    recordWriter.EndRecord();
+    return true;
+}
+
+bool QueryEngine::ExecuteDirection( const string &command, const bool &isYear, istream &arguments, RecordWriter &recordWriter )
+{
+    unsigned month = 0;
+    unsigned year = 0;
+    bool isRead = isYear ? ReadYear( arguments, year ) : ReadMonthYear( arguments, month, year );
+
+    if( m_sensorRegistry == nullptr || !isRead || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    unsigned sensor = m_sensorRegistry->Find( SensorRegistry::WINDDIRECTION_CODE );
+    unsigned firstMonth = isYear ? 1 : month;
+    unsigned lastMonth = isYear ? SummaryCube::MONTHS_IN_YEAR : month;
+    for( month = firstMonth; month <= lastMonth; month++ )
+    {
+        DirectionAccumulator direction = m_sensorRegistry->GetMonthlyDirection( sensor, month, year );
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "year", year );
+        recordWriter.AddField( "month", month );
+        recordWriter.AddField( "count", direction.GetCount() );
+        if( direction.GetCount() > 0 )
+        {
+            recordWriter.AddField( "mean", direction.GetMeanDirection() );
+            recordWriter.AddField( "stdev", direction.GetCircularStandardDeviation() );
+            recordWriter.AddField( "resultant", direction.GetResultantLength() );
+        }
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+bool QueryEngine::ExecuteWindRose( const string &command, const bool &isYear, istream &arguments, RecordWriter &recordWriter )
+{
+    unsigned month = Client::ALL_MONTHS;
+    unsigned year = 0;
+    bool isRead = isYear ? ReadYear( arguments, year ) : ReadMonthYear( arguments, month, year );
+    WindRose windRose;
+
+    if( m_sensorRegistry == nullptr || !isRead || !IsExhausted( arguments ) )
+    {
+        return false;
+    }
+
+    m_client.GetWindRose( *m_sensorRegistry, month, year, windRose );
+    for( unsigned sector(0); sector < WindRose::SECTOR_COUNT; sector++ )
+    {
+        recordWriter.BeginRecord( command );
+        recordWriter.AddField( "year", year );
+        if( !isYear )
+        {
+            recordWriter.AddField( "month", month );
+        }
+        recordWriter.AddField( "sector", WindRose::GetSectorName( sector ) );
+        for( unsigned speedClass(0); speedClass < windRose.GetSpeedClassCount(); speedClass++ )
+        {
+            recordWriter.AddField( windRose.GetSpeedClassLabel( speedClass ), windRose.GetCount( sector, speedClass ) );
+        }
+        recordWriter.AddField( "total", windRose.GetSectorTotal( sector ) );
+        recordWriter.EndRecord();
+    }
+    return true;
+}
+
+void QueryEngine::WriteSummary( const MeasurementAccumulator &summary, MeasurementType measurementType, RecordWriter &recordWriter )
+{
+    WriteStatistics( summary, recordWriter );
+    if( summary.GetCount() > 0 && measurementType == MeasurementType::SOLARRADIATION )
+    {
+        recordWriter.AddField( "total", float( summary.GetSum() / 60000 ) );
+    }
+}
+
+void QueryEngine::WriteStatistics( const MeasurementAccumulator &summary, RecordWriter &recordWriter )
+{
+    recordWriter.AddField( "count", summary.GetCount() );
+    if( summary.GetCount() == 0 )
+    {
+        return;
+    }
+
+    recordWriter.AddField( "mean", summary.GetMean() );
+    recordWriter.AddField( "stdev", summary.GetSampleStandardDeviation() );
+    recordWriter.AddField( "min", summary.GetMinimum() );
+    recordWriter.AddField( "max", summary.GetMaximum() );
+}
+
+void QueryEngine::WriteError( const string &query, const string &message, RecordWriter &recordWriter )
+{
+    recordWriter.BeginRecord( "error" );
+    recordWriter.AddField( "message", message );
+    recordWriter.AddField( "query", query );
+    recordWriter.EndRecord();
+}
+
+bool QueryEngine::ReadMonthYear( istream &arguments, unsigned &month, unsigned &year )
+{
+    int monthRead = 0;
+
+    if( !( arguments >> monthRead ) || monthRead < 1 || monthRead > int( SummaryCube::MONTHS_IN_YEAR ) )
+    {
+        return false;
+    }
+    month = unsigned( monthRead );
+    return ReadYear( arguments, year );
+}
+
+bool QueryEngine::ReadYear( istream &arguments, unsigned &year )
+{
+    int yearRead = 0;
+
+    if( !( arguments >> yearRead ) || yearRead < 1970 )
+    {
+        return false;
+    }
+    year = unsigned( yearRead );
+    return true;
+}
+
+bool QueryEngine::ReadDate( istream &arguments, Date &date )
+{
+    string field;
+    int day = 0;
+    int month = 0;
+    int year = 0;
+    char firstSeparator = 0;
+    char secondSeparator = 0;
+
+    if( !( arguments >> field ) )
+    {
+        return false;
+    }
+
+    istringstream fieldStream( field );
+    if( !( fieldStream >> day >> firstSeparator >> month >> secondSeparator >> year )
+            || firstSeparator != '/' || secondSeparator != '/' || !IsExhausted( fieldStream )
+            || day < 1 || day > 31 || month < 1 || month > int( SummaryCube::MONTHS_IN_YEAR ) || year < 1970 )
+    {
+        return false;
+    }
+    date = Date( unsigned( day ), unsigned( month ), unsigned( year ) );
+    return true;
+}
+
+bool QueryEngine::IsExhausted( istream &arguments )
+{
+    arguments >> ws;
+    return arguments.eof();
+}
+
+string QueryEngine::FormatDate( const Date &date )
+{
+    return to_string( date.GetDay() ) + '/' + to_string( date.GetMonth() ) + '/' + to_string( date.GetYear() );
+}
+
+string QueryEngine::FormatTimestamp( const unsigned &timestamp )
+{
+    Date date;
+    Time time;
+    char text[32];
+
+    Timestamp::Unpack( timestamp, date, time );
+    snprintf( text, sizeof( text ), "%04u-%02u-%02uT%02u:%02u",
+              date.GetYear(), date.GetMonth(), date.GetDay(), time.GetHour(), time.GetMinute() );
+    return text;
+}
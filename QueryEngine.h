@@ -0,0 +1,355 @@
+/**
+ * @file QueryEngine.h
+ * @brief Defines the QueryEngine class, which answers text queries against the loaded dataset.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef QUERYENGINE_H_INCLUDED
+#define QUERYENGINE_H_INCLUDED
+
+#include<iostream>
+#include<string>
+
+#include "Client.h"
+#include "RecordWriter.h"
+#include "SensorRegistry.h"
+#include "GapList.h"
+
+/**
+* @brief Answers one line queries against the loaded dataset without any interactive input.
+*
+* A query is a command followed by its arguments, separated by blanks:
+*
+*   windspeed|temperature|solar <month> <year>          summary of one month
+*   windspeed-year|temperature-year|solar-year <year>   summary of each month of a year
+*   report <year>                                       the option 4 report of each month of a year
+*   percentiles <measurement> <month> <year>            median, 90th, 95th and 99th percentiles of a month
+*   above <measurement> <threshold> <year>              summary of the readings above a threshold in each month of a year
+*   range <measurement> <d/m/yyyy> <d/m/yyyy>           summary of [ start date, end date )
+*   resample <measurement> hourly|daily|weekly <d/m/yyyy> <d/m/yyyy> [ linear|last ]
+*                                                       summary of each bucket of [ start date, end date ),
+*                                                       empty buckets between them filled if asked
+*   rolling <measurement> <window> <d/m/yyyy> <d/m/yyyy>  moving window at each reading, the window such as 1h, 24h or 7d
+*   gaps <d/m/yyyy> <d/m/yyyy>                          missing 10 minute readings in [ start date, end date )
+*   sensor <code> <month> <year>                        summary of any sensor of the CSV header in one month
+*   direction <month> <year>                            circular mean and deviation of the wind direction of a month
+*   direction-year <year>                               circular mean and deviation of each month of a year
+*   windrose <month> <year>                             wind direction sector by wind speed class counts of a month
+*   windrose-year <year>                                wind direction sector by wind speed class counts of a year
+*
+* Blank lines and lines starting with '#' are ignored. Each answer is written as one or more
+* records of named fields whose first field is the command, so the output can be parsed without
+* knowing the query: by default one line of tab separated key=value fields per record, or JSON
+* objects through a RecordWriter. A query that cannot be answered is written as a single record
+* with an error field. Solar radiation totals are in kWh/m2, as in the menu.
+*/
+class QueryEngine
+{
+public:
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] client The client whose queries and query cache are used.
+    * @param[in] summaryCube The monthly rollup built by the Processor during loading.
+    * @param[in] prefixSumIndex The time ordered prefix sums built by the Processor during loading.
+    * @param[in] rangeExtremumIndex The range minimum and maximum index built by the Processor during loading.
+    * @param[in] sensorRegistry The sensor columns read by the Processor during loading, or null to answer no sensor,
+    * direction, wind rose or threshold queries.
+    * @param[in] gapList The missing intervals found by the Processor during loading, or null to answer no gap queries.
+    */
+    QueryEngine(
+        Client &client,
+        const SummaryCube &summaryCube,
+        const PrefixSumIndex &prefixSumIndex,
+        const RangeExtremumIndex &rangeExtremumIndex,
+        const SensorRegistry *sensorRegistry = nullptr,
+        const GapList *gapList = nullptr );
+
+    /**
+    * @brief Answers one query.
+    *
+    * @param[in] query The query line.
+    * @param[out] recordWriter The writer the answer records are written to.
+    * @return false if the query could not be answered, true otherwise, including for blank and comment lines.
+    */
+    bool Execute( const string &query, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers one query with text records.
+    *
+    * @param[in] query The query line.
+    * @param[out] output The stream the answer records are written to.
+    * @return false if the query could not be answered, true otherwise, including for blank and comment lines.
+    */
+    bool Execute( const string &query, ostream &output );
+
+    /**
+    * @brief Answers every query of a stream, one per line, in order.
+    *
+    * @param[in] input The stream of queries.
+    * @param[out] output The stream the answer records are written to.
+    * @param[in] outputFormat The format of the answer records.
+    * @return The number of queries that could not be answered.
+    */
+    unsigned ExecuteAll( istream &input, ostream &output, OutputFormat outputFormat = OutputFormat::TEXT );
+
+    /**
+    * @brief Converts a measurement name of a query to its type.
+    *
+    * @param[in] name One of windspeed, temperature or solar.
+    * @param[out] measurementType The type of the measurement.
+    * @return false if the name is not a measurement, true otherwise.
+    */
+    static bool ParseMeasurement( const string &name, MeasurementType &measurementType );
+
+    /**
+    * @brief Converts a measurement type to its name in queries.
+    *
+    * @param[in] measurementType Type of measurement.
+    * @return The name of the measurement.
+    */
+    static string GetMeasurementName( MeasurementType measurementType );
+
+    /**
+    * @brief Converts a resolution name of a query to its resolution.
+    *
+    * @param[in] name One of hourly, daily or weekly.
+    * @param[out] resolution The width of the buckets.
+    * @return false if the name is not a resolution, true otherwise.
+    */
+    static bool ParseResolution( const string &name, Resolution &resolution );
+
+    /**
+    * @brief Converts a window length of a query to minutes.
+    *
+    * @param[in] name A positive number of minutes, hours or days followed by m, h or d, such as 1h, 24h or 7d.
+    * @param[out] width The width of the window in minutes.
+    * @return false if the name is not a window length, true otherwise.
+    */
+    static bool ParseWindow( const string &name, unsigned &width );
+
+    /**
+    * @brief Converts a fill method name of a query to its fill method.
+    *
+    * @param[in] name One of linear or last.
+    * @param[out] fillMethod How the empty buckets are filled.
+    * @return false if the name is not a fill method, true otherwise.
+    */
+    static bool ParseFillMethod( const string &name, FillMethod &fillMethod );
+
+    /**
+    * @brief Formats a packed timestamp as yyyy-mm-ddThh:mm.
+    *
+    * @param[in] timestamp The packed timestamp.
+    * @return The formatted timestamp.
+    */
+    static string FormatTimestamp( const unsigned &timestamp );
+
+private:
+    Client &m_client;                                   ///< Client whose queries are used.
+    const SummaryCube &m_summaryCube;                   ///< Monthly rollup of the dataset.
+    const PrefixSumIndex &m_prefixSumIndex;             ///< Time ordered prefix sums of the dataset.
+    const RangeExtremumIndex &m_rangeExtremumIndex;     ///< Range minimum and maximum index of the dataset.
+    const SensorRegistry *m_sensorRegistry;             ///< Sensor columns of the dataset, or null.
+    const GapList *m_gapList;                           ///< Missing intervals of the dataset, or null.
+
+    /**
+    * @brief Answers the summary of one month, for example "windspeed 3 2016".
+    *
+    * @param[in] command The command of the query.
+    * @param[in] measurementType Type of measurement.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the record is written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteMonth( const string &command, MeasurementType measurementType, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the summary of each month of a year, for example "temperature-year 2015".
+    *
+    * @param[in] command The command of the query.
+    * @param[in] measurementType Type of measurement.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteYear( const string &command, MeasurementType measurementType, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the wind speed, temperature and solar radiation report of each month of a year.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteReport( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the percentiles of a measurement for one month.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the record is written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecutePercentiles( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the summary of the readings above a threshold in each month of a year,
+    * for example "above windspeed 25 2016".
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if there is no sensor registry or the arguments are invalid, true otherwise.
+    */
+    bool ExecuteAbove( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the summary of a measurement over a date range, including its minimum and maximum.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the record is written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteRange( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the buckets of a measurement resampled over a date range, one record per bucket holding data.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteResample( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers a moving window of a measurement over a date range, one record per reading.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if the arguments are invalid, true otherwise.
+    */
+    bool ExecuteRolling( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the gaps of the dataset over a date range, one record per gap with its missing readings in the range.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if there is no gap list or the arguments are invalid, true otherwise.
+    */
+    bool ExecuteGaps( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the summary of one sensor in one month, for example "sensor RH 3 2016".
+    *
+    * @param[in] command The command of the query.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the record is written to.
+    * @return false if there is no sensor registry, the sensor is unknown or the arguments are invalid, true otherwise.
+    */
+    bool ExecuteSensor( const string &command, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the circular wind direction statistics of one month, for example "direction 3 2016",
+    * or of each month of a year, for example "direction-year 2016".
+    *
+    * @param[in] command The command of the query.
+    * @param[in] isYear Whether the arguments are a year instead of a month and a year.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if there is no sensor registry or the arguments are invalid, true otherwise.
+    */
+    bool ExecuteDirection( const string &command, const bool &isYear, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Answers the wind rose of one month, for example "windrose 3 2016", or of a whole year,
+    * for example "windrose-year 2016", as one record per sector with a count per speed class.
+    *
+    * @param[in] command The command of the query.
+    * @param[in] isYear Whether the arguments are a year instead of a month and a year.
+    * @param[in] arguments The arguments of the query.
+    * @param[out] recordWriter The writer the records are written to.
+    * @return false if there is no sensor registry or the arguments are invalid, true otherwise.
+    */
+    bool ExecuteWindRose( const string &command, const bool &isYear, istream &arguments, RecordWriter &recordWriter );
+
+    /**
+    * @brief Writes the fields of a summary, or only its count when it holds no readings.
+    *
+    * @param[in] summary The summary to write.
+    * @param[in] measurementType Type of measurement, adding the kWh/m2 total for solar radiation.
+    * @param[out] recordWriter The writer the fields are written to.
+    */
+    static void WriteSummary( const MeasurementAccumulator &summary, MeasurementType measurementType, RecordWriter &recordWriter );
+
+    /**
+    * @brief Writes the count, mean, deviation, minimum and maximum of a summary, or only its count when it holds no readings.
+    *
+    * @param[in] summary The summary.
+    * @param[out] recordWriter The writer the fields are written to.
+    */
+    static void WriteStatistics( const MeasurementAccumulator &summary, RecordWriter &recordWriter );
+
+    /**
+    * @brief Writes an error record.
+    *
+    * @param[in] query The query that could not be answered.
+    * @param[in] message The reason.
+    * @param[out] recordWriter The writer the record is written to.
+    */
+    static void WriteError( const string &query, const string &message, RecordWriter &recordWriter );
+
+    /**
+    * @brief Reads a month from 1 to 12 followed by a year.
+    *
+    * @param[in] arguments The arguments of the query.
+    * @param[out] month The month read.
+    * @param[out] year The year read.
+    * @return false if either is missing or invalid, true otherwise.
+    */
+    static bool ReadMonthYear( istream &arguments, unsigned &month, unsigned &year );
+
+    /**
+    * @brief Reads a year.
+    *
+    * @param[in] arguments The arguments of the query.
+    * @param[out] year The year read.
+    * @return false if it is missing or invalid, true otherwise.
+    */
+    static bool ReadYear( istream &arguments, unsigned &year );
+
+    /**
+    * @brief Reads a date written as d/m/yyyy.
+    *
+    * @param[in] arguments The arguments of the query.
+    * @param[out] date The date read.
+    * @return false if it is missing or invalid, true otherwise.
+    */
+    static bool ReadDate( istream &arguments, Date &date );
+
+    /**
+    * @brief Checks that every argument of a query was read.
+    *
+    * @param[in] arguments The arguments of the query.
+    * @return true if only blanks are left, false otherwise.
+    */
+    static bool IsExhausted( istream &arguments );
+
+    /**
+    * @brief Formats a date as d/m/yyyy, as queries write it.
+    *
+    * @param[in] date The date.
+    * @return The formatted date.
+    */
+    static string FormatDate( const Date &date );
+};
+
+#endif // QUERYENGINE_H_INCLUDED
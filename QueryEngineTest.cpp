@@ -0,0 +1,241 @@
+#include<iostream>
+#include<sstream>
+#include<algorithm>
+
+#include "QueryEngine.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+string Answer( QueryEngine &queryEngine, const string &query );
+void TestMonth( QueryEngine &queryEngine );
+void TestYearAndReport( QueryEngine &queryEngine );
+void TestPercentilesAndRange( QueryEngine &queryEngine );
+void TestErrors( QueryEngine &queryEngine );
+void TestExecuteAll( QueryEngine &queryEngine );
+void TestResample( QueryEngine &queryEngine );
+void TestJsonFormats( QueryEngine &queryEngine );
+void TestSensor( QueryEngine &queryEngine );
+void TestAbove( QueryEngine &queryEngine );
+
+int main()
+{
+    Client client;
+    SummaryCube summaryCube;
+    PrefixSumIndex prefixSumIndex;
+    RangeExtremumIndex rangeExtremumIndex;
+    SensorRegistry sensorRegistry;
+    GapList gapList;
+    WindRecType records[] =
+    {
+        WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 60000 ), Temperature( 20 ) ),
+        WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 4 ), SolarRadiation( 120000 ), Temperature( 22 ) ),
+        WindRecType( Date( 2, 3, 2016 ), Time( 9, 0 ), WindSpeed( 6 ), SolarRadiation( 0 ), Temperature( 24 ) ),
+        WindRecType( Date( 1, 4, 2016 ), Time( 9, 0 ), WindSpeed( 10 ), SolarRadiation( 0 ), Temperature( 30 ) )
+    };
+
+    for( const WindRecType &record : records )
+    {
+        summaryCube.Add( record );
+        prefixSumIndex.Append( record );
+        gapList.Append( Timestamp::Pack( record.GetRecordDate(), record.GetRecordTime() ) );
+    }
+    rangeExtremumIndex.Build( prefixSumIndex );
+    sensorRegistry.ReadHeader( "WAST,S,SR,T,RH,Dta" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,2,60000,20,40,350" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,4,120000,22,,10" );
+    sensorRegistry.AppendLine( "2/3/2016 9:00,6,0,24,60," );
+    sensorRegistry.AppendLine( "1/4/2016 9:00,10,0,30,90,270" );
+
+    QueryEngine queryEngine( client, summaryCube, prefixSumIndex, rangeExtremumIndex, &sensorRegistry, &gapList );
+
+    TestMonth( queryEngine );
+    TestYearAndReport( queryEngine );
+    TestPercentilesAndRange( queryEngine );
+    TestErrors( queryEngine );
+    TestExecuteAll( queryEngine );
+    TestResample( queryEngine );
+    TestJsonFormats( queryEngine );
+    TestSensor( queryEngine );
+    TestAbove( queryEngine );
+
+    QueryEngine withoutSensors( client, summaryCube, prefixSumIndex, rangeExtremumIndex );
+    Assert( Answer( withoutSensors, "sensor RH 3 2016" ).compare( 0, 6, "error\t" ) == 0, "Sensor queries need a sensor registry" );
+    Assert( Answer( withoutSensors, "gaps 1/3/2016 2/3/2016" ).compare( 0, 6, "error\t" ) == 0, "Gap queries need a gap list" );
+    Assert( Answer( withoutSensors, "above windspeed 3 2016" ).compare( 0, 6, "error\t" ) == 0, "Threshold queries need a sensor registry" );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+string Answer( QueryEngine &queryEngine, const string &query )
+{
+    ostringstream output;
+
+    queryEngine.Execute( query, output );
+    return output.str();
+}
+
+void TestMonth( QueryEngine &queryEngine )
+{
+    cout << "Test on monthly queries" << endl;
+    Assert( Answer( queryEngine, "windspeed 3 2016" ) == "windspeed\tyear=2016\tmonth=3\tcount=3\tmean=4\tstdev=2\tmin=2\tmax=6\n", "Wind speed of March 2016 summarises its 3 records" );
+    Assert( Answer( queryEngine, "solar 3 2016" ).find( "\ttotal=3\n" ) != string::npos, "Solar radiation total is in kWh/m2" );
+    Assert( Answer( queryEngine, "temperature 5 2016" ) == "temperature\tyear=2016\tmonth=5\tcount=0\n", "Month without data has a count of 0" );
+    cout << endl;
+}
+
+void TestYearAndReport( QueryEngine &queryEngine )
+{
+    string year = Answer( queryEngine, "temperature-year 2016" );
+    string report = Answer( queryEngine, "report 2016" );
+
+    cout << "Test on yearly queries" << endl;
+    Assert( count( year.begin(), year.end(), '\n' ) == 12, "Year query has a record per month" );
+    Assert( year.find( "temperature-year\tyear=2016\tmonth=4\tcount=1\tmean=30\t" ) != string::npos, "April temperature mean is 30" );
+    Assert( count( report.begin(), report.end(), '\n' ) == 12, "Report has a record per month" );
+    Assert( report.find( "report\tyear=2016\tmonth=3\tcount=3\twindspeed_mean=4\twindspeed_stdev=2\ttemperature_mean=22\ttemperature_stdev=2\tsolar_total=3\n" ) != string::npos, "Report of March has every measurement" );
+    cout << endl;
+}
+
+void TestPercentilesAndRange( QueryEngine &queryEngine )
+{
+    cout << "Test on percentile and range queries" << endl;
+    Assert( Answer( queryEngine, "percentiles windspeed 3 2016" ).find( "\tp50=4\t" ) != string::npos, "Median wind speed of March is 4" );
+    Assert( Answer( queryEngine, "range temperature 1/3/2016 2/3/2016" ) == "range\tmeasurement=temperature\tstart=1/3/2016\tend=2/3/2016\tcount=2\tmean=21\tstdev=1.41421\tmin=20\tmax=22\n", "Range excludes its end date" );
+    cout << endl;
+}
+
+void TestErrors( QueryEngine &queryEngine )
+{
+    ostringstream output;
+
+    cout << "Test on invalid queries" << endl;
+    Assert( !queryEngine.Execute( "humidity 3 2016", output ), "Unknown command fails" );
+    Assert( !queryEngine.Execute( "windspeed 13 2016", output ), "Month out of range fails" );
+    Assert( !queryEngine.Execute( "report 2016 extra", output ), "Extra argument fails" );
+    Assert( !queryEngine.Execute( "range solar 1-3-2016 2/3/2016", output ), "Malformed date fails" );
+    Assert( output.str().find( "error\tmessage=unknown command\tquery=humidity 3 2016\n" ) == 0, "Error record echoes the query" );
+    Assert( queryEngine.Execute( "  # comment", output ) && queryEngine.Execute( "", output ), "Comments and blank lines are skipped" );
+    cout << endl;
+}
+
+void TestExecuteAll( QueryEngine &queryEngine )
+{
+    istringstream input( "windspeed 3 2016\r\n\n# nightly\nwindspeed 0 2016\nsolar-year 2016\n" );
+    ostringstream output;
+    unsigned failures = queryEngine.ExecuteAll( input, output );
+    string answers = output.str();
+
+    cout << "Test on a batch of queries" << endl;
+    Assert( failures == 1, "Batch counts its failed queries" );
+    Assert( count( answers.begin(), answers.end(), '\n' ) == 14, "Batch answers every query in order" );
+    Assert( answers.find( "windspeed\tyear=2016\tmonth=3\tcount=3" ) == 0, "Carriage returns are stripped" );
+    cout << endl;
+}
+
+void TestResample( QueryEngine &queryEngine )
+{
+    string daily = Answer( queryEngine, "resample windspeed daily 1/3/2016 1/4/2016" );
+
+    cout << "Test on resampled series" << endl;
+    Assert( daily == "resample\tmeasurement=windspeed\tresolution=daily\tbucket=2016-03-01T00:00\tcount=2\tmean=3\tmin=2\tmax=4\n"
+                     "resample\tmeasurement=windspeed\tresolution=daily\tbucket=2016-03-02T00:00\tcount=1\tmean=6\tmin=6\tmax=6\n",
+            "Each daily bucket holding data is one record" );
+    Assert( Answer( queryEngine, "resample solar hourly 1/3/2016 2/3/2016" ).find( "\tbucket=2016-03-01T09:00\tcount=2\tmean=90000\tmin=60000\tmax=120000\ttotal=3\n" ) != string::npos,
+            "Solar radiation buckets add the kWh/m2 total" );
+    Assert( Answer( queryEngine, "resample windspeed monthly 1/3/2016 1/4/2016" ).find( "error\tmessage=invalid arguments" ) == 0, "Unknown resolution is rejected" );
+
+    string rolling = Answer( queryEngine, "rolling windspeed 24h 1/3/2016 3/3/2016" );
+    Assert( rolling == "rolling\tmeasurement=windspeed\twindow=24h\ttime=2016-03-01T09:00\tcount=1\tmean=2\tstdev=0\tmin=2\tmax=2\n"
+                       "rolling\tmeasurement=windspeed\twindow=24h\ttime=2016-03-01T09:10\tcount=2\tmean=3\tstdev=1.41421\tmin=2\tmax=4\n"
+                       "rolling\tmeasurement=windspeed\twindow=24h\ttime=2016-03-02T09:00\tcount=2\tmean=5\tstdev=1.41421\tmin=4\tmax=6\n",
+            "A 24 hour window at each reading leaves out the reading 24 hours before" );
+    Assert( Answer( queryEngine, "rolling windspeed 1d 2/3/2016 3/3/2016" ).find( "\ttime=2016-03-02T09:00\tcount=2\tmean=5\t" ) != string::npos,
+            "The window of the first reading of a range holds the readings before the range" );
+    Assert( Answer( queryEngine, "rolling windspeed 0h 1/3/2016 3/3/2016" ).find( "error\t" ) == 0
+            && Answer( queryEngine, "rolling windspeed 24x 1/3/2016 3/3/2016" ).find( "error\t" ) == 0, "Invalid window length is rejected" );
+
+    string filled = Answer( queryEngine, "resample windspeed daily 1/3/2016 1/4/2016 linear" );
+    Assert( Answer( queryEngine, "resample windspeed daily 29/2/2016 1/4/2016 last" ) == daily && filled == daily,
+            "Adjacent daily buckets have nothing to fill" );
+    Assert( Answer( queryEngine, "resample windspeed hourly 1/3/2016 3/3/2016 last" ).find( "\tbucket=2016-03-01T10:00\tcount=0\tmean=3\tmin=3\tmax=3\n" ) != string::npos,
+            "Empty hourly buckets are filled with the last mean" );
+    Assert( Answer( queryEngine, "resample windspeed daily 1/3/2016 1/4/2016 cubic" ).find( "error\t" ) == 0, "Unknown fill method is rejected" );
+    Assert( Answer( queryEngine, "gaps 1/3/2016 2/3/2016" ) == "gaps\tstart=2016-03-01T09:20\tend=2016-03-02T09:00\tmissing=88\n",
+            "A gap is answered with its missing readings within the range" );
+    Assert( Answer( queryEngine, "gaps 1/3/2016 1/5/2016" ).find( "\tstart=2016-03-02T09:10\tend=2016-04-01T09:00\tmissing=" ) != string::npos,
+            "Every gap of the range is answered" );
+    cout << endl;
+}
+
+void TestJsonFormats( QueryEngine &queryEngine )
+{
+    istringstream ndjsonInput( "windspeed 3 2016\nfoo\n" );
+    istringstream jsonInput( "windspeed 5 2016\npercentiles solar 5 2016\n" );
+    istringstream emptyInput( "# nothing\n" );
+    ostringstream ndjson;
+    ostringstream json;
+    ostringstream empty;
+
+    queryEngine.ExecuteAll( ndjsonInput, ndjson, OutputFormat::NDJSON );
+    queryEngine.ExecuteAll( jsonInput, json, OutputFormat::JSON );
+    queryEngine.ExecuteAll( emptyInput, empty, OutputFormat::JSON );
+
+    cout << "Test on JSON answers" << endl;
+    Assert( ndjson.str() == "{\"command\":\"windspeed\",\"year\":2016,\"month\":3,\"count\":3,\"mean\":4,\"stdev\":2,\"min\":2,\"max\":6}\n"
+                            "{\"command\":\"error\",\"message\":\"unknown command\",\"query\":\"foo\"}\n",
+            "NDJSON writes one object per line" );
+    Assert( json.str() == "[{\"command\":\"windspeed\",\"year\":2016,\"month\":5,\"count\":0},"
+                          "{\"command\":\"percentiles\",\"measurement\":\"solar\",\"year\":2016,\"month\":5,\"count\":0}]\n",
+            "JSON writes every record into one array" );
+    Assert( empty.str() == "[]\n", "JSON without records is an empty array" );
+    cout << endl;
+}
+
+void TestSensor( QueryEngine &queryEngine )
+{
+    cout << "Test on sensor queries" << endl;
+    Assert( Answer( queryEngine, "sensor RH 3 2016" ) == "sensor\tsensor=RH\tname=Relative Humidity\tunit=%\tyear=2016\tmonth=3\tcount=2\tmean=50\tstdev=14.1421\tmin=40\tmax=60\n",
+            "Relative humidity of March 2016 leaves out its missing reading" );
+    Assert( Answer( queryEngine, "sensor DP 3 2016" ).find( "\tcount=0\n" ) != string::npos, "Sensor absent from the header has a count of 0" );
+    Assert( Answer( queryEngine, "sensor XX 3 2016" ).compare( 0, 6, "error\t" ) == 0, "Unknown sensor is an error" );
+    Assert( Answer( queryEngine, "direction 3 2016" ).find( "direction\tyear=2016\tmonth=3\tcount=2\tmean=0\tstdev=10.02" ) == 0,
+            "Wind direction of March 2016 is a circular mean across north" );
+    Assert( Answer( queryEngine, "direction-year 2016" ).find( "direction-year\tyear=2016\tmonth=4\tcount=1\tmean=270\t" ) != string::npos,
+            "Wind direction of each month of a year" );
+
+    string windRose = Answer( queryEngine, "windrose 3 2016" );
+    Assert( windRose.find( "windrose\tyear=2016\tmonth=3\tsector=N\t0-2=0\t2-4=1\t4-6=1\t6-8=0\t8-10=0\t10+=0\ttotal=2\n" ) == 0
+            && windRose.find( "sector=NNW\t" ) != string::npos, "Wind rose of March 2016 bins both directions across north" );
+    Assert( Answer( queryEngine, "windrose-year 2016" ).find( "windrose-year\tyear=2016\tsector=W\t0-2=0\t2-4=0\t4-6=0\t6-8=0\t8-10=0\t10+=1\ttotal=1\n" ) != string::npos,
+            "Wind rose of a year bins every month" );
+    cout << endl;
+}
+
+void TestAbove( QueryEngine &queryEngine )
+{
+    string above = Answer( queryEngine, "above windspeed 3 2016" );
+
+    cout << "Test on threshold queries" << endl;
+    Assert( count( above.begin(), above.end(), '\n' ) == 12, "Threshold query has a record per month" );
+    Assert( above.find( "above\tmeasurement=windspeed\tthreshold=3\tyear=2016\tmonth=3\tcount=2\tmean=5\tstdev=1.41421\tmin=4\tmax=6\n" ) != string::npos,
+            "Only readings above the threshold are summarised" );
+    Assert( above.find( "\tmonth=5\tcount=0\n" ) != string::npos, "Month without data has a count of 0" );
+    Assert( Answer( queryEngine, "above solar 60000 2016" ).find( "\tmonth=3\tcount=1\tmean=120000\tstdev=0\tmin=120000\tmax=120000\ttotal=2\n" ) != string::npos,
+            "Solar radiation above a threshold adds the kWh/m2 total" );
+    Assert( Answer( queryEngine, "above windspeed fast 2016" ).find( "error\t" ) == 0
+            && Answer( queryEngine, "above humidity 3 2016" ).find( "error\t" ) == 0, "Invalid threshold or measurement is rejected" );
+    cout << endl;
+}
@@ -0,0 +1,357 @@
+
+#include "QueryServer.h"
+
+#ifndef _WIN32
+#include<cerrno>
+#include<cstring>
+#include<vector>
+#include<fcntl.h>
+#include<poll.h>
+#include<sys/socket.h>
+#include<sys/stat.h>
+#include<sys/un.h>
+#include<unistd.h>
+#endif
+
+#ifndef MSG_NOSIGNAL
+#define MSG_NOSIGNAL 0
+#endif
+
+const unsigned QueryServer::MAXIMUM_QUERY_LENGTH;
+const int QueryServer::POLL_INTERVAL;
+
+QueryServer::Connection::Connection( const int &connectedSocket, WorkerPool &workerPool )
+    : socket( connectedSocket ),
+      client( workerPool ),
+      isBusy( false ),
+      isClosed( false ) {}
+
+QueryServer::QueryServer( const unsigned &threadCount )
+    : m_threadCount( threadCount ),
+      m_listener( -1 ),
+      m_wakeReader( -1 ),
+      m_wakeWriter( -1 ),
+      m_stopping( false ),
+      m_queries( 0 ) {}
+
+QueryServer::~QueryServer()
+{
+    CloseListener();
+}
+
+#ifndef _WIN32
+
+bool QueryServer::Listen( const string &socketPath )
+{
+    sockaddr_un address;
+
+    CloseListener();
+    if( socketPath.empty() || socketPath.size() >= sizeof( address.sun_path ) )
+    {
+        return false;
+    }
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    strcpy( address.sun_path, socketPath.c_str() );
+
+    // A socket left by a server that did not shut down cleanly is removed, but a live one is kept
+    struct stat status;
+    if( stat( socketPath.c_str(), &status ) == 0 )
+    {
+        int probe = socket( AF_UNIX, SOCK_STREAM, 0 );
+        bool isLive = probe >= 0 && connect( probe, ( sockaddr * ) &address, sizeof( address ) ) == 0;
+        if( probe >= 0 )
+        {
+            close( probe );
+        }
+        if( isLive || !S_ISSOCK( status.st_mode ) )
+        {
+            return false;
+        }
+        unlink( socketPath.c_str() );
+    }
+
+    m_listener = socket( AF_UNIX, SOCK_STREAM, 0 );
+    if( m_listener < 0 )
+    {
+        return false;
+    }
+    if( bind( m_listener, ( sockaddr * ) &address, sizeof( address ) ) != 0 || listen( m_listener, SOMAXCONN ) != 0 )
+    {
+        close( m_listener );
+        m_listener = -1;
+        return false;
+    }
+    m_socketPath = socketPath;
+    m_stopping = false;
+    return true;
+}
+
+void QueryServer::Serve()
+{
+    WorkerPool reductionPool( m_threadCount );
+    int wakePipe[2];
+
+    if( m_listener < 0 || pipe( wakePipe ) != 0 )
+    {
+        CloseListener();
+        return;
+    }
+    m_wakeReader = wakePipe[0];
+    m_wakeWriter = wakePipe[1];
+    fcntl( m_wakeReader, F_SETFL, O_NONBLOCK );
+    fcntl( m_wakeWriter, F_SETFL, O_NONBLOCK );
+
+    {
+        WorkerPool requestPool( m_threadCount );
+        std::vector<pollfd> watched;
+
+        while( !m_stopping )
+        {
+            ReleaseConnections( false );
+
+            // A connection a worker is answering is not watched, so each is read by one worker at a time
+            watched.clear();
+            watched.push_back( { m_listener, POLLIN, 0 } );
+            watched.push_back( { m_wakeReader, POLLIN, 0 } );
+            {
+                std::lock_guard<std::mutex> lock( m_connectionsMutex );
+                for( const auto &entry : m_connections )
+                {
+                    if( !entry.second->isBusy && !entry.second->isClosed )
+                    {
+                        watched.push_back( { entry.first, POLLIN, 0 } );
+                    }
+                }
+            }
+            if( poll( watched.data(), watched.size(), POLL_INTERVAL ) <= 0 )
+            {
+                continue;
+            }
+
+            char signals[64];
+            while( read( m_wakeReader, signals, sizeof( signals ) ) > 0 )
+            {
+            }
+
+            for( size_t i(2); i < watched.size(); i++ )
+            {
+                if( watched[i].revents == 0 )
+                {
+                    continue;
+                }
+                Connection *connection;
+                {
+                    std::lock_guard<std::mutex> lock( m_connectionsMutex );
+                    connection = m_connections[watched[i].fd];
+                    connection->isBusy = true;
+                }
+                requestPool.Submit( [this, connection]()
+                {
+                    ServeRequest( *connection );
+                } );
+            }
+
+            if( watched[0].revents & POLLIN )
+            {
+                int accepted = accept( m_listener, nullptr, nullptr );
+                if( accepted >= 0 )
+                {
+                    std::lock_guard<std::mutex> lock( m_connectionsMutex );
+                    m_connections[accepted] = new Connection( accepted, reductionPool );
+                }
+            }
+        }
+
+        // Connections still waiting to be accepted are closed like the open ones, not reset
+        std::lock_guard<std::mutex> lock( m_connectionsMutex );
+        fcntl( m_listener, F_SETFL, O_NONBLOCK );
+        for( int accepted = accept( m_listener, nullptr, nullptr ); accepted >= 0; accepted = accept( m_listener, nullptr, nullptr ) )
+        {
+            m_connections[accepted] = new Connection( accepted, reductionPool );
+        }
+
+        // Wake the workers blocked on a send, then the request pool is joined at the end of the block
+        for( const auto &entry : m_connections )
+        {
+            shutdown( entry.first, SHUT_RDWR );
+        }
+    }
+
+    ReleaseConnections( true );
+    close( m_wakeReader );
+    close( m_wakeWriter );
+    m_wakeReader = -1;
+    m_wakeWriter = -1;
+    CloseListener();
+}
+
+#else
+
+bool QueryServer::Listen( const string & )
+{
+    return false;
+}
+
+void QueryServer::Serve() {}
+
+#endif // _WIN32
+
+void QueryServer::Stop()
+{
+    m_stopping = true;
+}
+
+unsigned QueryServer::GetQueryCount() const
+{
+    return m_queries;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+#ifndef _WIN32
+
+void QueryServer::ServeRequest( Connection &connection )
+{
+    char buffer[MAXIMUM_QUERY_LENGTH];
+    bool isOpen = true;
+
+    ssize_t received = recv( connection.socket, buffer, sizeof( buffer ), MSG_DONTWAIT );
+    if( received < 0 && ( errno == EINTR || errno == EAGAIN || errno == EWOULDBLOCK ) )
+    {
+        received = 0;
+    }
+    else if( received <= 0 )
+    {
+        isOpen = false;
+    }
+
+    if( received > 0 )
+    {
+        connection.pending.append( buffer, size_t( received ) );
+
+        // Answer every complete line received from one snapshot, then send the answers together
+        std::shared_ptr<const DatasetSnapshot> snapshot = Processor::GetInstance().GetSnapshot();
+        ostringstream answers;
+        size_t lineStart = 0;
+        size_t lineEnd = connection.pending.find( '\n' );
+        while( lineEnd != string::npos )
+        {
+            string query = connection.pending.substr( lineStart, lineEnd - lineStart );
+            if( !query.empty() && query.back() == '\r' )
+            {
+                query.pop_back();
+            }
+            if( snapshot )
+            {
+                QueryEngine queryEngine(
+                    connection.client,
+                    snapshot->GetSummaryCube(),
+                    snapshot->GetPrefixSumIndex(),
+                    snapshot->GetRangeExtremumIndex(),
+                    &snapshot->GetSensorRegistry(),
+                    &snapshot->GetGapList() );
+                queryEngine.Execute( query, answers );
+            }
+            else
+            {
+                answers << "error\tmessage=no dataset loaded\tquery=" << query << '\n';
+            }
+            answers << '\n';
+            m_queries++;
+
+            lineStart = lineEnd + 1;
+            lineEnd = connection.pending.find( '\n', lineStart );
+        }
+        connection.pending.erase( 0, lineStart );
+
+        if( connection.pending.size() > MAXIMUM_QUERY_LENGTH )
+        {
+            answers << "error\tmessage=query too long\n\n";
+            isOpen = false;
+        }
+        if( !SendAll( connection.socket, answers.str() ) )
+        {
+            isOpen = false;
+        }
+    }
+
+    {
+        std::lock_guard<std::mutex> lock( m_connectionsMutex );
+        connection.isBusy = false;
+        connection.isClosed = !isOpen;
+    }
+
+    // A full pipe already holds a wake up for the serving thread
+    char signal = 0;
+    if( write( m_wakeWriter, &signal, 1 ) < 0 )
+    {
+        return;
+    }
+}
+
+void QueryServer::ReleaseConnections( const bool &isStopping )
+{
+    std::lock_guard<std::mutex> lock( m_connectionsMutex );
+
+    for( auto entry = m_connections.begin(); entry != m_connections.end(); )
+    {
+        Connection *connection = entry->second;
+        if( isStopping || ( connection->isClosed && !connection->isBusy ) )
+        {
+            close( connection->socket );
+            delete connection;
+            entry = m_connections.erase( entry );
+        }
+        else
+        {
+            ++entry;
+        }
+    }
+}
+
+bool QueryServer::SendAll( const int &connection, const string &data )
+{
+    size_t sent = 0;
+
+    while( sent < data.size() )
+    {
+        ssize_t written = send( connection, data.data() + sent, data.size() - sent, MSG_NOSIGNAL );
+        if( written < 0 && errno == EINTR )
+        {
+            continue;
+        }
+        if( written <= 0 )
+        {
+            return false;
+        }
+        sent += size_t( written );
+    }
+    return true;
+}
+
+void QueryServer::CloseListener()
+{
+    if( m_listener < 0 )
+    {
+        return;
+    }
+    close( m_listener );
+    unlink( m_socketPath.c_str() );
+    m_listener = -1;
+}
+
+#else
+
+void QueryServer::ServeRequest( Connection & ) {}
+
+void QueryServer::ReleaseConnections( const bool & ) {}
+
+bool QueryServer::SendAll( const int &, const string & )
+{
+    return false;
+}
+
+void QueryServer::CloseListener() {}
+
+#endif // _WIN32
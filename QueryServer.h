@@ -0,0 +1,154 @@
+/**
+ * @file QueryServer.h
+ * @brief Defines the QueryServer class, which answers queries from local clients over a Unix domain socket.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef QUERYSERVER_H_INCLUDED
+#define QUERYSERVER_H_INCLUDED
+
+#include<atomic>
+#include<mutex>
+#include<map>
+#include<string>
+
+#include "QueryEngine.h"
+#include "WorkerPool.h"
+#include "Processor.h"
+
+/**
+* @brief Answers queries from local clients over a Unix domain socket against the published dataset snapshot.
+*
+* The protocol is the QueryEngine line protocol: a client writes one query per line and, for each
+* query in order, reads its answer records followed by an empty line. Several queries may be written
+* before reading their answers. The serving thread waits on every open connection at once, and each
+* batch of queries received on a connection is answered as one task of a WorkerPool, so an idle
+* connection holds no worker and any number of connections share the workers. Each connection keeps
+* its own Client and query cache, and the Clients run their record reductions on a second WorkerPool
+* shared by all of them, since a task must not wait on a ParallelFor() of its own pool.
+*
+* The queries received together are answered from the snapshot published by the Processor when they
+* arrived, so a reload publishing a new snapshot never blocks or tears a query in progress.
+*
+* The server is only available on POSIX systems. Elsewhere Listen() always fails.
+*/
+class QueryServer
+{
+public:
+    static const unsigned MAXIMUM_QUERY_LENGTH = 4096;  ///< Longest query line accepted, in bytes.
+    static const int POLL_INTERVAL = 200;               ///< Milliseconds between checks of the stop request.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] threadCount The number of requests answered at once, and of workers of the shared
+    * record reductions, or 0 for one per hardware thread.
+    */
+    QueryServer( const unsigned &threadCount = 0 );
+
+    /**
+    * @brief Destructor.
+    *
+    * Closes the listening socket and removes its path.
+    */
+    ~QueryServer();
+
+    QueryServer( const QueryServer & ) = delete;
+    QueryServer &operator = ( const QueryServer & ) = delete;
+
+    /**
+    * @brief Binds the listening socket, replacing a stale socket left at the path.
+    *
+    * @param[in] socketPath The file system path of the socket.
+    * @return false if the socket could not be created, true otherwise.
+    */
+    bool Listen( const string &socketPath );
+
+    /**
+    * @brief Accepts and serves connections until Stop() is called.
+    *
+    * On return every connection has been closed and the socket path removed.
+    *
+    * @pre Listen() succeeded.
+    */
+    void Serve();
+
+    /**
+    * @brief Requests Serve() to return within one poll interval.
+    *
+    * Only sets a flag, so it may be called from another thread or from a signal handler.
+    */
+    void Stop();
+
+    /**
+    * @brief Getter for the number of queries answered so far.
+    *
+    * @return The number of queries.
+    */
+    unsigned GetQueryCount() const;
+
+private:
+
+    /**
+    * @brief Represents an open connection and the queries it has sent so far.
+    */
+    struct Connection
+    {
+        int socket;                                     ///< Connected socket.
+        string pending;                                 ///< Received bytes after the last complete query.
+        Client client;                                  ///< Client of the queries of the connection.
+        bool isBusy;                                    ///< Whether a worker is answering the connection.
+        bool isClosed;                                  ///< Whether the connection is finished, closed by the serving thread.
+
+        /**
+        * @brief Parameterized constructor.
+        *
+        * @param[in] connectedSocket The connected socket.
+        * @param[in] workerPool The worker pool shared by the record reductions of every Client.
+        */
+        Connection( const int &connectedSocket, WorkerPool &workerPool );
+    };
+
+    unsigned m_threadCount;                             ///< Number of requests answered at once.
+    int m_listener;                                     ///< Listening socket, or -1.
+    int m_wakeReader;                                   ///< Read end of the pipe waking the serving thread, or -1.
+    int m_wakeWriter;                                   ///< Write end of the pipe a worker signals a finished request on, or -1.
+    string m_socketPath;                                ///< Path of the listening socket.
+    std::atomic<bool> m_stopping;                       ///< Set by Stop().
+    std::atomic<unsigned> m_queries;                    ///< Number of queries answered.
+    std::map<int, Connection *> m_connections;          ///< Open connections by socket.
+    std::mutex m_connectionsMutex;                      ///< Guards the open connections and their flags.
+
+    /**
+    * @brief Reads once from a connection and answers every complete query received, from one snapshot.
+    *
+    * Run as a task of the request pool when the connection is readable. The connection is flagged
+    * closed when the client closed it, failed or sent a query that is too long.
+    *
+    * @param[in] connection The connection, flagged busy by the serving thread.
+    */
+    void ServeRequest( Connection &connection );
+
+    /**
+    * @brief Closes and frees the closed connections that no worker is answering.
+    *
+    * @param[in] isStopping Whether every connection is closed, once no worker is running.
+    */
+    void ReleaseConnections( const bool &isStopping );
+
+    /**
+    * @brief Writes the whole of a buffer to a connection.
+    *
+    * @param[in] connection The connected socket.
+    * @param[in] data The bytes to write.
+    * @return false if the connection failed, true otherwise.
+    */
+    static bool SendAll( const int &connection, const string &data );
+
+    /**
+    * @brief Closes the listening socket and removes its path.
+    */
+    void CloseListener();
+};
+
+#endif // QUERYSERVER_H_INCLUDED
@@ -0,0 +1,237 @@
+#include<iostream>
+#include<thread>
+#include<string>
+
+#include "QueryServer.h"
+
+#ifndef _WIN32
+#include<cstring>
+#include<sys/socket.h>
+#include<sys/un.h>
+#include<unistd.h>
+#endif
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+
+#ifndef _WIN32
+
+int Connect( const string &socketPath );
+string Ask( const int &connection, const string &queries, const unsigned &answers );
+void TestQueries( const string &socketPath );
+void TestPipelinedQueries( const string &socketPath );
+void TestConcurrentClients( const string &socketPath );
+void TestIdleConnections( const string &socketPath );
+void TestReload( const string &socketPath );
+
+int main()
+{
+    std::shared_ptr<DatasetSnapshot> snapshot = std::make_shared<DatasetSnapshot>();
+    const string socketPath = "/tmp/QueryServerTest." + to_string( getpid() ) + ".sock";
+
+    WindRecType records[] =
+    {
+        WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 60000 ), Temperature( 20 ) ),
+        WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 4 ), SolarRadiation( 120000 ), Temperature( 22 ) ),
+        WindRecType( Date( 2, 3, 2016 ), Time( 9, 0 ), WindSpeed( 6 ), SolarRadiation( 0 ), Temperature( 24 ) )
+    };
+    for( const WindRecType &record : records )
+    {
+        snapshot->Append( record );
+    }
+    snapshot->BuildIndexes();
+    Processor::GetInstance().PublishSnapshot( snapshot );
+
+    QueryServer queryServer( 4 );
+
+    cout << "Test on listening" << endl;
+    Assert( !queryServer.Listen( "" ), "Empty socket path fails" );
+    Assert( queryServer.Listen( socketPath ), "Server listens on a fresh socket path" );
+    cout << endl;
+
+    thread serving( &QueryServer::Serve, &queryServer );
+
+    TestQueries( socketPath );
+    TestPipelinedQueries( socketPath );
+    TestConcurrentClients( socketPath );
+    TestIdleConnections( socketPath );
+    TestReload( socketPath );
+
+    int idle = Connect( socketPath );
+    queryServer.Stop();
+    serving.join();
+
+    char byte;
+    cout << "Test on stopping" << endl;
+    Assert( recv( idle, &byte, 1, 0 ) == 0, "Stopping closes idle connections" );
+    Assert( access( socketPath.c_str(), F_OK ) != 0, "Stopping removes the socket path" );
+    Assert( queryServer.GetQueryCount() == 14, "Every query is counted" );
+    cout << endl;
+    close( idle );
+
+    return 0;
+}
+
+#else
+
+int main()
+{
+    cout << "Test on QueryServer skipped, Unix domain sockets are not available" << endl;
+    return 0;
+}
+
+#endif // _WIN32
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+#ifndef _WIN32
+
+int Connect( const string &socketPath )
+{
+    sockaddr_un address;
+    int connection = socket( AF_UNIX, SOCK_STREAM, 0 );
+
+    memset( &address, 0, sizeof( address ) );
+    address.sun_family = AF_UNIX;
+    strcpy( address.sun_path, socketPath.c_str() );
+    if( connect( connection, ( sockaddr * ) &address, sizeof( address ) ) != 0 )
+    {
+        close( connection );
+        return -1;
+    }
+    return connection;
+}
+
+string Ask( const int &connection, const string &queries, const unsigned &answers )
+{
+    string reply;
+    char buffer[256];
+
+    send( connection, queries.data(), queries.size(), 0 );
+
+    // Each answer ends with an empty line
+    unsigned ended = 0;
+    while( ended < answers )
+    {
+        ssize_t received = recv( connection, buffer, sizeof( buffer ), 0 );
+        if( received <= 0 )
+        {
+            break;
+        }
+        reply.append( buffer, size_t( received ) );
+
+        ended = 0;
+        for( size_t found = reply.find( "\n\n" ); found != string::npos; found = reply.find( "\n\n", found + 1 ) )
+        {
+            ended++;
+        }
+    }
+    return reply;
+}
+
+void TestQueries( const string &socketPath )
+{
+    int connection = Connect( socketPath );
+
+    cout << "Test on queries over the socket" << endl;
+    Assert( connection >= 0, "Client connects to the server" );
+    Assert( Ask( connection, "windspeed 3 2016\n", 1 ) == "windspeed\tyear=2016\tmonth=3\tcount=3\tmean=4\tstdev=2\tmin=2\tmax=6\n\n", "Monthly query is answered and ended by an empty line" );
+    Assert( Ask( connection, "humidity 3 2016\n", 1 ) == "error\tmessage=unknown command\tquery=humidity 3 2016\n\n", "Invalid query is answered with an error" );
+    Assert( Ask( connection, "solar 3 2016\n", 1 ).find( "\ttotal=3\n" ) != string::npos, "Connection stays open after an error" );
+    cout << endl;
+    close( connection );
+}
+
+void TestPipelinedQueries( const string &socketPath )
+{
+    int connection = Connect( socketPath );
+    string reply = Ask( connection, "temperature 3 2016\nrange temperature 1/3/2016 2/3/2016\n", 2 );
+
+    cout << "Test on pipelined queries" << endl;
+    Assert( reply.find( "temperature\t" ) == 0, "First answer comes first" );
+    Assert( reply.find( "range\tmeasurement=temperature\tstart=1/3/2016\tend=2/3/2016\tcount=2\tmean=21" ) != string::npos, "Second answer follows" );
+    cout << endl;
+    close( connection );
+}
+
+void TestConcurrentClients( const string &socketPath )
+{
+    const unsigned clients = 6;
+    bool answered[clients];
+    thread threads[clients];
+
+    for( unsigned i(0); i < clients; i++ )
+    {
+        threads[i] = thread( [&socketPath, &answered, i]()
+        {
+            int connection = Connect( socketPath );
+            answered[i] = Ask( connection, "windspeed 3 2016\n", 1 ).find( "\tmean=4\t" ) != string::npos;
+            close( connection );
+        } );
+    }
+    for( unsigned i(0); i < clients; i++ )
+    {
+        threads[i].join();
+    }
+
+    bool allAnswered = true;
+    for( unsigned i(0); i < clients; i++ )
+    {
+        allAnswered = allAnswered && answered[i];
+    }
+
+    cout << "Test on concurrent clients" << endl;
+    Assert( allAnswered, "More clients than workers are all answered" );
+    cout << endl;
+}
+
+void TestIdleConnections( const string &socketPath )
+{
+    const unsigned idleCount = 6;
+    int idle[idleCount];
+
+    // More idle connections than workers, none of which sends a query
+    for( unsigned i(0); i < idleCount; i++ )
+    {
+        idle[i] = Connect( socketPath );
+    }
+    int connection = Connect( socketPath );
+
+    cout << "Test on idle connections" << endl;
+    Assert( Ask( connection, "windspeed 3 2016\n", 1 ).find( "\tmean=4\t" ) != string::npos, "Idle connections hold no worker" );
+    cout << endl;
+    close( connection );
+    for( unsigned i(0); i < idleCount; i++ )
+    {
+        close( idle[i] );
+    }
+}
+
+void TestReload( const string &socketPath )
+{
+    int connection = Connect( socketPath );
+    std::shared_ptr<DatasetSnapshot> reloaded = std::make_shared<DatasetSnapshot>();
+
+    reloaded->Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 12 ), SolarRadiation( 0 ), Temperature( 20 ) ) );
+    reloaded->BuildIndexes();
+
+    cout << "Test on reloading" << endl;
+    Assert( Ask( connection, "windspeed 3 2016\n", 1 ).find( "\tcount=3\t" ) != string::npos, "Open connection reads the published snapshot" );
+    Processor::GetInstance().PublishSnapshot( reloaded );
+    Assert( Ask( connection, "windspeed 3 2016\n", 1 ).find( "\tcount=1\tmean=12\t" ) != string::npos, "Same connection reads the reloaded snapshot" );
+    cout << endl;
+    close( connection );
+}
+
+#endif // _WIN32
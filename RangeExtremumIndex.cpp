@@ -0,0 +1,240 @@
+
+#include "RangeExtremumIndex.h"
+
+const unsigned RangeExtremumIndex::MEASUREMENT_TYPES;
+const unsigned RangeExtremumIndex::BLOCK_SIZE;
+const unsigned RangeExtremumIndex::MINIMUM;
+const unsigned RangeExtremumIndex::MAXIMUM;
+const unsigned RangeExtremumIndex::EXTREMA;
+
+RangeExtremumIndex::RangeExtremumIndex()
+{
+    m_prefixSumIndex = nullptr;
+    m_used = 0;
+}
+
+void RangeExtremumIndex::Build( const PrefixSumIndex &prefixSumIndex )
+{
+    Clear();
+    Extend( prefixSumIndex );
+}
+
+void RangeExtremumIndex::Extend( const PrefixSumIndex &prefixSumIndex )
+{
+    unsigned used = prefixSumIndex.GetUsed();
+
+    if( used < m_used )
+    {
+        Clear();
+    }
+    m_prefixSumIndex = &prefixSumIndex;
+
+    // The last block may have been partly filled, so its entries are recomputed with the new rows
+    unsigned firstBlock = m_used / BLOCK_SIZE;
+    if( firstBlock < m_offsets.GetUsed() )
+    {
+        for( unsigned type(0); type < MEASUREMENT_TYPES; type++ )
+        {
+            for( unsigned extremum(0); extremum < EXTREMA; extremum++ )
+            {
+                m_tables[type][extremum].SetSize( m_offsets[firstBlock] );
+            }
+        }
+        m_offsets.SetSize( firstBlock );
+    }
+
+    m_used = used;
+    unsigned blockCount = ( used + BLOCK_SIZE - 1 ) / BLOCK_SIZE;
+    for( unsigned block( firstBlock ); block < blockCount; block++ )
+    {
+        AppendBlock( block );
+    }
+}
+
+void RangeExtremumIndex::Clear()
+{
+    m_offsets.SetSize( 0 );
+    for( unsigned type(0); type < MEASUREMENT_TYPES; type++ )
+    {
+        for( unsigned extremum(0); extremum < EXTREMA; extremum++ )
+        {
+            m_tables[type][extremum].SetSize( 0 );
+        }
+    }
+    m_prefixSumIndex = nullptr;
+    m_used = 0;
+}
+
+unsigned RangeExtremumIndex::GetUsed() const
+{
+    return m_used;
+}
+
+bool RangeExtremumIndex::GetMinimum( const unsigned &start, const unsigned &end, MeasurementType measurementType, float &minimum, unsigned &timestamp ) const
+{
+    unsigned row = 0;
+
+    if( !FindExtremeRow( start, end, unsigned( measurementType ), MINIMUM, row ) )
+    {
+        return false;
+    }
+    minimum = m_prefixSumIndex->GetReadingAt( row, measurementType );
+    timestamp = m_prefixSumIndex->GetTimestampAt( row );
+    return true;
+}
+
+bool RangeExtremumIndex::GetMaximum( const unsigned &start, const unsigned &end, MeasurementType measurementType, float &maximum, unsigned &timestamp ) const
+{
+    unsigned row = 0;
+
+    if( !FindExtremeRow( start, end, unsigned( measurementType ), MAXIMUM, row ) )
+    {
+        return false;
+    }
+    maximum = m_prefixSumIndex->GetReadingAt( row, measurementType );
+    timestamp = m_prefixSumIndex->GetTimestampAt( row );
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void RangeExtremumIndex::AppendBlock( const unsigned &block )
+{
+    unsigned offset = m_tables[0][MINIMUM].GetUsed();
+    unsigned levels = FloorLog2( block + 1 ) + 1;
+    unsigned blockStart = block * BLOCK_SIZE;
+    unsigned blockEnd = ( blockStart + BLOCK_SIZE < m_used ) ? blockStart + BLOCK_SIZE : m_used;
+
+    m_offsets.InsertLast( offset );
+    for( unsigned type(0); type < MEASUREMENT_TYPES; type++ )
+    {
+        for( unsigned extremum(0); extremum < EXTREMA; extremum++ )
+        {
+            Vector<unsigned> &table = m_tables[type][extremum];
+            unsigned best = blockStart;
+
+            for( unsigned row( blockStart + 1 ); row < blockEnd; row++ )
+            {
+                if( IsBetter( type, extremum, row, best ) )
+                {
+                    best = row;
+                }
+            }
+            table.InsertLast( best );
+
+            // Level k joins the 2^(k-1) blocks ending here with the 2^(k-1) blocks before them
+            for( unsigned level(1); level < levels; level++ )
+            {
+                unsigned left = table[m_offsets[block - ( 1u << ( level - 1 ) )] + level - 1];
+                unsigned right = table[offset + level - 1];
+                table.InsertLast( IsBetter( type, extremum, left, right ) ? left : right );
+            }
+        }
+    }
+}
+
+bool RangeExtremumIndex::FindExtremeRow( const unsigned &start, const unsigned &end, const unsigned &type, const unsigned &extremum, unsigned &row ) const
+{
+    // The rows are only in time order, and all there, while the prefix sum index is built
+    if( end <= start || m_prefixSumIndex == nullptr || !m_prefixSumIndex->IsBuilt() || m_prefixSumIndex->GetUsed() < m_used )
+    {
+        return false;
+    }
+
+    unsigned first = LowerBound( start );
+    unsigned last = LowerBound( end );
+    if( first == last )
+    {
+        return false;
+    }
+
+    unsigned firstBlock = first / BLOCK_SIZE;
+    unsigned lastBlock = ( last - 1 ) / BLOCK_SIZE;
+    unsigned leftEnd = ( firstBlock == lastBlock ) ? last : ( firstBlock + 1 ) * BLOCK_SIZE;
+    unsigned best = first;
+
+    for( unsigned i( first + 1 ); i < leftEnd; i++ )
+    {
+        if( IsBetter( type, extremum, i, best ) )
+        {
+            best = i;
+        }
+    }
+    if( firstBlock == lastBlock )
+    {
+        row = best;
+        return true;
+    }
+
+    if( firstBlock + 1 < lastBlock )
+    {
+        unsigned blocks = lastBlock - firstBlock - 1;
+        unsigned level = FloorLog2( blocks );
+        const Vector<unsigned> &table = m_tables[type][extremum];
+        unsigned left = table[m_offsets[firstBlock + ( 1u << level )] + level];
+        unsigned right = table[m_offsets[lastBlock - 1] + level];
+
+        if( IsBetter( type, extremum, left, best ) )
+        {
+            best = left;
+        }
+        if( IsBetter( type, extremum, right, best ) )
+        {
+            best = right;
+        }
+    }
+
+    for( unsigned i( lastBlock * BLOCK_SIZE ); i < last; i++ )
+    {
+        if( IsBetter( type, extremum, i, best ) )
+        {
+            best = i;
+        }
+    }
+    row = best;
+    return true;
+}
+
+bool RangeExtremumIndex::IsBetter( const unsigned &type, const unsigned &extremum, const unsigned &row, const unsigned &other ) const
+{
+    float reading = m_prefixSumIndex->GetReadingAt( row, MeasurementType( type ) );
+    float otherReading = m_prefixSumIndex->GetReadingAt( other, MeasurementType( type ) );
+
+    if( reading == otherReading )
+    {
+        return row < other;
+    }
+    return ( extremum == MINIMUM ) ? reading < otherReading : reading > otherReading;
+}
+
+unsigned RangeExtremumIndex::LowerBound( const unsigned &timestamp ) const
+{
+    unsigned low = 0;
+    unsigned high = m_used;
+
+    while( low < high )
+    {
+        unsigned middle = low + ( high - low ) / 2;
+        if( m_prefixSumIndex->GetTimestampAt( middle ) < timestamp )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
+
+unsigned RangeExtremumIndex::FloorLog2( unsigned value )
+{
+    unsigned level = 0;
+
+    while( value > 1 )
+    {
+        value >>= 1;
+        level++;
+    }
+    return level;
+}
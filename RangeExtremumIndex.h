@@ -0,0 +1,154 @@
+/**
+ * @file RangeExtremumIndex.h
+ * @brief Defines the RangeExtremumIndex class for constant time minimum and maximum over any time range.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef RANGEEXTREMUMINDEX_H_INCLUDED
+#define RANGEEXTREMUMINDEX_H_INCLUDED
+
+#include "Vector.h"
+#include "MeasurementType.h"
+#include "PrefixSumIndex.h"
+
+/**
+* @brief Represents a blocked sparse table of the minimum and maximum of each measurement over time.
+*
+* The time ordered rows of a PrefixSumIndex are split into blocks of BLOCK_SIZE rows. For every block,
+* level k of the sparse table holds the row of the extreme reading across the 2^k blocks ending there,
+* so any run of whole blocks is covered by two overlapping entries. A [start, end) query scans at most
+* two partial blocks at the edges and looks up the whole blocks between them, which bounds the work by
+* a constant while the table only needs ( n / BLOCK_SIZE ) log n entries.
+*
+* The entries of a block only cover the blocks before it, so rows appended in time order are indexed
+* by Extend() recomputing the entries of the last block and adding those of the new ones. The readings
+* themselves are read from the prefix sum index, which must outlive the index built from it.
+*
+* Ties are resolved to the earliest row, so the reported timestamp is the first time the extreme was seen.
+*/
+class RangeExtremumIndex
+{
+public:
+    static const unsigned MEASUREMENT_TYPES = 3;    ///< Number of measurement types indexed.
+    static const unsigned BLOCK_SIZE = 16;          ///< Number of rows scanned directly at each edge of a query.
+
+    /**
+    * @brief Default constructor.
+    * @post Creates an empty RangeExtremumIndex.
+    */
+    RangeExtremumIndex();
+
+    /**
+    * @brief Builds the sparse tables from the time ordered rows of a prefix sum index.
+    *
+    * @param[in] prefixSumIndex The prefix sum index to build from.
+    * @pre prefixSumIndex.IsBuilt() is true.
+    * @post The index holds the sparse tables of every row.
+    */
+    void Build( const PrefixSumIndex &prefixSumIndex );
+
+    /**
+    * @brief Extends the sparse tables with the rows appended to a prefix sum index since it was last built or extended.
+    *
+    * @param[in] prefixSumIndex The prefix sum index the index was built from, or any prefix sum index if it is empty.
+    * @pre prefixSumIndex.IsBuilt() is true, so the rows were appended in time order.
+    * @post The index holds the sparse tables of every row.
+    */
+    void Extend( const PrefixSumIndex &prefixSumIndex );
+
+    /**
+    * @brief Removes every row from the index.
+    * @post The index is empty.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of indexed rows.
+    *
+    * @return The number of rows.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Finds the smallest reading of a measurement over a time range.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @param[out] minimum The smallest reading in the range.
+    * @param[out] timestamp The packed timestamp of the earliest row holding the smallest reading.
+    * @return false if the range holds no rows or the prefix sum index is not built, true otherwise.
+    */
+    bool GetMinimum( const unsigned &start, const unsigned &end, MeasurementType measurementType, float &minimum, unsigned &timestamp ) const;
+
+    /**
+    * @brief Finds the largest reading of a measurement over a time range.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @param[out] maximum The largest reading in the range.
+    * @param[out] timestamp The packed timestamp of the earliest row holding the largest reading.
+    * @return false if the range holds no rows or the prefix sum index is not built, true otherwise.
+    */
+    bool GetMaximum( const unsigned &start, const unsigned &end, MeasurementType measurementType, float &maximum, unsigned &timestamp ) const;
+
+private:
+    static const unsigned MINIMUM = 0;      ///< Table of the smallest readings.
+    static const unsigned MAXIMUM = 1;      ///< Table of the largest readings.
+    static const unsigned EXTREMA = 2;      ///< Number of extremum tables per measurement.
+
+    const PrefixSumIndex *m_prefixSumIndex;                     ///< Time ordered rows the index was built from.
+    unsigned m_used;                                            ///< Number of indexed rows.
+    Vector<unsigned> m_offsets;                                 ///< Start of the entries of each block in the tables.
+    Vector<unsigned> m_tables[MEASUREMENT_TYPES][EXTREMA];      ///< Best rows of each block, level k at its offset plus k.
+
+    /**
+    * @brief Appends the sparse table entries of a block.
+    *
+    * @param[in] block The block following the last block with entries.
+    * @pre Every row of the block is indexed.
+    */
+    void AppendBlock( const unsigned &block );
+
+    /**
+    * @brief Finds the row of an extreme reading over a time range.
+    *
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] type The measurement type index.
+    * @param[in] extremum MINIMUM or MAXIMUM.
+    * @param[out] row The row of the extreme reading.
+    * @return false if the range holds no rows, true otherwise.
+    */
+    bool FindExtremeRow( const unsigned &start, const unsigned &end, const unsigned &type, const unsigned &extremum, unsigned &row ) const;
+
+    /**
+    * @brief Compares two rows of a measurement.
+    *
+    * @param[in] type The measurement type index.
+    * @param[in] extremum MINIMUM or MAXIMUM.
+    * @param[in] row The row to compare.
+    * @param[in] other The row to compare against.
+    * @return true if row holds the more extreme reading, or an equal reading earlier than other.
+    */
+    bool IsBetter( const unsigned &type, const unsigned &extremum, const unsigned &row, const unsigned &other ) const;
+
+    /**
+    * @brief Finds the first indexed row at or after a timestamp.
+    *
+    * @param[in] timestamp The packed timestamp to search for.
+    * @return The index of the first row not earlier than timestamp, GetUsed() if there is none.
+    */
+    unsigned LowerBound( const unsigned &timestamp ) const;
+
+    /**
+    * @brief Calculates the floor of the base 2 logarithm.
+    *
+    * @param[in] value The value, at least 1.
+    * @return The largest k with 2^k not greater than value.
+    */
+    static unsigned FloorLog2( unsigned value );
+};
+
+#endif // RANGEEXTREMUMINDEX_H_INCLUDED
@@ -0,0 +1,197 @@
+#include<iostream>
+#include<cstdlib>
+
+#include "RangeExtremumIndex.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestInitialization( const RangeExtremumIndex &rangeExtremumIndex );
+void TestExtremes( const RangeExtremumIndex &rangeExtremumIndex );
+void TestAgainstScan();
+void TestExtend();
+void TestClear( RangeExtremumIndex &rangeExtremumIndex );
+
+int main()
+{
+    RangeExtremumIndex emptyIndex;
+    PrefixSumIndex prefixSumIndex;
+    RangeExtremumIndex rangeExtremumIndex;
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 100 ), Temperature( 20 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 9, 10 ), WindSpeed( 9 ), SolarRadiation( 200 ), Temperature( 12 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 2, 3, 2016 ), Time( 9, 0 ), WindSpeed( 6 ), SolarRadiation( 300 ), Temperature( 31 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 3, 3, 2016 ), Time( 9, 0 ), WindSpeed( 9 ), SolarRadiation( 400 ), Temperature( 12 ) ) );
+    rangeExtremumIndex.Build( prefixSumIndex );
+
+    TestInitialization( emptyIndex );
+    TestExtremes( rangeExtremumIndex );
+    TestAgainstScan();
+    TestExtend();
+    TestClear( rangeExtremumIndex );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestInitialization( const RangeExtremumIndex &rangeExtremumIndex )
+{
+    float value = 0;
+    unsigned timestamp = 0;
+
+    cout << "Test on Default RangeExtremumIndex Object" << endl;
+    Assert( rangeExtremumIndex.GetUsed() == 0, "Default RangeExtremumIndex has no rows" );
+    Assert( !rangeExtremumIndex.GetMaximum( 0, 4000000000u, MeasurementType::WINDSPEED, value, timestamp ), "Default RangeExtremumIndex has no maximum" );
+    cout << endl;
+}
+
+void TestExtremes( const RangeExtremumIndex &rangeExtremumIndex )
+{
+    unsigned firstDay = Timestamp::Pack( 1, 3, 2016 );
+    unsigned secondDay = Timestamp::Pack( 2, 3, 2016 );
+    unsigned fourthDay = Timestamp::Pack( 4, 3, 2016 );
+    float value = 0;
+    unsigned timestamp = 0;
+
+    cout << "Test on range extremes" << endl;
+    Assert( rangeExtremumIndex.GetMaximum( firstDay, fourthDay, MeasurementType::WINDSPEED, value, timestamp ) && value == 9, "Peak wind speed is 9" );
+    Assert( timestamp == Timestamp::Pack( 1, 3, 2016, 9, 10 ), "Tied peak reports the earliest timestamp" );
+    Assert( rangeExtremumIndex.GetMinimum( secondDay, fourthDay, MeasurementType::TEMPERATURE, value, timestamp ) && value == 12, "Minimum temperature from the second day is 12" );
+    Assert( timestamp == Timestamp::Pack( 3, 3, 2016, 9, 0 ), "Minimum temperature is on the third day" );
+    Assert( rangeExtremumIndex.GetMaximum( firstDay, secondDay, MeasurementType::TEMPERATURE, value, timestamp ) && value == 20, "End of the range is excluded" );
+    Assert( !rangeExtremumIndex.GetMinimum( fourthDay, fourthDay + 1, MeasurementType::SOLARRADIATION, value, timestamp ), "Range past the last row has no minimum" );
+    cout << endl;
+}
+
+void TestAgainstScan()
+{
+    PrefixSumIndex prefixSumIndex;
+    RangeExtremumIndex rangeExtremumIndex;
+    const unsigned rows = 1000;
+
+    srand( 283 );
+    for( unsigned i(0); i < rows; i++ )
+    {
+        unsigned minutes = i * 10;
+        prefixSumIndex.Append( WindRecType( Date( 1 + minutes / Timestamp::MINUTES_PER_DAY, 1, 2016 ), Time( ( minutes / 60 ) % 24, minutes % 60 ),
+                                            WindSpeed( rand() % 50 ), SolarRadiation( rand() % 1000 ), Temperature( rand() % 40 ) ) );
+    }
+    rangeExtremumIndex.Build( prefixSumIndex );
+
+    bool minimumMatches = true;
+    bool maximumMatches = true;
+    unsigned origin = Timestamp::Pack( 1, 1, 2016 );
+    for( unsigned query(0); query < 500; query++ )
+    {
+        unsigned first = rand() % rows;
+        unsigned last = first + 1 + rand() % ( rows - first );
+        MeasurementType type = MeasurementType( query % 3 );
+
+        unsigned minimumRow = first;
+        unsigned maximumRow = first;
+        for( unsigned i( first + 1 ); i < last; i++ )
+        {
+            minimumRow = ( prefixSumIndex.GetReadingAt( i, type ) < prefixSumIndex.GetReadingAt( minimumRow, type ) ) ? i : minimumRow;
+            maximumRow = ( prefixSumIndex.GetReadingAt( i, type ) > prefixSumIndex.GetReadingAt( maximumRow, type ) ) ? i : maximumRow;
+        }
+
+        float value = 0;
+        unsigned timestamp = 0;
+        rangeExtremumIndex.GetMinimum( origin + first * 10, origin + last * 10, type, value, timestamp );
+        minimumMatches = minimumMatches && value == prefixSumIndex.GetReadingAt( minimumRow, type ) && timestamp == prefixSumIndex.GetTimestampAt( minimumRow );
+        rangeExtremumIndex.GetMaximum( origin + first * 10, origin + last * 10, type, value, timestamp );
+        maximumMatches = maximumMatches && value == prefixSumIndex.GetReadingAt( maximumRow, type ) && timestamp == prefixSumIndex.GetTimestampAt( maximumRow );
+    }
+
+    cout << "Test on random ranges against a scan" << endl;
+    Assert( rangeExtremumIndex.GetUsed() == rows, "Index holds every row" );
+    Assert( minimumMatches, "Every minimum and its timestamp match a scan" );
+    Assert( maximumMatches, "Every maximum and its timestamp match a scan" );
+    cout << endl;
+}
+
+void TestExtend()
+{
+    PrefixSumIndex prefixSumIndex;
+    RangeExtremumIndex extendedIndex;
+    RangeExtremumIndex builtIndex;
+    const unsigned rows = 300;
+
+    srand( 3394 );
+    for( unsigned i(0); i < rows; i++ )
+    {
+        unsigned minutes = i * 10;
+        prefixSumIndex.Append( WindRecType( Date( 1 + minutes / Timestamp::MINUTES_PER_DAY, 1, 2016 ), Time( ( minutes / 60 ) % 24, minutes % 60 ),
+                                            WindSpeed( rand() % 50 ), SolarRadiation( rand() % 1000 ), Temperature( rand() % 40 ) ) );
+        if( i % 7 == 0 )
+        {
+            extendedIndex.Extend( prefixSumIndex );
+        }
+    }
+    extendedIndex.Extend( prefixSumIndex );
+    builtIndex.Build( prefixSumIndex );
+
+    bool matches = true;
+    unsigned origin = Timestamp::Pack( 1, 1, 2016 );
+    for( unsigned query(0); query < 500; query++ )
+    {
+        unsigned first = rand() % rows;
+        unsigned last = first + 1 + rand() % ( rows - first );
+        MeasurementType type = MeasurementType( query % 3 );
+        float extendedValue = 0;
+        float builtValue = 0;
+        unsigned extendedTimestamp = 0;
+        unsigned builtTimestamp = 0;
+
+        extendedIndex.GetMinimum( origin + first * 10, origin + last * 10, type, extendedValue, extendedTimestamp );
+        builtIndex.GetMinimum( origin + first * 10, origin + last * 10, type, builtValue, builtTimestamp );
+        matches = matches && extendedValue == builtValue && extendedTimestamp == builtTimestamp;
+        extendedIndex.GetMaximum( origin + first * 10, origin + last * 10, type, extendedValue, extendedTimestamp );
+        builtIndex.GetMaximum( origin + first * 10, origin + last * 10, type, builtValue, builtTimestamp );
+        matches = matches && extendedValue == builtValue && extendedTimestamp == builtTimestamp;
+    }
+
+    float value = 0;
+    unsigned timestamp = 0;
+    unsigned lastTimestamp = origin + rows * 10;
+
+    cout << "Test on extending with appended rows" << endl;
+    Assert( extendedIndex.GetUsed() == rows, "Extended index holds every row" );
+    Assert( matches, "Every extreme of the extended index matches the built index" );
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 2, 2016 ), Time( 0, 0 ), WindSpeed( 99 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    extendedIndex.Extend( prefixSumIndex );
+    Assert( extendedIndex.GetMaximum( origin, lastTimestamp + Timestamp::MINUTES_PER_DAY * 31, MeasurementType::WINDSPEED, value, timestamp ) && value == 99,
+            "Maximum includes the row appended last" );
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 1, 2015 ), Time( 0, 0 ), WindSpeed( 100 ), SolarRadiation( 0 ), Temperature( 0 ) ) );
+    Assert( !extendedIndex.GetMaximum( origin, lastTimestamp, MeasurementType::WINDSPEED, value, timestamp ), "No maximum while the rows are out of time order" );
+    prefixSumIndex.Build();
+    extendedIndex.Build( prefixSumIndex );
+    Assert( extendedIndex.GetMaximum( 0, lastTimestamp, MeasurementType::WINDSPEED, value, timestamp ) && value == 100, "Rebuilt index holds the row appended out of order" );
+    cout << endl;
+}
+
+void TestClear( RangeExtremumIndex &rangeExtremumIndex )
+{
+    float value = 0;
+    unsigned timestamp = 0;
+
+    rangeExtremumIndex.Clear();
+
+    cout << "Test on Clear" << endl;
+    Assert( rangeExtremumIndex.GetUsed() == 0, "Cleared RangeExtremumIndex has no rows" );
+    Assert( !rangeExtremumIndex.GetMinimum( 0, 4000000000u, MeasurementType::TEMPERATURE, value, timestamp ), "Cleared RangeExtremumIndex has no minimum" );
+    cout << endl;
+}
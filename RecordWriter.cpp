@@ -0,0 +1,138 @@
+
+#include "RecordWriter.h"
+
+RecordWriter::RecordWriter( ostream &output, OutputFormat outputFormat )
+    : m_outputFormat( outputFormat ),
+      m_text( output ),
+      m_json( output ),
+      m_recordCount( 0 ),
+      m_isFinished( false ) {}
+
+RecordWriter::~RecordWriter()
+{
+    Finish();
+}
+
+void RecordWriter::BeginRecord( string_view command )
+{
+    if( m_outputFormat == OutputFormat::TEXT )
+    {
+        m_text.Append( command );
+    }
+    else
+    {
+        BeginOutput();
+        m_json.BeginObject().Key( "command" ).Value( command );
+    }
+    m_recordCount++;
+}
+
+void RecordWriter::AddField( string_view key, string_view value )
+{
+    if( m_outputFormat == OutputFormat::TEXT )
+    {
+        m_text.Append( '\t' ).Append( key ).Append( '=' ).Append( value );
+    }
+    else
+    {
+        m_json.Key( key ).Value( value );
+    }
+}
+
+void RecordWriter::AddField( string_view key, const unsigned &value )
+{
+    if( m_outputFormat == OutputFormat::TEXT )
+    {
+        m_text.Append( '\t' ).Append( key ).Append( '=' ).Append( value );
+    }
+    else
+    {
+        m_json.Key( key ).Value( value );
+    }
+}
+
+void RecordWriter::AddField( string_view key, const float &value )
+{
+    if( m_outputFormat == OutputFormat::TEXT )
+    {
+        m_text.Append( '\t' ).Append( key ).Append( '=' ).Append( value );
+    }
+    else
+    {
+        m_json.Key( key ).Value( value );
+    }
+}
+
+void RecordWriter::EndRecord()
+{
+    switch( m_outputFormat )
+    {
+    case OutputFormat::TEXT:
+        m_text.Append( '\n' );
+        break;
+    case OutputFormat::NDJSON:
+        m_json.EndObject().NewLine();
+        break;
+    case OutputFormat::JSON:
+    default:
+        m_json.EndObject();
+        break;
+    }
+}
+
+void RecordWriter::Flush()
+{
+    m_text.Flush();
+    m_json.Flush();
+}
+
+void RecordWriter::Finish()
+{
+    if( m_isFinished )
+    {
+        return;
+    }
+    if( m_outputFormat == OutputFormat::JSON )
+    {
+        BeginOutput();
+        m_json.EndArray().NewLine();
+    }
+    Flush();
+    m_isFinished = true;
+}
+
+unsigned RecordWriter::GetRecordCount() const
+{
+    return m_recordCount;
+}
+
+bool RecordWriter::ParseOutputFormat( const string &name, OutputFormat &outputFormat )
+{
+    if( name == "text" )
+    {
+        outputFormat = OutputFormat::TEXT;
+    }
+    else if( name == "json" )
+    {
+        outputFormat = OutputFormat::JSON;
+    }
+    else if( name == "ndjson" )
+    {
+        outputFormat = OutputFormat::NDJSON;
+    }
+    else
+    {
+        return false;
+    }
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void RecordWriter::BeginOutput()
+{
+    if( m_outputFormat == OutputFormat::JSON && m_json.GetDepth() == 0 )
+    {
+        m_json.BeginArray();
+    }
+}
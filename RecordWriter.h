@@ -0,0 +1,129 @@
+/**
+ * @file RecordWriter.h
+ * @brief Defines the RecordWriter class, which streams flat result records as text, JSON or NDJSON.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef RECORDWRITER_H_INCLUDED
+#define RECORDWRITER_H_INCLUDED
+
+#include<iostream>
+#include<string>
+#include<string_view>
+
+#include "OutputFormat.h"
+#include "OutputBuffer.h"
+#include "JsonWriter.h"
+
+using namespace std;
+
+/**
+* @brief Writes the records of query answers, each a command followed by named fields, in one of the output formats.
+*
+* A record is written field by field as it is produced and nothing is kept once it ends, so any
+* number of records, such as the buckets of a long resampled series, is written in bounded memory.
+*
+*   TEXT     windspeed<TAB>year=2016<TAB>month=3<TAB>count=3 followed by a line break
+*   NDJSON   {"command":"windspeed","year":2016,"month":3,"count":3} followed by a line break
+*   JSON     the same objects as elements of a single array, closed by Finish()
+*
+* Numbers are written to 6 significant digits, as a default output stream does.
+*/
+class RecordWriter
+{
+public:
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] output The stream the records are written to.
+    * @param[in] outputFormat The format of the records.
+    */
+    RecordWriter( ostream &output, OutputFormat outputFormat = OutputFormat::TEXT );
+
+    /**
+    * @brief Destructor, finishing the output.
+    */
+    ~RecordWriter();
+
+    RecordWriter( const RecordWriter & ) = delete;
+    RecordWriter &operator = ( const RecordWriter & ) = delete;
+
+    /**
+    * @brief Starts a record.
+    *
+    * @param[in] command The command the record answers, its first field.
+    */
+    void BeginRecord( string_view command );
+
+    /**
+    * @brief Adds a text field to the current record.
+    *
+    * @param[in] key The name of the field.
+    * @param[in] value The text.
+    */
+    void AddField( string_view key, string_view value );
+
+    /**
+    * @brief Adds a count field to the current record.
+    *
+    * @param[in] key The name of the field.
+    * @param[in] value The count.
+    */
+    void AddField( string_view key, const unsigned &value );
+
+    /**
+    * @brief Adds a number field to the current record.
+    *
+    * @param[in] key The name of the field.
+    * @param[in] value The number.
+    */
+    void AddField( string_view key, const float &value );
+
+    /**
+    * @brief Ends the current record.
+    */
+    void EndRecord();
+
+    /**
+    * @brief Writes what is buffered to the stream without ending the output.
+    */
+    void Flush();
+
+    /**
+    * @brief Ends the output, closing the JSON array, and writes it to the stream.
+    *
+    * Nothing more can be written afterwards. Calling it again does nothing.
+    */
+    void Finish();
+
+    /**
+    * @brief Getter for the number of records written.
+    *
+    * @return The number of records.
+    */
+    unsigned GetRecordCount() const;
+
+    /**
+    * @brief Converts the name of an output format to the format.
+    *
+    * @param[in] name One of text, json or ndjson.
+    * @param[out] outputFormat The format.
+    * @return false if the name is not a format, true otherwise.
+    */
+    static bool ParseOutputFormat( const string &name, OutputFormat &outputFormat );
+
+private:
+    OutputFormat m_outputFormat;    ///< Format of the records.
+    OutputBuffer m_text;            ///< Buffer of the text records.
+    JsonWriter m_json;              ///< Writer of the JSON and NDJSON records.
+    unsigned m_recordCount;         ///< Number of records begun.
+    bool m_isFinished;              ///< Whether Finish() was called.
+
+    /**
+    * @brief Opens the JSON array before the first record, or when finishing without records.
+    */
+    void BeginOutput();
+};
+
+#endif // RECORDWRITER_H_INCLUDED
@@ -0,0 +1,87 @@
+#include<iostream>
+#include<sstream>
+
+#include "RecordWriter.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void WriteRecords( RecordWriter &recordWriter );
+void TestText();
+void TestJson();
+void TestParseOutputFormat();
+
+int main()
+{
+    TestText();
+    TestJson();
+    TestParseOutputFormat();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void WriteRecords( RecordWriter &recordWriter )
+{
+    recordWriter.BeginRecord( "windspeed" );
+    recordWriter.AddField( "month", 3u );
+    recordWriter.AddField( "mean", 4.5f );
+    recordWriter.EndRecord();
+    recordWriter.BeginRecord( "error" );
+    recordWriter.AddField( "query", "say \"hi\"" );
+    recordWriter.EndRecord();
+}
+
+void TestText()
+{
+    ostringstream output;
+    RecordWriter recordWriter( output );
+
+    WriteRecords( recordWriter );
+    bool heldBack = output.str().empty();
+    recordWriter.Finish();
+
+    cout << "Test on text records" << endl;
+    Assert( heldBack, "Records are buffered until finished" );
+    Assert( output.str() == "windspeed\tmonth=3\tmean=4.5\nerror\tquery=say \"hi\"\n", "Each record is a line of tab separated fields" );
+    Assert( recordWriter.GetRecordCount() == 2, "Records are counted" );
+    cout << endl;
+}
+
+void TestJson()
+{
+    ostringstream ndjson;
+    ostringstream json;
+    {
+        RecordWriter ndjsonWriter( ndjson, OutputFormat::NDJSON );
+        RecordWriter jsonWriter( json, OutputFormat::JSON );
+        WriteRecords( ndjsonWriter );
+        WriteRecords( jsonWriter );
+    }
+
+    cout << "Test on JSON records" << endl;
+    Assert( ndjson.str() == "{\"command\":\"windspeed\",\"month\":3,\"mean\":4.5}\n{\"command\":\"error\",\"query\":\"say \\\"hi\\\"\"}\n", "NDJSON writes an object per line" );
+    Assert( json.str() == "[{\"command\":\"windspeed\",\"month\":3,\"mean\":4.5},{\"command\":\"error\",\"query\":\"say \\\"hi\\\"\"}]\n", "JSON array is closed by the destructor" );
+    cout << endl;
+}
+
+void TestParseOutputFormat()
+{
+    OutputFormat outputFormat = OutputFormat::TEXT;
+
+    cout << "Test on output format names" << endl;
+    Assert( RecordWriter::ParseOutputFormat( "ndjson", outputFormat ) && outputFormat == OutputFormat::NDJSON, "ndjson is a format" );
+    Assert( !RecordWriter::ParseOutputFormat( "xml", outputFormat ) && outputFormat == OutputFormat::NDJSON, "Unknown format is rejected" );
+    cout << endl;
+}
@@ -0,0 +1,128 @@
+
+#include "ReportWriter.h"
+
+#include<charconv>
+#include<cstdio>
+
+const unsigned ReportWriter::MAXIMUM_ROW_LENGTH;
+const unsigned ReportWriter::MONTHS_IN_YEAR;
+
+ReportWriter::ReportWriter( const unsigned &rows )
+{
+    m_buffer.reserve( Constant::REPORT_HEADER.size() + 1 + rows * MAXIMUM_ROW_LENGTH );
+    Clear();
+}
+
+void ReportWriter::AddRow(
+    const unsigned &month,
+    const float &speedMean,
+    const float &speedSsd,
+    const float &tempMean,
+    const float &tempSsd,
+    const float &srSum )
+{
+    char row[MAXIMUM_ROW_LENGTH];
+    char *last = row + MAXIMUM_ROW_LENGTH;
+    string_view monthName = Date::GetMonthName( month );
+
+    char *next = row + monthName.copy( row, monthName.size() );
+    *next++ = ',';
+    next = FormatNumber( next, last, speedMean );
+    *next++ = '(';
+    next = FormatNumber( next, last, speedSsd );
+    *next++ = ')';
+    *next++ = ',';
+    next = FormatNumber( next, last, tempMean );
+    *next++ = '(';
+    next = FormatNumber( next, last, tempSsd );
+    *next++ = ')';
+    *next++ = ',';
+    next = FormatNumber( next, last, srSum / 60000 );
+    *next++ = '\n';
+
+    m_buffer.append( row, next );
+    m_rows++;
+}
+
+void ReportWriter::AddYear( const SummaryCube &summaryCube, const unsigned &year )
+{
+    for( unsigned month(1); month <= MONTHS_IN_YEAR; month++ )
+    {
+        const MeasurementAccumulator &windSpeed = summaryCube.GetMonthly( month, year, MeasurementType::WINDSPEED );
+        if( windSpeed.GetCount() == 0 )
+        {
+            continue;
+        }
+
+        const MeasurementAccumulator &temperature = summaryCube.GetMonthly( month, year, MeasurementType::TEMPERATURE );
+        AddRow(
+            month,
+            windSpeed.GetMean(),
+            windSpeed.GetSampleStandardDeviation(),
+            temperature.GetMean(),
+            temperature.GetSampleStandardDeviation(),
+            float( summaryCube.GetMonthly( month, year, MeasurementType::SOLARRADIATION ).GetSum() ) );
+    }
+}
+
+void ReportWriter::Clear()
+{
+    m_buffer.assign( Constant::REPORT_HEADER );
+    m_buffer.push_back( '\n' );
+    m_rows = 0;
+}
+
+unsigned ReportWriter::GetRowCount() const
+{
+    return m_rows;
+}
+
+const string &ReportWriter::GetContents() const
+{
+    return m_buffer;
+}
+
+bool ReportWriter::Write( const string &filePath, const bool &replaceAtomically ) const
+{
+    string writePath = replaceAtomically ? filePath + ".tmp" : filePath;
+    FILE *file = fopen( writePath.c_str(), "w" );
+
+    if( file == nullptr )
+    {
+        return false;
+    }
+
+    // Unbuffered, so the whole report goes to the file in a single write
+    setvbuf( file, nullptr, _IONBF, 0 );
+    bool isWritten = fwrite( m_buffer.data(), 1, m_buffer.size(), file ) == m_buffer.size();
+    isWritten = ( fclose( file ) == 0 ) && isWritten;
+
+    if( !isWritten )
+    {
+        remove( writePath.c_str() );
+        return false;
+    }
+    if( !replaceAtomically )
+    {
+        return true;
+    }
+
+    // POSIX rename replaces the report atomically. Where it cannot replace an existing file, remove it first.
+    if( rename( writePath.c_str(), filePath.c_str() ) != 0 )
+    {
+        remove( filePath.c_str() );
+        if( rename( writePath.c_str(), filePath.c_str() ) != 0 )
+        {
+            remove( writePath.c_str() );
+            return false;
+        }
+    }
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+char *ReportWriter::FormatNumber( char *first, char *last, const float &value )
+{
+    return std::to_chars( first, last, value, std::chars_format::general, 6 ).ptr;
+}
@@ -0,0 +1,111 @@
+/**
+ * @file ReportWriter.h
+ * @brief Defines the ReportWriter class, which builds the monthly CSV report in memory and writes it at once.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef REPORTWRITER_H_INCLUDED
+#define REPORTWRITER_H_INCLUDED
+
+#include<string>
+
+#include "Constant.h"
+#include "Date.h"
+#include "SummaryCube.h"
+
+using namespace std;
+
+/**
+* @brief Builds the option 4 CSV report of a year in one preallocated buffer and writes it with one write.
+*
+* The header is written when the writer is created, then each month with data adds one row of
+* average wind speed (stdev), average ambient temperature (stdev) and total solar radiation in kWh/m2.
+* Numbers are formatted with std::to_chars to the 6 significant digits of a default output stream,
+* so the file reads the same as one written with operator <<. Write() opens the output file once and
+* hands it the whole buffer unbuffered, and can write to a temporary file first and rename it over the
+* report, so a reader never sees a partly written report.
+*/
+class ReportWriter
+{
+public:
+    static const unsigned MAXIMUM_ROW_LENGTH = 128;     ///< Longest row, in bytes.
+    static const unsigned MONTHS_IN_YEAR = 12;          ///< Number of rows preallocated by default.
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] rows The number of rows to preallocate the buffer for.
+    * @post Creates a report holding only the header.
+    */
+    ReportWriter( const unsigned &rows = MONTHS_IN_YEAR );
+
+    /**
+    * @brief Appends the row of a month.
+    *
+    * @param[in] month The month, from 1 to 12.
+    * @param[in] speedMean The average wind speed.
+    * @param[in] speedSsd The sample standard deviation of wind speed.
+    * @param[in] tempMean The average ambient temperature.
+    * @param[in] tempSsd The sample standard deviation of ambient temperature.
+    * @param[in] srSum The sum of the solar radiation readings, written in kWh/m2.
+    */
+    void AddRow(
+        const unsigned &month,
+        const float &speedMean,
+        const float &speedSsd,
+        const float &tempMean,
+        const float &tempSsd,
+        const float &srSum );
+
+    /**
+    * @brief Appends the row of each month of a year with wind speed data, read from a summary cube.
+    *
+    * @param[in] summaryCube The monthly rollup of the dataset.
+    * @param[in] year The year of the report.
+    */
+    void AddYear( const SummaryCube &summaryCube, const unsigned &year );
+
+    /**
+    * @brief Removes every row, keeping the header and the preallocated buffer.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of rows.
+    *
+    * @return The number of rows, not counting the header.
+    */
+    unsigned GetRowCount() const;
+
+    /**
+    * @brief Getter for the report as it will be written.
+    *
+    * @return The header and the rows.
+    */
+    const string &GetContents() const;
+
+    /**
+    * @brief Writes the report to a file, replacing it.
+    *
+    * @param[in] filePath The path of the report.
+    * @param[in] replaceAtomically true to write to filePath + ".tmp" and rename it over the report.
+    * @return false if the report could not be written, true otherwise.
+    */
+    bool Write( const string &filePath, const bool &replaceAtomically = true ) const;
+
+private:
+    string m_buffer;        ///< Header and rows.
+    unsigned m_rows;        ///< Number of rows.
+
+    /**
+    * @brief Formats a number to 6 significant digits.
+    *
+    * @param[in] first The start of the space to format into.
+    * @param[in] last The end of the space to format into.
+    * @param[in] value The number.
+    * @return The end of the formatted number.
+    */
+    static char *FormatNumber( char *first, char *last, const float &value );
+};
+
+#endif // REPORTWRITER_H_INCLUDED
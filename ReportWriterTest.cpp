@@ -0,0 +1,97 @@
+#include<iostream>
+#include<fstream>
+#include<sstream>
+#include<cstdio>
+
+#include "ReportWriter.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+string ReadFile( const string &filePath );
+void TestInitialization( const ReportWriter &reportWriter );
+void TestRows();
+void TestWrite();
+
+int main()
+{
+    ReportWriter reportWriter;
+
+    TestInitialization( reportWriter );
+    TestRows();
+    TestWrite();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+string ReadFile( const string &filePath )
+{
+    ifstream inputFile( filePath );
+    ostringstream contents;
+
+    contents << inputFile.rdbuf();
+    return contents.str();
+}
+
+void TestInitialization( const ReportWriter &reportWriter )
+{
+    cout << "Test on Default ReportWriter Object" << endl;
+    Assert( reportWriter.GetRowCount() == 0, "Default ReportWriter has no rows" );
+    Assert( reportWriter.GetContents() == Constant::REPORT_HEADER + "\n", "Default ReportWriter holds the header" );
+    cout << endl;
+}
+
+void TestRows()
+{
+    ReportWriter reportWriter;
+    ostringstream expected;
+
+    reportWriter.AddRow( 3, 3.0f, 1.87083f, 25.5f, 0.333333f, 2460.0f );
+    reportWriter.AddRow( 12, 12.3456789f, 0.0f, -4.25f, 1e-7f, 0.0f );
+
+    // The same rows written with operator <<, as the report used to be
+    expected << Constant::REPORT_HEADER << '\n'
+             << "March," << 3.0f << "(" << 1.87083f << ")," << 25.5f << "(" << 0.333333f << ")," << 2460.0f / 60000 << '\n'
+             << "December," << 12.3456789f << "(" << 0.0f << ")," << -4.25f << "(" << 1e-7f << ")," << 0.0f / 60000 << '\n';
+
+    cout << "Test on rows" << endl;
+    Assert( reportWriter.GetRowCount() == 2, "Each row is counted" );
+    Assert( reportWriter.GetContents() == expected.str(), "Rows match the output stream format" );
+    reportWriter.Clear();
+    Assert( reportWriter.GetRowCount() == 0 && reportWriter.GetContents() == Constant::REPORT_HEADER + "\n", "Clear keeps only the header" );
+    cout << endl;
+}
+
+void TestWrite()
+{
+    const string filePath = "ReportWriterTest.csv";
+    ReportWriter reportWriter;
+
+    for( unsigned month(1); month <= 12; month++ )
+    {
+        reportWriter.AddRow( month, float( month ), 1.0f, 20.0f, 2.0f, 60000.0f );
+    }
+    remove( filePath.c_str() );
+
+    cout << "Test on writing" << endl;
+    Assert( reportWriter.Write( filePath, false ) && ReadFile( filePath ) == reportWriter.GetContents(), "Direct write holds every month" );
+    reportWriter.Clear();
+    reportWriter.AddRow( 1, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f );
+    Assert( reportWriter.Write( filePath ) && ReadFile( filePath ) == reportWriter.GetContents(), "Atomic write replaces the report" );
+    Assert( !ifstream( filePath + ".tmp" ), "Atomic write leaves no temporary file" );
+    Assert( !reportWriter.Write( "missing_directory/" + filePath ), "Write to a missing directory fails" );
+    cout << endl;
+    remove( filePath.c_str() );
+}
@@ -0,0 +1,69 @@
+
+#include "ResampledSeries.h"
+
+ResampledSeries::ResampledSeries() {}
+
+void ResampledSeries::Append( const unsigned &bucketStart, const unsigned &count, const double &sum, const float &minimum, const float &maximum )
+{
+    m_bucketStarts.InsertLast( bucketStart );
+    m_counts.InsertLast( count );
+    m_sums.InsertLast( sum );
+    m_means.InsertLast( float( sum / count ) );
+    m_minimums.InsertLast( minimum );
+    m_maximums.InsertLast( maximum );
+}
+
+void ResampledSeries::AppendFilled( const unsigned &bucketStart, const float &value )
+{
+    m_bucketStarts.InsertLast( bucketStart );
+    m_counts.InsertLast( 0 );
+    m_sums.InsertLast( 0.0 );
+    m_means.InsertLast( value );
+    m_minimums.InsertLast( value );
+    m_maximums.InsertLast( value );
+}
+
+void ResampledSeries::Clear()
+{
+    m_bucketStarts.SetSize( 0 );
+    m_counts.SetSize( 0 );
+    m_sums.SetSize( 0 );
+    m_means.SetSize( 0 );
+    m_minimums.SetSize( 0 );
+    m_maximums.SetSize( 0 );
+}
+
+unsigned ResampledSeries::GetUsed() const
+{
+    return m_bucketStarts.GetUsed();
+}
+
+const unsigned *ResampledSeries::GetBucketStarts() const
+{
+    return m_bucketStarts.Start();
+}
+
+const unsigned *ResampledSeries::GetCounts() const
+{
+    return m_counts.Start();
+}
+
+const double *ResampledSeries::GetSums() const
+{
+    return m_sums.Start();
+}
+
+const float *ResampledSeries::GetMeans() const
+{
+    return m_means.Start();
+}
+
+const float *ResampledSeries::GetMinimums() const
+{
+    return m_minimums.Start();
+}
+
+const float *ResampledSeries::GetMaximums() const
+{
+    return m_maximums.Start();
+}
@@ -0,0 +1,116 @@
+/**
+ * @file ResampledSeries.h
+ * @brief Defines the ResampledSeries class holding a bucketed time series as contiguous columns.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef RESAMPLEDSERIES_H_INCLUDED
+#define RESAMPLEDSERIES_H_INCLUDED
+
+#include "Vector.h"
+
+/**
+* @brief Represents a measurement resampled into fixed time buckets, one column per statistic.
+*
+* Bucket i starts at GetBucketStarts()[i], a packed Timestamp, and holds the count, sum, mean,
+* minimum and maximum of the readings inside it. Buckets without readings are not stored, so
+* consecutive bucket starts may be more than one bucket width apart, unless the series was filled
+* by Resampler::Fill(), which adds them with a count and sum of 0 and a filled in mean.
+*/
+class ResampledSeries
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty ResampledSeries.
+    */
+    ResampledSeries();
+
+    /**
+    * @brief Appends a bucket to the end of every column.
+    *
+    * @param[in] bucketStart The packed timestamp of the start of the bucket.
+    * @param[in] count The number of readings in the bucket, at least 1.
+    * @param[in] sum The sum of the readings.
+    * @param[in] minimum The smallest reading.
+    * @param[in] maximum The largest reading.
+    */
+    void Append( const unsigned &bucketStart, const unsigned &count, const double &sum, const float &minimum, const float &maximum );
+
+    /**
+    * @brief Appends a bucket without readings, filled in with an estimate.
+    *
+    * @param[in] bucketStart The packed timestamp of the start of the bucket.
+    * @param[in] value The estimate, used as the mean, minimum and maximum of the bucket.
+    * @post The bucket has a count and sum of 0.
+    */
+    void AppendFilled( const unsigned &bucketStart, const float &value );
+
+    /**
+    * @brief Removes every bucket from the columns.
+    *
+    * @post The ResampledSeries is empty.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of buckets.
+    *
+    * @return The number of buckets.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the column of bucket starts.
+    *
+    * @return Pointer to the packed timestamp of the first bucket.
+    */
+    const unsigned *GetBucketStarts() const;
+
+    /**
+    * @brief Getter for the column of reading counts.
+    *
+    * @return Pointer to the count of the first bucket.
+    */
+    const unsigned *GetCounts() const;
+
+    /**
+    * @brief Getter for the column of sums.
+    *
+    * @return Pointer to the sum of the first bucket.
+    */
+    const double *GetSums() const;
+
+    /**
+    * @brief Getter for the column of means.
+    *
+    * @return Pointer to the mean of the first bucket.
+    */
+    const float *GetMeans() const;
+
+    /**
+    * @brief Getter for the column of minimums.
+    *
+    * @return Pointer to the minimum of the first bucket.
+    */
+    const float *GetMinimums() const;
+
+    /**
+    * @brief Getter for the column of maximums.
+    *
+    * @return Pointer to the maximum of the first bucket.
+    */
+    const float *GetMaximums() const;
+
+private:
+    Vector<unsigned> m_bucketStarts;    ///< Packed timestamp of the start of each bucket.
+    Vector<unsigned> m_counts;          ///< Number of readings in each bucket.
+    Vector<double> m_sums;              ///< Sum of the readings in each bucket.
+    Vector<float> m_means;              ///< Mean of the readings in each bucket.
+    Vector<float> m_minimums;           ///< Smallest reading in each bucket.
+    Vector<float> m_maximums;           ///< Largest reading in each bucket.
+};
+
+#endif // RESAMPLEDSERIES_H_INCLUDED
@@ -0,0 +1,118 @@
+
+#include "Resampler.h"
+
+const unsigned Resampler::MINUTES_PER_WEEK;
+const unsigned Resampler::MONDAY_OFFSET;
+
+void Resampler::Resample(
+    const PrefixSumIndex &prefixSumIndex,
+    const unsigned &start,
+    const unsigned &end,
+    MeasurementType measurementType,
+    Resolution resolution,
+    ResampledSeries &series )
+{
+    series.Clear();
+    if( end <= start || !prefixSumIndex.IsBuilt() )
+    {
+        return;
+    }
+
+    unsigned first = prefixSumIndex.LowerBound( start );
+    unsigned last = prefixSumIndex.LowerBound( end );
+    unsigned width = GetBucketWidth( resolution );
+    unsigned bucketStart = 0;
+    unsigned bucketEnd = 0;
+    unsigned count = 0;
+    double sum = 0.0;
+    float minimum = 0.0;
+    float maximum = 0.0;
+
+    for( unsigned row( first ); row < last; row++ )
+    {
+        unsigned timestamp = prefixSumIndex.GetTimestampAt( row );
+        float reading = prefixSumIndex.GetReadingAt( row, measurementType );
+
+        if( count > 0 && timestamp >= bucketEnd )
+        {
+            series.Append( bucketStart, count, sum, minimum, maximum );
+            count = 0;
+        }
+        if( count == 0 )
+        {
+            bucketStart = GetBucketStart( timestamp, resolution );
+            bucketEnd = bucketStart + width;
+            sum = 0.0;
+            minimum = reading;
+            maximum = reading;
+        }
+
+        count ++;
+        sum += reading;
+        minimum = ( reading < minimum ) ? reading : minimum;
+        maximum = ( reading > maximum ) ? reading : maximum;
+    }
+    if( count > 0 )
+    {
+        series.Append( bucketStart, count, sum, minimum, maximum );
+    }
+}
+
+void Resampler::Fill( const ResampledSeries &series, Resolution resolution, FillMethod fillMethod, ResampledSeries &filled )
+{
+    unsigned width = GetBucketWidth( resolution );
+    const unsigned *starts = series.GetBucketStarts();
+    const float *means = series.GetMeans();
+
+    filled.Clear();
+    for( unsigned bucket(0); bucket < series.GetUsed(); bucket++ )
+    {
+        if( bucket > 0 && fillMethod != FillMethod::NONE )
+        {
+            unsigned previous = starts[bucket - 1];
+            float rise = means[bucket] - means[bucket - 1];
+            float run = float( starts[bucket] - previous );
+
+            for( unsigned start( previous + width ); start < starts[bucket]; start += width )
+            {
+                float value = means[bucket - 1];
+                if( fillMethod == FillMethod::LINEAR )
+                {
+                    value += rise * ( start - previous ) / run;
+                }
+                filled.AppendFilled( start, value );
+            }
+        }
+        filled.Append( starts[bucket], series.GetCounts()[bucket], series.GetSums()[bucket],
+                       series.GetMinimums()[bucket], series.GetMaximums()[bucket] );
+    }
+}
+
+unsigned Resampler::GetBucketWidth( Resolution resolution )
+{
+    switch( resolution )
+    {
+    case Resolution::HOURLY:
+        return Timestamp::MINUTES_PER_HOUR;
+    case Resolution::DAILY:
+        return Timestamp::MINUTES_PER_DAY;
+    case Resolution::WEEKLY:
+    default:
+        return MINUTES_PER_WEEK;
+    }
+}
+
+unsigned Resampler::GetBucketStart( const unsigned &timestamp, Resolution resolution )
+{
+    unsigned width = GetBucketWidth( resolution );
+
+    if( resolution != Resolution::WEEKLY )
+    {
+        return timestamp - timestamp % width;
+    }
+    if( timestamp < MONDAY_OFFSET )
+    {
+        return 0;
+    }
+    return timestamp - ( timestamp - MONDAY_OFFSET ) % width;
+}
@@ -0,0 +1,80 @@
+/**
+ * @file Resampler.h
+ * @brief Defines the Resampler class, which rolls the 10 minute readings up into hourly, daily or weekly buckets.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef RESAMPLER_H_INCLUDED
+#define RESAMPLER_H_INCLUDED
+
+#include "MeasurementType.h"
+#include "Resolution.h"
+#include "FillMethod.h"
+#include "PrefixSumIndex.h"
+#include "ResampledSeries.h"
+#include "Timestamp.h"
+
+/**
+* @brief Resamples a measurement into fixed width time buckets in one linear pass.
+*
+* The rows of a built PrefixSumIndex are already in time order, so every bucket is a run of
+* consecutive rows: the resampler keeps a single open bucket and appends it to the series when
+* a row falls past its end. Hourly and daily buckets start on the hour and at midnight, and
+* weekly buckets start at midnight on Monday.
+*/
+class Resampler
+{
+public:
+    static const unsigned MINUTES_PER_WEEK = 7 * Timestamp::MINUTES_PER_DAY;   ///< Width of a weekly bucket.
+    static const unsigned MONDAY_OFFSET = 4 * Timestamp::MINUTES_PER_DAY;      ///< Minutes from 1 January 1970 to the first Monday.
+
+    /**
+    * @brief Resamples a measurement over a time range.
+    *
+    * @param[in] prefixSumIndex The time ordered rows to resample.
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @param[in] resolution Width of the buckets.
+    * @param[out] series The buckets holding at least one reading, in time order, empty if the index is not built.
+    */
+    static void Resample(
+        const PrefixSumIndex &prefixSumIndex,
+        const unsigned &start,
+        const unsigned &end,
+        MeasurementType measurementType,
+        Resolution resolution,
+        ResampledSeries &series );
+
+    /**
+    * @brief Fills the empty buckets between the buckets of a resampled series, in one pass.
+    *
+    * Buckets before the first and after the last bucket holding data have no neighbour on one side
+    * and stay out, so only the range the readings span is filled.
+    *
+    * @param[in] series The buckets holding at least one reading, in time order.
+    * @param[in] resolution Width of the buckets of the series.
+    * @param[in] fillMethod How the empty buckets are filled, NONE to copy the series as it is.
+    * @param[out] filled The buckets of the series with the empty buckets between them, in time order.
+    */
+    static void Fill( const ResampledSeries &series, Resolution resolution, FillMethod fillMethod, ResampledSeries &filled );
+
+    /**
+    * @brief Getter for the width of a bucket.
+    *
+    * @param[in] resolution Width of the buckets.
+    * @return The number of minutes in a bucket.
+    */
+    static unsigned GetBucketWidth( Resolution resolution );
+
+    /**
+    * @brief Finds the start of the bucket holding a timestamp.
+    *
+    * @param[in] timestamp The packed timestamp.
+    * @param[in] resolution Width of the buckets.
+    * @return The packed timestamp of the start of the bucket.
+    */
+    static unsigned GetBucketStart( const unsigned &timestamp, Resolution resolution );
+};
+
+#endif // RESAMPLER_H_INCLUDED
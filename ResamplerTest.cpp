@@ -0,0 +1,134 @@
+#include<iostream>
+#include<cmath>
+
+#include "Resampler.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestBucketStarts();
+void TestHourly( const PrefixSumIndex &prefixSumIndex );
+void TestDaily( const PrefixSumIndex &prefixSumIndex );
+void TestWeekly( const PrefixSumIndex &prefixSumIndex );
+void TestEmptyRange( const PrefixSumIndex &prefixSumIndex );
+void TestFill( const PrefixSumIndex &prefixSumIndex );
+
+int main()
+{
+    PrefixSumIndex prefixSumIndex;
+
+    prefixSumIndex.Append( WindRecType( Date( 6, 3, 2016 ), Time( 23, 50 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 15 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 7, 3, 2016 ), Time( 9, 0 ), WindSpeed( 2 ), SolarRadiation( 100 ), Temperature( 20 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 7, 3, 2016 ), Time( 9, 10 ), WindSpeed( 4 ), SolarRadiation( 200 ), Temperature( 22 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 7, 3, 2016 ), Time( 10, 0 ), WindSpeed( 6 ), SolarRadiation( 300 ), Temperature( 24 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 8, 3, 2016 ), Time( 9, 0 ), WindSpeed( 8 ), SolarRadiation( 400 ), Temperature( 26 ) ) );
+
+    TestBucketStarts();
+    TestHourly( prefixSumIndex );
+    TestDaily( prefixSumIndex );
+    TestWeekly( prefixSumIndex );
+    TestEmptyRange( prefixSumIndex );
+    TestFill( prefixSumIndex );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestBucketStarts()
+{
+    unsigned timestamp = Timestamp::Pack( 9, 3, 2016, 13, 40 );
+
+    cout << "Test on bucket starts" << endl;
+    Assert( Resampler::GetBucketStart( timestamp, Resolution::HOURLY ) == Timestamp::Pack( 9, 3, 2016, 13, 0 ), "Hourly bucket starts on the hour" );
+    Assert( Resampler::GetBucketStart( timestamp, Resolution::DAILY ) == Timestamp::Pack( 9, 3, 2016 ), "Daily bucket starts at midnight" );
+    Assert( Resampler::GetBucketStart( timestamp, Resolution::WEEKLY ) == Timestamp::Pack( 7, 3, 2016 ), "Weekly bucket starts on Monday 7 March 2016" );
+    Assert( Resampler::GetBucketStart( Timestamp::Pack( 7, 3, 2016 ), Resolution::WEEKLY ) == Timestamp::Pack( 7, 3, 2016 ), "Monday midnight starts its own week" );
+    cout << endl;
+}
+
+void TestHourly( const PrefixSumIndex &prefixSumIndex )
+{
+    ResampledSeries series;
+
+    Resampler::Resample( prefixSumIndex, Timestamp::Pack( 7, 3, 2016 ), Timestamp::Pack( 8, 3, 2016 ), MeasurementType::WINDSPEED, Resolution::HOURLY, series );
+
+    cout << "Test on hourly resampling" << endl;
+    Assert( series.GetUsed() == 2, "7 March 2016 has 2 hourly buckets with data" );
+    Assert( series.GetBucketStarts()[0] == Timestamp::Pack( 7, 3, 2016, 9, 0 ), "First bucket starts at 9:00" );
+    Assert( series.GetCounts()[0] == 2 && series.GetSums()[0] == 6 && series.GetMeans()[0] == 3, "9:00 bucket has count 2, sum 6 and mean 3" );
+    Assert( series.GetMinimums()[0] == 2 && series.GetMaximums()[0] == 4, "9:00 bucket has minimum 2 and maximum 4" );
+    Assert( series.GetCounts()[1] == 1 && series.GetMeans()[1] == 6, "10:00 bucket has a single reading of 6" );
+    cout << endl;
+}
+
+void TestDaily( const PrefixSumIndex &prefixSumIndex )
+{
+    ResampledSeries series;
+
+    Resampler::Resample( prefixSumIndex, Timestamp::Pack( 1, 3, 2016 ), Timestamp::Pack( 1, 4, 2016 ), MeasurementType::TEMPERATURE, Resolution::DAILY, series );
+
+    cout << "Test on daily resampling" << endl;
+    Assert( series.GetUsed() == 3, "March 2016 has 3 daily buckets with data" );
+    Assert( series.GetCounts()[0] == 1 && series.GetCounts()[1] == 3 && series.GetCounts()[2] == 1, "23:50 stays in its own day" );
+    Assert( series.GetMeans()[1] == 22 && series.GetMaximums()[1] == 24, "7 March 2016 has mean 22 and maximum 24" );
+    cout << endl;
+}
+
+void TestWeekly( const PrefixSumIndex &prefixSumIndex )
+{
+    ResampledSeries series;
+
+    Resampler::Resample( prefixSumIndex, Timestamp::Pack( 1, 3, 2016 ), Timestamp::Pack( 1, 4, 2016 ), MeasurementType::SOLARRADIATION, Resolution::WEEKLY, series );
+
+    cout << "Test on weekly resampling" << endl;
+    Assert( series.GetUsed() == 2, "Sunday 6 March 2016 ends the first week" );
+    Assert( series.GetBucketStarts()[1] == Timestamp::Pack( 7, 3, 2016 ), "Second week starts on Monday 7 March 2016" );
+    Assert( series.GetCounts()[1] == 4 && series.GetSums()[1] == 1000, "Second week sums to 1000 over 4 readings" );
+    cout << endl;
+}
+
+void TestEmptyRange( const PrefixSumIndex &prefixSumIndex )
+{
+    ResampledSeries series;
+
+    series.Append( 0, 1, 1.0, 1.0f, 1.0f );
+    Resampler::Resample( prefixSumIndex, Timestamp::Pack( 1, 1, 2017 ), Timestamp::Pack( 1, 2, 2017 ), MeasurementType::WINDSPEED, Resolution::DAILY, series );
+
+    cout << "Test on a range without data" << endl;
+    Assert( series.GetUsed() == 0, "Resampling a range without data clears the series" );
+    cout << endl;
+}
+
+void TestFill( const PrefixSumIndex &prefixSumIndex )
+{
+    ResampledSeries series;
+    ResampledSeries linear;
+    ResampledSeries last;
+    ResampledSeries none;
+
+    Resampler::Resample( prefixSumIndex, Timestamp::Pack( 6, 3, 2016 ), Timestamp::Pack( 9, 3, 2016 ), MeasurementType::WINDSPEED, Resolution::HOURLY, series );
+    Resampler::Fill( series, Resolution::HOURLY, FillMethod::LINEAR, linear );
+    Resampler::Fill( series, Resolution::HOURLY, FillMethod::LAST_VALUE, last );
+    Resampler::Fill( series, Resolution::HOURLY, FillMethod::NONE, none );
+
+    cout << "Test on filling empty buckets" << endl;
+    Assert( series.GetUsed() == 4 && none.GetUsed() == 4, "Without a fill method the series is copied" );
+    Assert( linear.GetUsed() == 35 && linear.GetBucketStarts()[1] == Timestamp::Pack( 7, 3, 2016, 0, 0 )
+            && linear.GetBucketStarts()[34] == Timestamp::Pack( 8, 3, 2016, 9, 0 ), "Every empty hour between the first and last bucket is filled" );
+    Assert( linear.GetCounts()[1] == 0 && linear.GetSums()[1] == 0 && fabs( linear.GetMeans()[1] - 1.2f ) < 1e-5
+            && fabs( linear.GetMeans()[9] - 2.8f ) < 1e-5 && linear.GetMinimums()[9] == linear.GetMeans()[9], "Linear filling follows the line between neighbours" );
+    Assert( linear.GetCounts()[10] == 2 && linear.GetMeans()[10] == 3, "Buckets holding data are kept as they are" );
+    Assert( last.GetUsed() == 35 && last.GetMeans()[1] == 1 && last.GetMeans()[9] == 1 && last.GetMeans()[12] == 6, "Last value filling repeats the bucket before" );
+    cout << endl;
+}
@@ -0,0 +1,14 @@
+#ifndef RESOLUTION_H_INCLUDED
+#define RESOLUTION_H_INCLUDED
+
+/**
+* @brief Width of the buckets a measurement is resampled into.
+*/
+enum class Resolution
+{
+    HOURLY,
+    DAILY,
+    WEEKLY
+};
+
+#endif // RESOLUTION_H_INCLUDED
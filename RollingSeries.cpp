@@ -0,0 +1,64 @@
+#include "RollingSeries.h"
+
+RollingSeries::RollingSeries() {}
+
+void RollingSeries::Append(
+    const unsigned &timestamp,
+    const unsigned &count,
+    const float &mean,
+    const float &standardDeviation,
+    const float &minimum,
+    const float &maximum )
+{
+    m_timestamps.InsertLast( timestamp );
+    m_counts.InsertLast( count );
+    m_means.InsertLast( mean );
+    m_standardDeviations.InsertLast( standardDeviation );
+    m_minimums.InsertLast( minimum );
+    m_maximums.InsertLast( maximum );
+}
+
+void RollingSeries::Clear()
+{
+    m_timestamps.SetSize( 0 );
+    m_counts.SetSize( 0 );
+    m_means.SetSize( 0 );
+    m_standardDeviations.SetSize( 0 );
+    m_minimums.SetSize( 0 );
+    m_maximums.SetSize( 0 );
+}
+
+unsigned RollingSeries::GetUsed() const
+{
+    return m_timestamps.GetUsed();
+}
+
+const unsigned *RollingSeries::GetTimestamps() const
+{
+    return m_timestamps.Start();
+}
+
+const unsigned *RollingSeries::GetCounts() const
+{
+    return m_counts.Start();
+}
+
+const float *RollingSeries::GetMeans() const
+{
+    return m_means.Start();
+}
+
+const float *RollingSeries::GetStandardDeviations() const
+{
+    return m_standardDeviations.Start();
+}
+
+const float *RollingSeries::GetMinimums() const
+{
+    return m_minimums.Start();
+}
+
+const float *RollingSeries::GetMaximums() const
+{
+    return m_maximums.Start();
+}
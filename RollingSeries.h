@@ -0,0 +1,112 @@
+/**
+ * @file RollingSeries.h
+ * @brief Defines the RollingSeries class holding a moving window time series as contiguous columns.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef ROLLINGSERIES_H_INCLUDED
+#define ROLLINGSERIES_H_INCLUDED
+
+#include "Vector.h"
+
+/**
+* @brief Represents the statistics of a moving window at each reading, one column per statistic.
+*
+* Entry i is the window ending at the reading of GetTimestamps()[i], a packed Timestamp, and holds
+* the count, mean, standard deviation, minimum and maximum of the readings inside that window.
+*/
+class RollingSeries
+{
+public:
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty RollingSeries.
+    */
+    RollingSeries();
+
+    /**
+    * @brief Appends a window to the end of every column.
+    *
+    * @param[in] timestamp The packed timestamp of the reading ending the window.
+    * @param[in] count The number of readings in the window, at least 1.
+    * @param[in] mean The mean of the readings.
+    * @param[in] standardDeviation The sample standard deviation of the readings.
+    * @param[in] minimum The smallest reading.
+    * @param[in] maximum The largest reading.
+    */
+    void Append(
+        const unsigned &timestamp,
+        const unsigned &count,
+        const float &mean,
+        const float &standardDeviation,
+        const float &minimum,
+        const float &maximum );
+
+    /**
+    * @brief Removes every window from the columns.
+    *
+    * @post The RollingSeries is empty.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of windows.
+    *
+    * @return The number of windows.
+    */
+    unsigned GetUsed() const;
+
+    /**
+    * @brief Getter for the column of timestamps.
+    *
+    * @return Pointer to the packed timestamp ending the first window.
+    */
+    const unsigned *GetTimestamps() const;
+
+    /**
+    * @brief Getter for the column of reading counts.
+    *
+    * @return Pointer to the count of the first window.
+    */
+    const unsigned *GetCounts() const;
+
+    /**
+    * @brief Getter for the column of means.
+    *
+    * @return Pointer to the mean of the first window.
+    */
+    const float *GetMeans() const;
+
+    /**
+    * @brief Getter for the column of standard deviations.
+    *
+    * @return Pointer to the standard deviation of the first window.
+    */
+    const float *GetStandardDeviations() const;
+
+    /**
+    * @brief Getter for the column of minimums.
+    *
+    * @return Pointer to the minimum of the first window.
+    */
+    const float *GetMinimums() const;
+
+    /**
+    * @brief Getter for the column of maximums.
+    *
+    * @return Pointer to the maximum of the first window.
+    */
+    const float *GetMaximums() const;
+
+private:
+    Vector<unsigned> m_timestamps;          ///< Packed timestamp of the reading ending each window.
+    Vector<unsigned> m_counts;              ///< Number of readings in each window.
+    Vector<float> m_means;                  ///< Mean of the readings in each window.
+    Vector<float> m_standardDeviations;     ///< Sample standard deviation of the readings in each window.
+    Vector<float> m_minimums;               ///< Smallest reading in each window.
+    Vector<float> m_maximums;               ///< Largest reading in each window.
+};
+
+#endif // ROLLINGSERIES_H_INCLUDED
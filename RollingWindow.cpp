@@ -0,0 +1,157 @@
+#include "RollingWindow.h"
+
+#include<cmath>
+
+RollingWindow::RollingWindow( const unsigned &width )
+    : m_width( width )
+{
+    Clear();
+}
+
+void RollingWindow::Push( const unsigned &timestamp, const float &reading )
+{
+    if( timestamp >= m_width )
+    {
+        EvictUpTo( timestamp - m_width );
+    }
+    if( !std::isfinite( reading ) )
+    {
+        return;
+    }
+
+    if( m_entries.empty() )
+    {
+        m_shift = reading;
+    }
+    double shifted = double( reading ) - m_shift;
+    m_entries.push_back( { timestamp, reading } );
+    m_sum += shifted;
+    m_sumOfSquares += shifted * shifted;
+
+    while( !m_minimums.empty() && m_minimums.back().reading >= reading )
+    {
+        m_minimums.pop_back();
+    }
+    m_minimums.push_back( { timestamp, reading } );
+    while( !m_maximums.empty() && m_maximums.back().reading <= reading )
+    {
+        m_maximums.pop_back();
+    }
+    m_maximums.push_back( { timestamp, reading } );
+}
+
+void RollingWindow::Clear()
+{
+    m_entries.clear();
+    m_minimums.clear();
+    m_maximums.clear();
+    m_shift = 0.0;
+    m_sum = 0.0;
+    m_sumOfSquares = 0.0;
+}
+
+unsigned RollingWindow::GetWidth() const
+{
+    return m_width;
+}
+
+unsigned RollingWindow::GetCount() const
+{
+    return m_entries.size();
+}
+
+float RollingWindow::GetMean() const
+{
+    if( m_entries.empty() )
+    {
+        return 0.0;
+    }
+    return m_shift + m_sum / m_entries.size();
+}
+
+float RollingWindow::GetSampleStandardDeviation() const
+{
+    unsigned count = m_entries.size();
+    if( count < 2 )
+    {
+        return 0.0;
+    }
+
+    // Subtracting the evicted readings can leave a tiny negative sum for a constant window
+    double m2 = m_sumOfSquares - m_sum * m_sum / count;
+    return m2 > 0.0 ? sqrt( m2 / ( count - 1 ) ) : 0.0;
+}
+
+float RollingWindow::GetMinimum() const
+{
+    return m_minimums.empty() ? 0.0f : m_minimums.front().reading;
+}
+
+float RollingWindow::GetMaximum() const
+{
+    return m_maximums.empty() ? 0.0f : m_maximums.front().reading;
+}
+
+void RollingWindow::Roll(
+    const PrefixSumIndex &prefixSumIndex,
+    const unsigned &start,
+    const unsigned &end,
+    MeasurementType measurementType,
+    const unsigned &width,
+    RollingSeries &series )
+{
+    series.Clear();
+    if( end <= start || !prefixSumIndex.IsBuilt() )
+    {
+        return;
+    }
+
+    RollingWindow window( width );
+    unsigned first = prefixSumIndex.LowerBound( start > width ? start - width + 1 : 0 );
+    unsigned last = prefixSumIndex.LowerBound( end );
+
+    for( unsigned row( first ); row < last; row++ )
+    {
+        unsigned timestamp = prefixSumIndex.GetTimestampAt( row );
+
+        window.Push( timestamp, prefixSumIndex.GetReadingAt( row, measurementType ) );
+        if( timestamp >= start && window.GetCount() > 0 )
+        {
+            series.Append(
+                timestamp,
+                window.GetCount(),
+                window.GetMean(),
+                window.GetSampleStandardDeviation(),
+                window.GetMinimum(),
+                window.GetMaximum() );
+        }
+    }
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void RollingWindow::EvictUpTo( const unsigned &timestamp )
+{
+    while( !m_entries.empty() && m_entries.front().timestamp <= timestamp )
+    {
+        double shifted = double( m_entries.front().reading ) - m_shift;
+        m_sum -= shifted;
+        m_sumOfSquares -= shifted * shifted;
+        m_entries.pop_front();
+    }
+    while( !m_minimums.empty() && m_minimums.front().timestamp <= timestamp )
+    {
+        m_minimums.pop_front();
+    }
+    while( !m_maximums.empty() && m_maximums.front().timestamp <= timestamp )
+    {
+        m_maximums.pop_front();
+    }
+
+    // An empty window starts its sums again about its next reading, dropping any rounding left behind
+    if( m_entries.empty() )
+    {
+        m_sum = 0.0;
+        m_sumOfSquares = 0.0;
+    }
+}
@@ -0,0 +1,146 @@
+/**
+ * @file RollingWindow.h
+ * @brief Defines the RollingWindow class for moving statistics updated in constant time per reading.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef ROLLINGWINDOW_H_INCLUDED
+#define ROLLINGWINDOW_H_INCLUDED
+
+#include<deque>
+
+#include "MeasurementType.h"
+#include "PrefixSumIndex.h"
+#include "RollingSeries.h"
+
+/**
+* @brief Keeps the count, mean, deviation, minimum and maximum of the readings of a moving time window.
+*
+* The window ending at a reading at time t holds every reading after t - width up to t. Readings
+* are pushed in time order: each push appends the reading and evicts the readings that fell out of
+* the window from the front, so every reading enters and leaves once and a whole series costs O(n)
+* instead of the O(n * w) of recomputing each window.
+*
+* The sum and sum of squares are added to and subtracted from, kept about the first reading of the
+* window like the PrefixSumIndex so the variance does not cancel out. The minimum and maximum are
+* each the front of a monotonic deque: a new reading removes from the back every reading it beats,
+* since those can never be the extreme of a later window, which leaves the deque sorted.
+*/
+class RollingWindow
+{
+public:
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] width The width of the window in minutes, such as 60, 1440 or 10080 for an hour, a day or a week.
+    * @post Creates an empty RollingWindow.
+    */
+    RollingWindow( const unsigned &width );
+
+    /**
+    * @brief Moves the end of the window to a reading and adds the reading.
+    *
+    * @param[in] timestamp The packed timestamp of the reading, not earlier than the previous one.
+    * @param[in] reading The reading. A reading that is not a finite number only moves the window.
+    * @post The window holds the readings after timestamp - width up to timestamp.
+    */
+    void Push( const unsigned &timestamp, const float &reading );
+
+    /**
+    * @brief Removes every reading from the window.
+    *
+    * @post The window is empty and keeps its width.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the width of the window.
+    *
+    * @return The width in minutes.
+    */
+    unsigned GetWidth() const;
+
+    /**
+    * @brief Getter for the number of readings in the window.
+    *
+    * @return The number of readings.
+    */
+    unsigned GetCount() const;
+
+    /**
+    * @brief Calculates the mean of the readings in the window.
+    *
+    * @return The mean, 0 when the window is empty.
+    */
+    float GetMean() const;
+
+    /**
+    * @brief Calculates the sample standard deviation of the readings in the window.
+    *
+    * @return The standard deviation, 0 when the window holds fewer than 2 readings.
+    */
+    float GetSampleStandardDeviation() const;
+
+    /**
+    * @brief Getter for the smallest reading in the window.
+    *
+    * @return The smallest reading, 0 when the window is empty.
+    */
+    float GetMinimum() const;
+
+    /**
+    * @brief Getter for the largest reading in the window.
+    *
+    * @return The largest reading, 0 when the window is empty.
+    */
+    float GetMaximum() const;
+
+    /**
+    * @brief Rolls a window over a measurement, giving the window ending at each reading of a time range.
+    *
+    * The readings of the width before the range are pushed first, so the first windows of the range are full.
+    *
+    * @param[in] prefixSumIndex The time ordered rows to roll over.
+    * @param[in] start The packed timestamp of the start of the range, included.
+    * @param[in] end The packed timestamp of the end of the range, excluded.
+    * @param[in] measurementType Type of measurement.
+    * @param[in] width The width of the window in minutes.
+    * @param[out] series The window ending at each reading of the range, in time order, empty if the index is not built.
+    */
+    static void Roll(
+        const PrefixSumIndex &prefixSumIndex,
+        const unsigned &start,
+        const unsigned &end,
+        MeasurementType measurementType,
+        const unsigned &width,
+        RollingSeries &series );
+
+private:
+
+    /**
+    * @brief One reading of the window and its packed timestamp.
+    */
+    struct Entry
+    {
+        unsigned timestamp;
+        float reading;
+    };
+
+    unsigned m_width;                   ///< Width of the window in minutes.
+    std::deque<Entry> m_entries;        ///< Readings in the window, oldest first.
+    std::deque<Entry> m_minimums;       ///< Increasing readings, the front being the minimum of the window.
+    std::deque<Entry> m_maximums;       ///< Decreasing readings, the front being the maximum of the window.
+    float m_shift;                      ///< Reading the sums are kept about.
+    double m_sum;                       ///< Sum of the readings less the shift.
+    double m_sumOfSquares;              ///< Sum of the squares of the readings less the shift.
+
+    /**
+    * @brief Evicts the readings at or before a time from the window.
+    *
+    * @param[in] timestamp The packed timestamp of the last minute to evict.
+    */
+    void EvictUpTo( const unsigned &timestamp );
+};
+
+#endif // ROLLINGWINDOW_H_INCLUDED
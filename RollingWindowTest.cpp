@@ -0,0 +1,151 @@
+#include<iostream>
+#include<cmath>
+#include<limits>
+
+#include "RollingWindow.h"
+#include "MeasurementAccumulator.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestEviction();
+void TestExtremes();
+void TestAgainstRecomputing();
+void TestRoll();
+
+int main()
+{
+    TestEviction();
+    TestExtremes();
+    TestAgainstRecomputing();
+    TestRoll();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestEviction()
+{
+    RollingWindow window( 60 );
+
+    cout << "Test on eviction" << endl;
+    Assert( window.GetCount() == 0 && window.GetMean() == 0 && window.GetMaximum() == 0, "an empty window reads 0" );
+
+    window.Push( 1000, 2 );
+    window.Push( 1030, 4 );
+    window.Push( 1059, 6 );
+    Assert( window.GetCount() == 3 && window.GetMean() == 4 && window.GetSampleStandardDeviation() == 2, "readings within the width are kept" );
+
+    window.Push( 1060, 8 );
+    Assert( window.GetCount() == 3 && window.GetMean() == 6 && window.GetMinimum() == 4, "a reading exactly one width old is evicted" );
+
+    window.Push( 1200, numeric_limits<float>::quiet_NaN() );
+    Assert( window.GetCount() == 0 && window.GetMinimum() == 0, "a missing reading still moves the window" );
+
+    window.Push( 1210, 100 );
+    window.Push( 1220, 100 );
+    Assert( window.GetMean() == 100 && window.GetSampleStandardDeviation() == 0, "a window refilled after emptying starts again" );
+
+    window.Clear();
+    Assert( window.GetCount() == 0 && window.GetWidth() == 60, "clearing keeps the width" );
+    cout << endl;
+}
+
+void TestExtremes()
+{
+    RollingWindow window( 30 );
+
+    cout << "Test on minimum and maximum" << endl;
+    window.Push( 0, 5 );
+    window.Push( 10, 9 );
+    window.Push( 20, 1 );
+    Assert( window.GetMinimum() == 1 && window.GetMaximum() == 9, "the extremes of the window are at the fronts" );
+
+    window.Push( 40, 3 );
+    Assert( window.GetMinimum() == 1 && window.GetMaximum() == 3, "the maximum moves on when its reading is evicted" );
+
+    window.Push( 50, 3 );
+    window.Push( 60, 2 );
+    Assert( window.GetMinimum() == 2 && window.GetMaximum() == 3, "equal readings keep the extreme until both are evicted" );
+    cout << endl;
+}
+
+void TestAgainstRecomputing()
+{
+    const unsigned width = 1440;
+    const unsigned readings = 3000;
+    Vector<unsigned> timestamps;
+    Vector<float> values;
+    RollingWindow window( width );
+    unsigned timestamp = 23000000;
+    unsigned seed = 12345;
+    bool isSame = true;
+
+    cout << "Test against recomputing every window" << endl;
+    for( unsigned reading(0); reading < readings; reading++ )
+    {
+        // Mostly 10 minute steps, with repeated minutes and gaps longer than the window
+        seed = seed * 1103515245 + 12345;
+        unsigned step = ( seed >> 16 ) % 100;
+        timestamp += step < 5 ? 0 : step < 97 ? 10 : 2000;
+        timestamps.InsertLast( timestamp );
+        values.InsertLast( 1000.0f + float( ( seed >> 8 ) % 2000 ) / 100.0f );
+
+        window.Push( timestamp, values[reading] );
+
+        MeasurementAccumulator recomputed;
+        for( unsigned earlier( reading + 1 ); earlier > 0 && timestamps[earlier - 1] + width > timestamp; earlier-- )
+        {
+            recomputed.Add( values[earlier - 1] );
+        }
+        isSame = isSame && window.GetCount() == recomputed.GetCount()
+                 && window.GetMinimum() == recomputed.GetMinimum() && window.GetMaximum() == recomputed.GetMaximum()
+                 && fabs( window.GetMean() - recomputed.GetMean() ) < 1e-3
+                 && fabs( window.GetSampleStandardDeviation() - recomputed.GetSampleStandardDeviation() ) < 1e-3;
+    }
+    Assert( isSame, "every window matches its recomputed statistics" );
+    cout << endl;
+}
+
+void TestRoll()
+{
+    PrefixSumIndex prefixSumIndex;
+    RollingSeries series;
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 23, 0 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 10 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 2, 3, 2016 ), Time( 0, 0 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 20 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 2, 3, 2016 ), Time( 0, 30 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 30 ) ) );
+    prefixSumIndex.Append( WindRecType( Date( 2, 3, 2016 ), Time( 1, 0 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 40 ) ) );
+
+    cout << "Test on rolling a series" << endl;
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( 2, 3, 2016 ), Timestamp::Pack( 3, 3, 2016 ), MeasurementType::TEMPERATURE, 60, series );
+    Assert( series.GetUsed() == 3 && series.GetTimestamps()[0] == Timestamp::Pack( 2, 3, 2016 ), "one window per reading of the range" );
+    Assert( series.GetCounts()[0] == 1 && series.GetMeans()[0] == 20, "a reading one width before the range is not in the first window" );
+    Assert( series.GetCounts()[2] == 2 && series.GetMeans()[2] == 35 && series.GetMinimums()[2] == 30 && series.GetMaximums()[2] == 40,
+            "each window holds the readings of the width before it" );
+
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( 2, 3, 2016, 0, 30 ), Timestamp::Pack( 3, 3, 2016 ), MeasurementType::TEMPERATURE, 1440, series );
+    Assert( series.GetUsed() == 2 && series.GetCounts()[0] == 3 && series.GetMeans()[0] == 20, "readings before the range fill the first window" );
+
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( 3, 3, 2016 ), Timestamp::Pack( 2, 3, 2016 ), MeasurementType::TEMPERATURE, 60, series );
+    Assert( series.GetUsed() == 0, "an empty range has no windows" );
+
+    prefixSumIndex.Append( WindRecType( Date( 1, 3, 2016 ), Time( 22, 0 ), WindSpeed( 1 ), SolarRadiation( 0 ), Temperature( 50 ) ) );
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( 1, 3, 2016 ), Timestamp::Pack( 3, 3, 2016 ), MeasurementType::TEMPERATURE, 60, series );
+    Assert( series.GetUsed() == 0, "an index left unbuilt by an out of order append has no windows" );
+    prefixSumIndex.Build();
+    RollingWindow::Roll( prefixSumIndex, Timestamp::Pack( 1, 3, 2016 ), Timestamp::Pack( 3, 3, 2016 ), MeasurementType::TEMPERATURE, 60, series );
+    Assert( series.GetUsed() == 5 && series.GetMeans()[0] == 50, "the rebuilt index rolls over the appended reading" );
+    cout << endl;
+}
@@ -0,0 +1,436 @@
+
+#include "SensorRegistry.h"
+
+#include<charconv>
+#include<cmath>
+#include<limits>
+
+#include "ColumnKernels.h"
+#include "Timestamp.h"
+
+const unsigned SensorRegistry::NOT_FOUND;
+const unsigned SensorRegistry::TIMESTAMP_FIELD;
+const string SensorRegistry::TIMESTAMP_CODE = "WAST";
+const string SensorRegistry::WINDSPEED_CODE = "S";
+const string SensorRegistry::SOLARRADIATION_CODE = "SR";
+const string SensorRegistry::TEMPERATURE_CODE = "T";
+const string SensorRegistry::WINDDIRECTION_CODE = "Dta";
+
+namespace
+{
+/**
+* @brief A sensor of the sensor code list.
+*/
+struct KnownSensor
+{
+    const char *code;   ///< Header name of the sensor.
+    const char *name;   ///< Name of the sensor.
+    const char *unit;   ///< Unit of its readings.
+};
+
+/// Sensors of data/SensorCodes.rtf, other than the WAST date and time.
+const KnownSensor KNOWN_SENSORS[] =
+{
+    { "DP", "Dew Point Temperature", "C" },
+    { "Dta", "Wind Direction (10min Avg)", "degrees" },
+    { "Dts", "Wind Direction (10min SD)", "degrees" },
+    { "EV", "Evaporation (Year to Date)", "mm" },
+    { "QFE", "Barometric Pressure (QFE)", "hPa" },
+    { "QFF", "Barometric Pressure (QFF)", "hPa" },
+    { "QNH", "Barometric Pressure (Aviation Standard)", "hPa" },
+    { "RF", "Rainfall (Year to Date)", "mm" },
+    { "RH", "Relative Humidity", "%" },
+    { "S", "Wind Speed", "m/s" },
+    { "SR", "Solar Radiation (Average)", "W/m2" },
+    { "ST1", "Soil Temperature (125mm depth)", "C" },
+    { "ST2", "Soil Temperature (250mm depth)", "C" },
+    { "ST3", "Soil Temperature (500mm depth)", "C" },
+    { "ST4", "Soil Temperature (1000mm depth)", "C" },
+    { "Sx", "Wind Speed (max wind gust)", "m/s" },
+    { "T", "Temperature (Air)", "C" }
+};
+}
+
+SensorRegistry::SensorRegistry()
+{
+    for( const KnownSensor &knownSensor : KNOWN_SENSORS )
+    {
+        Register( knownSensor.code, knownSensor.name, knownSensor.unit );
+    }
+    m_windSpeed = Find( WINDSPEED_CODE );
+    m_solarRadiation = Find( SOLARRADIATION_CODE );
+    m_temperature = Find( TEMPERATURE_CODE );
+}
+
+unsigned SensorRegistry::Register( const string &code, const string &name, const string &unit, ColumnType columnType )
+{
+    unsigned found = Find( code );
+    if( found != NOT_FOUND )
+    {
+        return found;
+    }
+
+    // A sensor registered after rows were loaded has no readings for them
+    Sensor sensor;
+    sensor.code = code;
+    sensor.name = name;
+    sensor.unit = unit;
+    sensor.type = columnType;
+    sensor.values.SetSize( GetRowCount() );
+    for( unsigned row(0); row < GetRowCount(); row++ )
+    {
+        sensor.values[row] = numeric_limits<float>::quiet_NaN();
+    }
+    sensor.missing = GetRowCount();
+    m_sensors.InsertLast( sensor );
+    m_row.InsertLast( 0.0f );
+    return m_sensors.GetUsed() - 1;
+}
+
+bool SensorRegistry::ReadHeader( string_view headerLine )
+{
+    bool hasTimestamp = false;
+    size_t fieldStart = 0;
+
+    m_fieldSensors.SetSize( 0 );
+    while( fieldStart <= headerLine.size() )
+    {
+        size_t fieldEnd = min( headerLine.find( ',', fieldStart ), headerLine.size() );
+        string code( Trim( headerLine.substr( fieldStart, fieldEnd - fieldStart ) ) );
+
+        if( code == TIMESTAMP_CODE )
+        {
+            m_fieldSensors.InsertLast( TIMESTAMP_FIELD );
+            hasTimestamp = true;
+        }
+        else if( code.empty() )
+        {
+            m_fieldSensors.InsertLast( NOT_FOUND );
+        }
+        else
+        {
+            m_fieldSensors.InsertLast( Register( code ) );
+        }
+        fieldStart = fieldEnd + 1;
+    }
+
+    if( !hasTimestamp )
+    {
+        m_fieldSensors.SetSize( 0 );
+    }
+    return hasTimestamp;
+}
+
+bool SensorRegistry::AppendLine( string_view line )
+{
+    const float missing = numeric_limits<float>::quiet_NaN();
+    bool hasTimestamp = false;
+    Date date;
+    Time time;
+    size_t fieldStart = 0;
+
+    for( unsigned sensor(0); sensor < m_row.GetUsed(); sensor++ )
+    {
+        m_row[sensor] = missing;
+    }
+
+    // Each field is parsed once, straight into the reading of the sensor its header named
+    for( unsigned field(0); field < m_fieldSensors.GetUsed() && fieldStart <= line.size(); field++ )
+    {
+        size_t fieldEnd = min( line.find( ',', fieldStart ), line.size() );
+        string_view text = Trim( line.substr( fieldStart, fieldEnd - fieldStart ) );
+        unsigned sensor = m_fieldSensors[field];
+
+        if( sensor == TIMESTAMP_FIELD )
+        {
+            hasTimestamp = ParseTimestamp( text, date, time );
+        }
+        else if( sensor != NOT_FOUND && !text.empty() )
+        {
+            float value = 0;
+            from_chars_result result = std::from_chars( text.data(), text.data() + text.size(), value );
+            if( result.ec == std::errc() && result.ptr == text.data() + text.size() )
+            {
+                m_row[sensor] = value;
+            }
+        }
+        fieldStart = fieldEnd + 1;
+    }
+
+    if( !hasTimestamp )
+    {
+        return false;
+    }
+
+    for( unsigned sensor(0); sensor < m_sensors.GetUsed(); sensor++ )
+    {
+        m_sensors[sensor].values.InsertLast( m_row[sensor] );
+        if( std::isnan( m_row[sensor] ) )
+        {
+            m_sensors[sensor].missing++;
+        }
+    }
+    m_timestamps.InsertLast( Timestamp::Pack( date, time ) );
+    m_yearMonthKeys.InsertLast( Timestamp::MakeYearMonthKey( date.GetMonth(), date.GetYear() ) );
+    return true;
+}
+
+void SensorRegistry::RemoveLastRow()
+{
+    if( m_timestamps.IsEmpty() )
+    {
+        return;
+    }
+
+    for( unsigned sensor(0); sensor < m_sensors.GetUsed(); sensor++ )
+    {
+        Vector<float> &values = m_sensors[sensor].values;
+        if( std::isnan( values[values.GetUsed() - 1] ) )
+        {
+            m_sensors[sensor].missing--;
+        }
+        values.RemoveLast();
+    }
+    m_timestamps.RemoveLast();
+    m_yearMonthKeys.RemoveLast();
+}
+
+void SensorRegistry::Clear()
+{
+    for( unsigned sensor(0); sensor < m_sensors.GetUsed(); sensor++ )
+    {
+        m_sensors[sensor].values.SetSize( 0 );
+        m_sensors[sensor].missing = 0;
+    }
+    m_timestamps.SetSize( 0 );
+    m_yearMonthKeys.SetSize( 0 );
+}
+
+unsigned SensorRegistry::GetSensorCount() const
+{
+    return m_sensors.GetUsed();
+}
+
+unsigned SensorRegistry::GetRowCount() const
+{
+    return m_timestamps.GetUsed();
+}
+
+unsigned SensorRegistry::Find( const string &code ) const
+{
+    for( unsigned sensor(0); sensor < m_sensors.GetUsed(); sensor++ )
+    {
+        if( m_sensors[sensor].code == code )
+        {
+            return sensor;
+        }
+    }
+    return NOT_FOUND;
+}
+
+const string &SensorRegistry::GetCode( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].code;
+}
+
+const string &SensorRegistry::GetName( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].name;
+}
+
+const string &SensorRegistry::GetUnit( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].unit;
+}
+
+ColumnType SensorRegistry::GetColumnType( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].type;
+}
+
+const float *SensorRegistry::GetColumn( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].values.Start();
+}
+
+unsigned SensorRegistry::GetMissingCount( const unsigned &sensor ) const
+{
+    return m_sensors[sensor].missing;
+}
+
+const unsigned *SensorRegistry::GetTimestamps() const
+{
+    return m_timestamps.Start();
+}
+
+const unsigned *SensorRegistry::GetYearMonthKeys() const
+{
+    return m_yearMonthKeys.Start();
+}
+
+MeasurementAccumulator SensorRegistry::GetSummary( const unsigned &sensor ) const
+{
+    const float *values = GetColumn( sensor );
+    unsigned rows = GetRowCount();
+
+    // A column without missing readings is reduced without a mask
+    if( m_sensors[sensor].missing == 0 )
+    {
+        if( rows == 0 )
+        {
+            return MeasurementAccumulator();
+        }
+        double sum = ColumnKernels::Sum( values, rows );
+        float mean = sum / rows;
+        return MeasurementAccumulator(
+                   rows,
+                   sum,
+                   ColumnKernels::SumOfSquares( values, rows, mean ),
+                   ColumnKernels::Minimum( values, rows ),
+                   ColumnKernels::Maximum( values, rows ) );
+    }
+
+    Vector<unsigned char> mask;
+    mask.SetSize( rows );
+    for( unsigned row(0); row < rows; row++ )
+    {
+        mask[row] = !std::isnan( values[row] );
+    }
+    return Summarise( sensor, mask.Start() );
+}
+
+MeasurementAccumulator SensorRegistry::GetMonthlySummary( const unsigned &sensor, const unsigned &month, const unsigned &year ) const
+{
+    Vector<unsigned char> mask;
+
+    BuildMonthMask( sensor, month, year, mask );
+    return Summarise( sensor, mask.Start() );
+}
+
+DirectionAccumulator SensorRegistry::GetMonthlyDirection( const unsigned &sensor, const unsigned &month, const unsigned &year ) const
+{
+    Vector<unsigned char> mask;
+    double sumOfSines = 0.0;
+    double sumOfCosines = 0.0;
+
+    BuildMonthMask( sensor, month, year, mask );
+    ColumnKernels::MaskedSumOfSinesAndCosines( GetColumn( sensor ), mask.Start(), GetRowCount(), sumOfSines, sumOfCosines );
+    return DirectionAccumulator( ColumnKernels::CountSelected( mask.Start(), GetRowCount() ), sumOfSines, sumOfCosines );
+}
+
+bool SensorRegistry::GetRecord( const unsigned &row, WindRecType &windRecType ) const
+{
+    float windSpeed = m_sensors[m_windSpeed].values[row];
+    float solarRadiation = m_sensors[m_solarRadiation].values[row];
+    float temperature = m_sensors[m_temperature].values[row];
+    Date date;
+    Time time;
+
+    if( std::isnan( windSpeed ) || std::isnan( solarRadiation ) || std::isnan( temperature ) )
+    {
+        return false;
+    }
+
+    Timestamp::Unpack( m_timestamps[row], date, time );
+    windRecType = WindRecType( date, time, WindSpeed( windSpeed ), SolarRadiation( solarRadiation ), Temperature( temperature ) );
+    return true;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+MeasurementAccumulator SensorRegistry::Summarise( const unsigned &sensor, const unsigned char mask[] ) const
+{
+    const float *values = GetColumn( sensor );
+    unsigned rows = GetRowCount();
+    unsigned count = ColumnKernels::CountSelected( mask, rows );
+
+    if( count == 0 )
+    {
+        return MeasurementAccumulator();
+    }
+
+    double sum = ColumnKernels::MaskedSum( values, mask, rows );
+    float mean = sum / count;
+    return MeasurementAccumulator(
+               count,
+               sum,
+               ColumnKernels::MaskedSumOfSquares( values, mask, rows, mean ),
+               ColumnKernels::MaskedMinimum( values, mask, rows ),
+               ColumnKernels::MaskedMaximum( values, mask, rows ) );
+}
+
+void SensorRegistry::BuildMonthMask( const unsigned &sensor, const unsigned &month, const unsigned &year, Vector<unsigned char> &mask ) const
+{
+    const float *values = GetColumn( sensor );
+    unsigned rows = GetRowCount();
+
+    mask.SetSize( rows );
+    ColumnKernels::BuildKeyMask( m_yearMonthKeys.Start(), rows, Timestamp::MakeYearMonthKey( month, year ), mask.Start() );
+    if( m_sensors[sensor].missing > 0 )
+    {
+        for( unsigned row(0); row < rows; row++ )
+        {
+            mask[row] = mask[row] && !std::isnan( values[row] );
+        }
+    }
+}
+
+bool SensorRegistry::ParseTimestamp( string_view field, Date &date, Time &time )
+{
+    const char *next = field.data();
+    const char *last = field.data() + field.size();
+    const char separators[] = { '/', '/', ' ', ':' };
+    unsigned parts[5] = { 0, 0, 0, 0, 0 };
+
+    for( unsigned part(0); part < 5; part++ )
+    {
+        from_chars_result result = std::from_chars( next, last, parts[part] );
+        if( result.ec != std::errc() )
+        {
+            return false;
+        }
+        next = result.ptr;
+        if( part < 4 )
+        {
+            if( next == last || *next != separators[part] )
+            {
+                return false;
+            }
+            next++;
+            while( part == 2 && next != last && *next == ' ' )
+            {
+                next++;
+            }
+        }
+    }
+
+    unsigned day = parts[0];
+    unsigned month = parts[1];
+    unsigned year = parts[2];
+    if( next != last || day < 1 || day > 31 || month < 1 || month > 12 || year < 1970 || parts[3] > 23 || parts[4] > 59 )
+    {
+        return false;
+    }
+    date = Date( day, month, year );
+    time = Time( parts[3], parts[4] );
+    return true;
+}
+
+string_view SensorRegistry::Trim( string_view field )
+{
+    const string_view byteOrderMark = "\xEF\xBB\xBF";
+
+    if( field.substr( 0, byteOrderMark.size() ) == byteOrderMark )
+    {
+        field.remove_prefix( byteOrderMark.size() );
+    }
+    while( !field.empty() && ( field.front() == ' ' || field.front() == '\t' ) )
+    {
+        field.remove_prefix( 1 );
+    }
+    while( !field.empty() && ( field.back() == ' ' || field.back() == '\t' || field.back() == '\r' ) )
+    {
+        field.remove_suffix( 1 );
+    }
+    return field;
+}
@@ -0,0 +1,275 @@
+/**
+ * @file SensorRegistry.h
+ * @brief Defines the SensorRegistry class, which loads every sensor column of the CSV files by its header name.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef SENSORREGISTRY_H_INCLUDED
+#define SENSORREGISTRY_H_INCLUDED
+
+#include<string>
+#include<string_view>
+
+#include "Vector.h"
+#include "WindRecType.h"
+#include "ColumnType.h"
+#include "MeasurementAccumulator.h"
+#include "DirectionAccumulator.h"
+
+using namespace std;
+
+/**
+* @brief Maps the sensor codes of the CSV header line to contiguous columns and parses every row into them.
+*
+* The registry starts with every sensor of data/SensorCodes.rtf registered, each with its own
+* float column, and registers any other code found in a header at runtime, so a new sensor needs
+* no new class. ReadHeader() maps the fields of a file to the sensors by name, since the files
+* order their columns differently, and AppendLine() then parses each field of a line once, with
+* std::from_chars, straight into its column. A sensor missing from a file, or a field that is empty
+* or not a number, is stored as NaN and left out of the statistics.
+*
+* The WAST field becomes the packed timestamp and month and year key of the row, and the columns
+* are reduced with the vectorised ColumnKernels, so any sensor is summarised through the same
+* paths as wind speed, solar radiation and temperature.
+*/
+class SensorRegistry
+{
+public:
+    static const unsigned NOT_FOUND = ~0u;      ///< Index returned for a code that is not registered.
+    static const string TIMESTAMP_CODE;         ///< Header name of the date and time field.
+    static const string WINDSPEED_CODE;         ///< Code of the wind speed sensor.
+    static const string SOLARRADIATION_CODE;    ///< Code of the solar radiation sensor.
+    static const string TEMPERATURE_CODE;       ///< Code of the ambient air temperature sensor.
+    static const string WINDDIRECTION_CODE;     ///< Code of the 10 minute average wind direction sensor.
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Every sensor of the sensor code list is registered, without rows.
+    */
+    SensorRegistry();
+
+    /**
+    * @brief Registers a sensor with an empty column, unless its code is already registered.
+    *
+    * @param[in] code The header name of the sensor.
+    * @param[in] name The name of the sensor.
+    * @param[in] unit The unit of its readings.
+    * @param[in] columnType The type its column is exported as.
+    * @return The index of the sensor.
+    */
+    unsigned Register( const string &code, const string &name = "", const string &unit = "", ColumnType columnType = ColumnType::FLOAT32 );
+
+    /**
+    * @brief Maps the fields of the lines that follow a header line to the sensors, registering unknown codes.
+    *
+    * Rows appended before the header keep their values, and sensors registered now are NaN for them.
+    *
+    * @param[in] headerLine The first line of a CSV file.
+    * @return false if the header has no WAST field, true otherwise.
+    */
+    bool ReadHeader( string_view headerLine );
+
+    /**
+    * @brief Parses a line of the current file into a new row of every column.
+    *
+    * @param[in] line The line, without its line break.
+    * @return false, appending nothing, if no header was read or its date and time are invalid, true otherwise.
+    */
+    bool AppendLine( string_view line );
+
+    /**
+    * @brief Removes the last row from every column.
+    */
+    void RemoveLastRow();
+
+    /**
+    * @brief Removes every row, keeping the sensors and the header mapping.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of sensors.
+    *
+    * @return The number of sensors.
+    */
+    unsigned GetSensorCount() const;
+
+    /**
+    * @brief Getter for the number of rows of every column.
+    *
+    * @return The number of rows.
+    */
+    unsigned GetRowCount() const;
+
+    /**
+    * @brief Finds a sensor by its code.
+    *
+    * @param[in] code The header name of the sensor.
+    * @return The index of the sensor, or NOT_FOUND.
+    */
+    unsigned Find( const string &code ) const;
+
+    /**
+    * @brief Getter for the code of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The header name of the sensor.
+    */
+    const string &GetCode( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the name of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The name, empty for a sensor only known from a header.
+    */
+    const string &GetName( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the unit of the readings of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The unit, empty for a sensor only known from a header.
+    */
+    const string &GetUnit( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the type the column of a sensor is exported as.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The column type.
+    */
+    ColumnType GetColumnType( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the contiguous column of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return Pointer to the reading of the first row, NaN where it is missing.
+    */
+    const float *GetColumn( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the number of missing readings of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The number of NaN rows of its column.
+    */
+    unsigned GetMissingCount( const unsigned &sensor ) const;
+
+    /**
+    * @brief Getter for the column of packed timestamps.
+    *
+    * @return Pointer to the timestamp of the first row.
+    */
+    const unsigned *GetTimestamps() const;
+
+    /**
+    * @brief Getter for the column of month and year keys.
+    *
+    * @return Pointer to the key of the first row, see Timestamp::MakeYearMonthKey().
+    */
+    const unsigned *GetYearMonthKeys() const;
+
+    /**
+    * @brief Summarises every reading of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @return The count, mean, deviation, minimum and maximum of the readings that are not missing.
+    */
+    MeasurementAccumulator GetSummary( const unsigned &sensor ) const;
+
+    /**
+    * @brief Summarises the readings of a sensor in one month.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @return The count, mean, deviation, minimum and maximum of the readings of the month that are not missing.
+    */
+    MeasurementAccumulator GetMonthlySummary( const unsigned &sensor, const unsigned &month, const unsigned &year ) const;
+
+    /**
+    * @brief Accumulates the readings of a direction sensor in one month as unit vectors.
+    *
+    * @param[in] sensor The index of a sensor read in degrees, such as WINDDIRECTION_CODE.
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @return The count and the sums of the sines and cosines of the readings of the month that are not missing.
+    */
+    DirectionAccumulator GetMonthlyDirection( const unsigned &sensor, const unsigned &month, const unsigned &year ) const;
+
+    /**
+    * @brief Builds the wind record of a row from its date, time, wind speed, solar radiation and temperature.
+    *
+    * @param[in] row The index of the row.
+    * @param[out] windRecType The wind record.
+    * @return false if any of the three readings is missing, true otherwise.
+    */
+    bool GetRecord( const unsigned &row, WindRecType &windRecType ) const;
+
+private:
+    static const unsigned TIMESTAMP_FIELD = NOT_FOUND - 1;  ///< Field mapping of the WAST field.
+
+    /**
+    * @brief A registered sensor and its column.
+    */
+    struct Sensor
+    {
+        string code;            ///< Header name of the sensor.
+        string name;            ///< Name of the sensor.
+        string unit;            ///< Unit of its readings.
+        ColumnType type;        ///< Type its column is exported as.
+        Vector<float> values;   ///< Reading of each row, NaN where missing.
+        unsigned missing;       ///< Number of NaN rows.
+    };
+
+    Vector<Sensor> m_sensors;           ///< Registered sensors, in the order they were registered.
+    Vector<unsigned> m_fieldSensors;    ///< Sensor of each field of the current file, NOT_FOUND or TIMESTAMP_FIELD.
+    Vector<float> m_row;                ///< Reused readings of the line being parsed, one per sensor.
+    Vector<unsigned> m_timestamps;      ///< Packed timestamp of each row.
+    Vector<unsigned> m_yearMonthKeys;   ///< Month and year key of each row.
+    unsigned m_windSpeed;               ///< Index of the wind speed sensor.
+    unsigned m_solarRadiation;          ///< Index of the solar radiation sensor.
+    unsigned m_temperature;             ///< Index of the temperature sensor.
+
+    /**
+    * @brief Summarises the selected readings of a sensor.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @param[in] mask One byte per row, non-zero when the row is selected and its reading is not missing.
+    * @return The summary of the selected readings.
+    */
+    MeasurementAccumulator Summarise( const unsigned &sensor, const unsigned char mask[] ) const;
+
+    /**
+    * @brief Builds the mask of the readings of a sensor in one month that are not missing.
+    *
+    * @param[in] sensor The index of the sensor.
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @param[out] mask One byte per row, replacing its contents.
+    */
+    void BuildMonthMask( const unsigned &sensor, const unsigned &month, const unsigned &year, Vector<unsigned char> &mask ) const;
+
+    /**
+    * @brief Parses a WAST field such as 31/03/2016 9:00.
+    *
+    * @param[in] field The field.
+    * @param[out] date The date of the field.
+    * @param[out] time The time of the field.
+    * @return false if the field is not a valid date and time, true otherwise.
+    */
+    static bool ParseTimestamp( string_view field, Date &date, Time &time );
+
+    /**
+    * @brief Removes blanks, carriage returns and a UTF-8 byte order mark around a field.
+    *
+    * @param[in] field The field.
+    * @return The trimmed field.
+    */
+    static string_view Trim( string_view field );
+};
+
+#endif // SENSORREGISTRY_H_INCLUDED
@@ -0,0 +1,157 @@
+#include<iostream>
+#include<cmath>
+
+#include "SensorRegistry.h"
+#include "Timestamp.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestHeaderMapping();
+void TestMissingValues();
+void TestUnknownSensors();
+void TestSummaries();
+void TestDirection();
+
+int main()
+{
+    TestHeaderMapping();
+    TestMissingValues();
+    TestUnknownSensors();
+    TestSummaries();
+    TestDirection();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestHeaderMapping()
+{
+    SensorRegistry sensorRegistry;
+    WindRecType windRecType;
+    unsigned knownSensors = sensorRegistry.GetSensorCount();
+
+    Assert( knownSensors == 17 && sensorRegistry.GetRowCount() == 0, "every sensor of the code list is registered" );
+    Assert( sensorRegistry.GetName( sensorRegistry.Find( "RH" ) ) == "Relative Humidity"
+            && sensorRegistry.GetUnit( sensorRegistry.Find( "RH" ) ) == "%", "known sensors have a name and a unit" );
+    Assert( !sensorRegistry.AppendLine( "31/03/2016 9:00,14.6" ), "lines are rejected before a header" );
+    Assert( !sensorRegistry.ReadHeader( "DP,S,SR,T" ), "a header without WAST is rejected" );
+
+    // The two orders of the data files
+    Assert( sensorRegistry.ReadHeader( "WAST,DP,Dta,Dts,EV,QFE,QFF,QNH,RF,RH,S,SR,ST1,ST2,ST3,ST4,Sx,T\r" )
+            && sensorRegistry.AppendLine( "31/03/2016 9:00,14.6,175,17,0,1013.4,1016.9,1017,0,68.2,6,512,22.7,24.1,25.5,26.1,8,20.74\r" ),
+            "a line is parsed by the names of its header" );
+    Assert( sensorRegistry.ReadHeader( "\xEF\xBB\xBFWAST,Sx,DP,Dta,Dts,EV,QNH,QFE,QFF,RF,RH,S,SR,T,ST1,ST2,ST3,ST4" )
+            && sensorRegistry.AppendLine( "1/3/2015 9:10,12,10.8,111,20,0.1,1011.3,1007.7,1011.1,0,47.2,5,594,6,28.1,28.8,29.3,28.5" ),
+            "a header with a byte order mark and another order is mapped" );
+    Assert( sensorRegistry.GetSensorCount() == knownSensors && sensorRegistry.GetRowCount() == 2, "both lines are appended to the same columns" );
+
+    const float *relativeHumidity = sensorRegistry.GetColumn( sensorRegistry.Find( "RH" ) );
+    const float *gust = sensorRegistry.GetColumn( sensorRegistry.Find( "Sx" ) );
+    Assert( relativeHumidity[0] == 68.2f && relativeHumidity[1] == 47.2f && gust[0] == 8.0f && gust[1] == 12.0f,
+            "each field is read into the column of its sensor" );
+    Assert( sensorRegistry.GetTimestamps()[0] == Timestamp::Pack( 31, 3, 2016, 9, 0 )
+            && sensorRegistry.GetTimestamps()[1] == Timestamp::Pack( 1, 3, 2015, 9, 10 ), "WAST is packed into the timestamps" );
+
+    Assert( sensorRegistry.GetRecord( 0, windRecType )
+            && windRecType.GetRecordWindSpeed().GetMeasurement() == 6.0f
+            && windRecType.GetRecordSolarRadiation().GetMeasurement() == 512.0f
+            && windRecType.GetRecordTemperature().GetMeasurement() == 20.74f
+            && windRecType.GetRecordDate().GetDay() == 31 && windRecType.GetRecordTime().GetMinute() == 0,
+            "a wind record is built from the named columns" );
+}
+
+void TestMissingValues()
+{
+    SensorRegistry sensorRegistry;
+    WindRecType windRecType;
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T,RH" );
+    Assert( !sensorRegistry.AppendLine( "31/13/2016 9:00,6,512,20,50" ) && !sensorRegistry.AppendLine( "9:00,6,512,20,50" )
+            && sensorRegistry.GetRowCount() == 0, "lines with an invalid date or time are rejected" );
+    Assert( sensorRegistry.AppendLine( "1/3/2016 9:00,6,,20,n/a" ) && sensorRegistry.AppendLine( "1/3/2016 9:10,7,500,21" ),
+            "lines with empty, invalid or absent fields are appended" );
+
+    unsigned relativeHumidity = sensorRegistry.Find( "RH" );
+    unsigned solarRadiation = sensorRegistry.Find( "SR" );
+    Assert( std::isnan( sensorRegistry.GetColumn( solarRadiation )[0] ) && std::isnan( sensorRegistry.GetColumn( relativeHumidity )[1] )
+            && std::isnan( sensorRegistry.GetColumn( sensorRegistry.Find( "DP" ) )[0] ), "missing readings are NaN" );
+    Assert( sensorRegistry.GetMissingCount( relativeHumidity ) == 2 && sensorRegistry.GetMissingCount( solarRadiation ) == 1,
+            "missing readings are counted" );
+    Assert( !sensorRegistry.GetRecord( 0, windRecType ) && sensorRegistry.GetRecord( 1, windRecType ),
+            "a row without solar radiation has no wind record" );
+
+    sensorRegistry.RemoveLastRow();
+    Assert( sensorRegistry.GetRowCount() == 1 && sensorRegistry.GetMissingCount( relativeHumidity ) == 1,
+            "removing the last row keeps the missing counts" );
+    sensorRegistry.Clear();
+    Assert( sensorRegistry.GetRowCount() == 0 && sensorRegistry.AppendLine( "1/3/2016 9:20,8,400,22,40" ),
+            "a cleared registry keeps its header" );
+}
+
+void TestUnknownSensors()
+{
+    SensorRegistry sensorRegistry;
+    unsigned knownSensors = sensorRegistry.GetSensorCount();
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,6,512,20" );
+    Assert( sensorRegistry.ReadHeader( "WAST,S,SR,T,UV" ) && sensorRegistry.GetSensorCount() == knownSensors + 1,
+            "an unknown code is registered" );
+
+    unsigned ultraviolet = sensorRegistry.Find( "UV" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,6,512,20,3.5" );
+    Assert( ultraviolet != SensorRegistry::NOT_FOUND && sensorRegistry.GetName( ultraviolet ).empty()
+            && std::isnan( sensorRegistry.GetColumn( ultraviolet )[0] ) && sensorRegistry.GetColumn( ultraviolet )[1] == 3.5f,
+            "a sensor registered late is NaN for the rows before it" );
+    Assert( sensorRegistry.Register( "UV" ) == ultraviolet && sensorRegistry.Find( "XX" ) == SensorRegistry::NOT_FOUND,
+            "a code is registered once" );
+}
+
+void TestSummaries()
+{
+    SensorRegistry sensorRegistry;
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T,RH" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,6,512,20,40" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,6,512,20," );
+    sensorRegistry.AppendLine( "2/3/2016 9:00,6,512,20,60" );
+    sensorRegistry.AppendLine( "1/4/2016 9:00,6,512,20,90" );
+
+    unsigned relativeHumidity = sensorRegistry.Find( "RH" );
+    MeasurementAccumulator march = sensorRegistry.GetMonthlySummary( relativeHumidity, 3, 2016 );
+    MeasurementAccumulator all = sensorRegistry.GetSummary( relativeHumidity );
+    MeasurementAccumulator temperature = sensorRegistry.GetSummary( sensorRegistry.Find( "T" ) );
+
+    Assert( march.GetCount() == 2 && march.GetMean() == 50.0f && march.GetMinimum() == 40.0f && march.GetMaximum() == 60.0f,
+            "a monthly summary leaves out missing readings and other months" );
+    Assert( all.GetCount() == 3 && all.GetMaximum() == 90.0f, "a summary covers every month" );
+    Assert( temperature.GetCount() == 4 && temperature.GetMean() == 20.0f, "a column without missing readings is summarised" );
+    Assert( sensorRegistry.GetMonthlySummary( relativeHumidity, 5, 2016 ).GetCount() == 0, "a month without readings is empty" );
+}
+
+void TestDirection()
+{
+    SensorRegistry sensorRegistry;
+
+    sensorRegistry.ReadHeader( "WAST,S,SR,T,Dta" );
+    sensorRegistry.AppendLine( "1/3/2016 9:00,6,512,20,350" );
+    sensorRegistry.AppendLine( "1/3/2016 9:10,6,512,20," );
+    sensorRegistry.AppendLine( "1/3/2016 9:20,6,512,20,10" );
+    sensorRegistry.AppendLine( "1/4/2016 9:00,6,512,20,180" );
+
+    DirectionAccumulator march = sensorRegistry.GetMonthlyDirection( sensorRegistry.Find( SensorRegistry::WINDDIRECTION_CODE ), 3, 2016 );
+    float mean = march.GetMeanDirection();
+    Assert( march.GetCount() == 2 && ( mean < 0.01f || mean > 359.99f ), "the wind direction of a month is a circular mean" );
+}
@@ -0,0 +1,127 @@
+
+#include "SummaryCube.h"
+
+const unsigned SummaryCube::MONTHS_IN_YEAR;
+const unsigned SummaryCube::MEASUREMENT_TYPES;
+
+SummaryCube::SummaryCube() {}
+
+void SummaryCube::Add( const WindRecType &windRecType )
+{
+    Date date = windRecType.GetRecordDate();
+    unsigned month = date.GetMonth();
+    unsigned year = date.GetYear();
+
+    if( month < 1 || month > MONTHS_IN_YEAR )
+    {
+        return;
+    }
+
+    unsigned index = LowerBound( year );
+    if( index == m_years.GetUsed() || m_years[index].year != year )
+    {
+        YearSummary yearSummary;
+        yearSummary.year = year;
+        if( index == m_years.GetUsed() )
+        {
+            m_years.InsertLast( yearSummary );
+        }
+        else
+        {
+            m_years.InsertAt( yearSummary, index );
+        }
+    }
+
+    MeasurementAccumulator *cells = m_years[index].cells[month - 1];
+    windRecType.GetRecordWindSpeed().Accumulate( cells[unsigned( MeasurementType::WINDSPEED )] );
+    windRecType.GetRecordTemperature().Accumulate( cells[unsigned( MeasurementType::TEMPERATURE )] );
+    windRecType.GetRecordSolarRadiation().Accumulate( cells[unsigned( MeasurementType::SOLARRADIATION )] );
+
+    QuantileSketch *sketches = m_years[index].sketches[month - 1];
+    sketches[unsigned( MeasurementType::WINDSPEED )].Add( windRecType.GetRecordWindSpeed().GetMeasurement() );
+    sketches[unsigned( MeasurementType::TEMPERATURE )].Add( windRecType.GetRecordTemperature().GetMeasurement() );
+    sketches[unsigned( MeasurementType::SOLARRADIATION )].Add( windRecType.GetRecordSolarRadiation().GetMeasurement() );
+}
+
+void SummaryCube::Clear()
+{
+    while( m_years.RemoveLast() );
+}
+
+bool SummaryCube::HasYear( const unsigned &year ) const
+{
+    unsigned index = LowerBound( year );
+    return ( index < m_years.GetUsed() && m_years[index].year == year );
+}
+
+unsigned SummaryCube::GetYearCount() const
+{
+    return m_years.GetUsed();
+}
+
+unsigned SummaryCube::GetYearAt( const unsigned &index ) const
+{
+    return m_years[index].year;
+}
+
+const MeasurementAccumulator &SummaryCube::GetMonthly( const unsigned &month, const unsigned &year, MeasurementType measurementType ) const
+{
+    if( month < 1 || month > MONTHS_IN_YEAR || !HasYear( year ) )
+    {
+        return m_empty;
+    }
+    return m_years[LowerBound( year )].cells[month - 1][unsigned( measurementType )];
+}
+
+MeasurementAccumulator SummaryCube::GetYearly( const unsigned &year, MeasurementType measurementType ) const
+{
+    MeasurementAccumulator yearly;
+
+    for( unsigned month(1); month <= MONTHS_IN_YEAR; month++ )
+    {
+        yearly.Merge( GetMonthly( month, year, measurementType ) );
+    }
+    return yearly;
+}
+
+const QuantileSketch &SummaryCube::GetMonthlySketch( const unsigned &month, const unsigned &year, MeasurementType measurementType ) const
+{
+    if( month < 1 || month > MONTHS_IN_YEAR || !HasYear( year ) )
+    {
+        return m_emptySketch;
+    }
+    return m_years[LowerBound( year )].sketches[month - 1][unsigned( measurementType )];
+}
+
+QuantileSketch SummaryCube::GetYearlySketch( const unsigned &year, MeasurementType measurementType ) const
+{
+    QuantileSketch yearly;
+
+    for( unsigned month(1); month <= MONTHS_IN_YEAR; month++ )
+    {
+        yearly.Merge( GetMonthlySketch( month, year, measurementType ) );
+    }
+    return yearly;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+unsigned SummaryCube::LowerBound( const unsigned &year ) const
+{
+    unsigned low = 0;
+    unsigned high = m_years.GetUsed();
+
+    while( low < high )
+    {
+        unsigned middle = low + ( high - low ) / 2;
+        if( m_years[middle].year < year )
+        {
+            low = middle + 1;
+        }
+        else
+        {
+            high = middle;
+        }
+    }
+    return low;
+}
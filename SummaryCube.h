@@ -0,0 +1,142 @@
+/**
+ * @file SummaryCube.h
+ * @brief Defines the SummaryCube class, a monthly rollup of every measurement built at load time.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef SUMMARYCUBE_H_INCLUDED
+#define SUMMARYCUBE_H_INCLUDED
+
+#include "WindRecType.h"
+#include "Vector.h"
+#include "MeasurementType.h"
+#include "MeasurementAccumulator.h"
+#include "QuantileSketch.h"
+
+/**
+* @brief Represents a materialised rollup of the wind records per ( year, month, measurement ).
+*
+* Each cell is a MeasurementAccumulator holding the count, sum, sum of squares, minimum and
+* maximum of one measurement for one month. Records are added as they are loaded, so the
+* rollup stays consistent with every append, and yearly totals are derived by merging the
+* twelve monthly cells of the year instead of rescanning the records.
+*
+* Alongside each cell, a QuantileSketch of the same readings answers the median and tail
+* percentiles of the month with bounded error and memory, without keeping or sorting the readings.
+*/
+class SummaryCube
+{
+public:
+
+    static const unsigned MONTHS_IN_YEAR = 12;      ///< Number of monthly cells per year.
+    static const unsigned MEASUREMENT_TYPES = 3;    ///< Number of measurement cells per month.
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty SummaryCube with no years.
+    */
+    SummaryCube();
+
+    /**
+    * @brief Adds a wind record to the cells of its year and month.
+    *
+    * @param[in] windRecType The wind record to add.
+    * @post The wind speed, temperature and solar radiation cells and sketches of the record's month are updated.
+    */
+    void Add( const WindRecType &windRecType );
+
+    /**
+    * @brief Removes every year from the rollup.
+    *
+    * @post The SummaryCube is empty.
+    */
+    void Clear();
+
+    /**
+    * @brief Checks if any record of the year has been added.
+    *
+    * @param[in] year The year to check.
+    * @return true if the year is found, false otherwise.
+    */
+    bool HasYear( const unsigned &year ) const;
+
+    /**
+    * @brief Getter for the number of years in the rollup.
+    *
+    * @return The number of distinct years.
+    */
+    unsigned GetYearCount() const;
+
+    /**
+    * @brief Getter for a year of the rollup by its position, in ascending order.
+    *
+    * @param[in] index The position of the year, between 0 and GetYearCount() - 1.
+    * @return The year at the position.
+    */
+    unsigned GetYearAt( const unsigned &index ) const;
+
+    /**
+    * @brief Getter for the summary of one measurement in one month.
+    *
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @param[in] measurementType Type of measurement.
+    * @return The monthly summary, empty when there is no data.
+    */
+    const MeasurementAccumulator &GetMonthly( const unsigned &month, const unsigned &year, MeasurementType measurementType ) const;
+
+    /**
+    * @brief Derives the summary of one measurement over a whole year.
+    *
+    * @param[in] year The year.
+    * @param[in] measurementType Type of measurement.
+    * @return The twelve monthly summaries merged together, empty when there is no data.
+    */
+    MeasurementAccumulator GetYearly( const unsigned &year, MeasurementType measurementType ) const;
+
+    /**
+    * @brief Getter for the quantile sketch of one measurement in one month.
+    *
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @param[in] measurementType Type of measurement.
+    * @return The monthly sketch, empty when there is no data.
+    */
+    const QuantileSketch &GetMonthlySketch( const unsigned &month, const unsigned &year, MeasurementType measurementType ) const;
+
+    /**
+    * @brief Derives the quantile sketch of one measurement over a whole year.
+    *
+    * @param[in] year The year.
+    * @param[in] measurementType Type of measurement.
+    * @return The twelve monthly sketches merged together, empty when there is no data.
+    */
+    QuantileSketch GetYearlySketch( const unsigned &year, MeasurementType measurementType ) const;
+
+private:
+
+    /**
+    * @brief Represents the monthly cells of a single year.
+    */
+    struct YearSummary
+    {
+        unsigned year;                                                          ///< The year of the cells.
+        MeasurementAccumulator cells[MONTHS_IN_YEAR][MEASUREMENT_TYPES];        ///< Cells indexed by month - 1 and measurement type.
+        QuantileSketch sketches[MONTHS_IN_YEAR][MEASUREMENT_TYPES];             ///< Sketches indexed by month - 1 and measurement type.
+    };
+
+    Vector<YearSummary> m_years;        ///< Years in ascending order.
+    MeasurementAccumulator m_empty;     ///< Empty summary returned when there is no data.
+    QuantileSketch m_emptySketch;       ///< Empty sketch returned when there is no data.
+
+    /**
+    * @brief Binary searches for the position of a year.
+    *
+    * @param[in] year The year to search for.
+    * @return The position of the year, or the position it would be inserted at.
+    */
+    unsigned LowerBound( const unsigned &year ) const;
+};
+
+#endif // SUMMARYCUBE_H_INCLUDED
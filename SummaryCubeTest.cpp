@@ -0,0 +1,122 @@
+
+#include<iostream>
+
+#include "SummaryCube.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+WindRecType MakeRecord( const unsigned &day, const unsigned &month, const unsigned &year, const float &speed, const float &solar, const float &temp );
+void TestEmptyCube( const SummaryCube &summaryCube );
+void TestMonthlyCells( const SummaryCube &summaryCube );
+void TestYearOrdering( const SummaryCube &summaryCube );
+void TestYearlyTotals( const SummaryCube &summaryCube );
+void TestSketches( const SummaryCube &summaryCube );
+void TestIncrementalAppend( SummaryCube &summaryCube );
+
+int main()
+{
+    SummaryCube emptyCube;
+    SummaryCube summaryCube;
+
+    summaryCube.Add( MakeRecord( 1, 3, 2016, 10, 500, 20 ) );
+    summaryCube.Add( MakeRecord( 2, 3, 2016, 20, 600, 24 ) );
+    summaryCube.Add( MakeRecord( 1, 4, 2016, 30, 100, 18 ) );
+    summaryCube.Add( MakeRecord( 1, 3, 2015, 5, 50, 10 ) );
+
+    TestEmptyCube( emptyCube );
+    TestMonthlyCells( summaryCube );
+    TestYearOrdering( summaryCube );
+    TestYearlyTotals( summaryCube );
+    TestSketches( summaryCube );
+    TestIncrementalAppend( summaryCube );
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+WindRecType MakeRecord( const unsigned &day, const unsigned &month, const unsigned &year, const float &speed, const float &solar, const float &temp )
+{
+    return WindRecType( Date( day, month, year ), Time( 9, 0 ), WindSpeed( speed ), SolarRadiation( solar ), Temperature( temp ) );
+}
+
+void TestEmptyCube( const SummaryCube &summaryCube )
+{
+    cout << "Test on an empty SummaryCube" << endl;
+    Assert( summaryCube.GetYearCount() == 0, "Empty cube has no years" );
+    Assert( !summaryCube.HasYear( 2016 ), "Empty cube does not have 2016" );
+    Assert( summaryCube.GetMonthly( 3, 2016, MeasurementType::WINDSPEED ).GetCount() == 0, "Missing month has a count of 0" );
+    cout << endl;
+}
+
+void TestMonthlyCells( const SummaryCube &summaryCube )
+{
+    const MeasurementAccumulator &speed = summaryCube.GetMonthly( 3, 2016, MeasurementType::WINDSPEED );
+    const MeasurementAccumulator &solar = summaryCube.GetMonthly( 3, 2016, MeasurementType::SOLARRADIATION );
+    const MeasurementAccumulator &temp = summaryCube.GetMonthly( 3, 2016, MeasurementType::TEMPERATURE );
+
+    cout << "Test on monthly cells of the SummaryCube" << endl;
+    Assert( speed.GetCount() == 2, "March 2016 has 2 wind speed readings" );
+    Assert( speed.GetMean() == 15, "March 2016 wind speed mean is 15" );
+    Assert( speed.GetMinimum() == 10 && speed.GetMaximum() == 20, "March 2016 wind speed min 10, max 20" );
+    Assert( speed.GetSumOfSquares() == 500, "March 2016 wind speed sum of squares is 500" );
+    Assert( solar.GetSum() == 1100, "March 2016 solar radiation sum is 1100" );
+    Assert( temp.GetMean() == 22, "March 2016 temperature mean is 22" );
+    Assert( summaryCube.GetMonthly( 5, 2016, MeasurementType::WINDSPEED ).GetCount() == 0, "May 2016 has no readings" );
+    cout << endl;
+}
+
+void TestYearOrdering( const SummaryCube &summaryCube )
+{
+    cout << "Test on year ordering of the SummaryCube" << endl;
+    Assert( summaryCube.GetYearCount() == 2, "Cube has 2 years" );
+    Assert( summaryCube.GetYearAt( 0 ) == 2015 && summaryCube.GetYearAt( 1 ) == 2016, "Years are kept in ascending order" );
+    Assert( summaryCube.GetMonthly( 3, 2015, MeasurementType::WINDSPEED ).GetMean() == 5, "Earlier year inserted before keeps its cells" );
+    cout << endl;
+}
+
+void TestYearlyTotals( const SummaryCube &summaryCube )
+{
+    MeasurementAccumulator yearly = summaryCube.GetYearly( 2016, MeasurementType::WINDSPEED );
+
+    cout << "Test on yearly totals derived from the monthly cells" << endl;
+    Assert( yearly.GetCount() == 3, "2016 has 3 wind speed readings" );
+    Assert( yearly.GetSum() == 60, "2016 wind speed sum is 60" );
+    Assert( yearly.GetMaximum() == 30, "2016 wind speed maximum is 30" );
+    cout << endl;
+}
+
+void TestSketches( const SummaryCube &summaryCube )
+{
+    const QuantileSketch &march = summaryCube.GetMonthlySketch( 3, 2016, MeasurementType::SOLARRADIATION );
+    QuantileSketch yearly = summaryCube.GetYearlySketch( 2016, MeasurementType::WINDSPEED );
+
+    cout << "Test on quantile sketches" << endl;
+    Assert( march.GetCount() == 2, "March 2016 sketch holds 2 readings" );
+    Assert( march.GetQuantile( 0.5 ) == 500 && march.GetQuantile( 0.99 ) == 600, "March 2016 solar radiation median is 500 and p99 is 600" );
+    Assert( yearly.GetCount() == 3 && yearly.GetQuantile( 0.5 ) == 20, "2016 wind speed median is 20" );
+    Assert( summaryCube.GetMonthlySketch( 5, 2016, MeasurementType::WINDSPEED ).GetCount() == 0, "Month without data has an empty sketch" );
+    cout << endl;
+}
+
+void TestIncrementalAppend( SummaryCube &summaryCube )
+{
+    summaryCube.Add( MakeRecord( 3, 3, 2016, 30, 0, 22 ) );
+
+    cout << "Test on incremental append to the SummaryCube" << endl;
+    Assert( summaryCube.GetMonthly( 3, 2016, MeasurementType::WINDSPEED ).GetCount() == 3, "March 2016 has 3 wind speed readings after append" );
+    Assert( summaryCube.GetMonthly( 3, 2016, MeasurementType::WINDSPEED ).GetMean() == 20, "March 2016 wind speed mean is 20 after append" );
+    Assert( summaryCube.GetYearly( 2016, MeasurementType::WINDSPEED ).GetCount() == 4, "2016 yearly total follows the append" );
+    cout << endl;
+}
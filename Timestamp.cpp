@@ -0,0 +1,52 @@
+
+#include "Timestamp.h"
+
+const unsigned Timestamp::MINUTES_PER_HOUR;
+const unsigned Timestamp::MINUTES_PER_DAY;
+
+unsigned Timestamp::Pack( const Date &date, const Time &time )
+{
+    return Pack( date.GetDay(), date.GetMonth(), date.GetYear(), time.GetHour(), time.GetMinute() );
+}
+
+unsigned Timestamp::Pack( const unsigned &day, const unsigned &month, const unsigned &year, const unsigned &hour, const unsigned &minute )
+{
+    return GetDayNumber( day, month, year ) * MINUTES_PER_DAY + hour * MINUTES_PER_HOUR + minute;
+}
+
+void Timestamp::Unpack( const unsigned &timestamp, Date &date, Time &time )
+{
+    unsigned minuteOfDay = timestamp % MINUTES_PER_DAY;
+
+    // Inverse of GetDayNumber(), working in 400 year eras of 146097 days starting 1 March 0000.
+    unsigned days = timestamp / MINUTES_PER_DAY + 719468;
+    unsigned era = days / 146097;
+    unsigned dayOfEra = days - era * 146097;
+    unsigned yearOfEra = ( dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096 ) / 365;
+    unsigned dayOfYear = dayOfEra - ( 365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100 );
+    unsigned shiftedMonth = ( 5 * dayOfYear + 2 ) / 153;
+    unsigned day = dayOfYear - ( 153 * shiftedMonth + 2 ) / 5 + 1;
+    unsigned month = ( shiftedMonth < 10 ) ? shiftedMonth + 3 : shiftedMonth - 9;
+    unsigned year = yearOfEra + era * 400 + ( ( month <= 2 ) ? 1 : 0 );
+
+    date = Date( day, month, year );
+    time = Time( minuteOfDay / MINUTES_PER_HOUR, minuteOfDay % MINUTES_PER_HOUR );
+}
+
+unsigned Timestamp::GetDayNumber( const unsigned &day, const unsigned &month, const unsigned &year )
+{
+    // Counting years from March puts the leap day last, so the day of year is a linear formula.
+    unsigned shiftedYear = ( month <= 2 ) ? year - 1 : year;
+    unsigned era = shiftedYear / 400;
+    unsigned yearOfEra = shiftedYear - era * 400;
+    unsigned shiftedMonth = ( month > 2 ) ? month - 3 : month + 9;
+    unsigned dayOfYear = ( 153 * shiftedMonth + 2 ) / 5 + day - 1;
+    unsigned dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;
+
+    return era * 146097 + dayOfEra - 719468;
+}
+
+unsigned Timestamp::MakeYearMonthKey( const unsigned &month, const unsigned &year )
+{
+    return year * 12 + ( month - 1 );
+}
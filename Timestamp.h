@@ -0,0 +1,76 @@
+/**
+ * @file Timestamp.h
+ * @brief Defines the Timestamp class, which packs a date and time into a single ordered number.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef TIMESTAMP_H_INCLUDED
+#define TIMESTAMP_H_INCLUDED
+
+#include "Date.h"
+#include "Time.h"
+
+/**
+* @brief Packs dates and times into minutes since 1 January 1970.
+*
+* Packed timestamps compare in the same order as the date and time they were packed from,
+* so time ordered indexes can binary search a single unsigned instead of a Date and a Time.
+* The day number uses the proleptic Gregorian calendar, valid for any year from 1970.
+*/
+class Timestamp
+{
+public:
+    static const unsigned MINUTES_PER_HOUR = 60;    ///< Number of minutes in an hour.
+    static const unsigned MINUTES_PER_DAY = 1440;   ///< Number of minutes in a day.
+
+    /**
+    * @brief Packs a date and a time.
+    *
+    * @param[in] date The date to pack.
+    * @param[in] time The time of day to pack.
+    * @return The minutes from 1 January 1970 00:00 to the date and time.
+    */
+    static unsigned Pack( const Date &date, const Time &time );
+
+    /**
+    * @brief Packs a date and a time given as fields.
+    *
+    * @param[in] day The day of the month.
+    * @param[in] month The month of the year.
+    * @param[in] year The year.
+    * @param[in] hour The hour of the day.
+    * @param[in] minute The minute of the hour.
+    * @return The minutes from 1 January 1970 00:00 to the date and time.
+    */
+    static unsigned Pack( const unsigned &day, const unsigned &month, const unsigned &year, const unsigned &hour = 0, const unsigned &minute = 0 );
+
+    /**
+    * @brief Unpacks a timestamp back into a date and a time.
+    *
+    * @param[in] timestamp The packed timestamp.
+    * @param[out] date The date of the timestamp.
+    * @param[out] time The time of day of the timestamp.
+    */
+    static void Unpack( const unsigned &timestamp, Date &date, Time &time );
+
+    /**
+    * @brief Counts the days from 1 January 1970 to a date.
+    *
+    * @param[in] day The day of the month.
+    * @param[in] month The month of the year.
+    * @param[in] year The year.
+    * @return The day number of the date, 0 for 1 January 1970.
+    */
+    static unsigned GetDayNumber( const unsigned &day, const unsigned &month, const unsigned &year );
+
+    /**
+    * @brief Packs a month and a year into a single key.
+    *
+    * @param[in] month The month between 1 ~ 12.
+    * @param[in] year The year.
+    * @return The key, ordered by year then month, so consecutive months have consecutive keys.
+    */
+    static unsigned MakeYearMonthKey( const unsigned &month, const unsigned &year );
+};
+
+#endif // TIMESTAMP_H_INCLUDED
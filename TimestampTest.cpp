@@ -0,0 +1,84 @@
+#include<iostream>
+
+#include "Timestamp.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestDayNumber();
+void TestPack();
+void TestUnpack();
+void TestYearMonthKey();
+
+int main()
+{
+    TestDayNumber();
+    TestPack();
+    TestUnpack();
+    TestYearMonthKey();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestDayNumber()
+{
+    cout << "Test on day numbers" << endl;
+    Assert( Timestamp::GetDayNumber( 1, 1, 1970 ) == 0, "1 January 1970 is day 0" );
+    Assert( Timestamp::GetDayNumber( 1, 3, 2016 ) - Timestamp::GetDayNumber( 28, 2, 2016 ) == 2, "2016 has a leap day" );
+    Assert( Timestamp::GetDayNumber( 1, 3, 2015 ) - Timestamp::GetDayNumber( 28, 2, 2015 ) == 1, "2015 has no leap day" );
+    Assert( Timestamp::GetDayNumber( 1, 1, 2017 ) - Timestamp::GetDayNumber( 1, 1, 2016 ) == 366, "2016 has 366 days" );
+    cout << endl;
+}
+
+void TestPack()
+{
+    cout << "Test on packing" << endl;
+    Assert( Timestamp::Pack( 1, 1, 1970, 0, 1 ) == 1, "One minute after the epoch packs to 1" );
+    Assert( Timestamp::Pack( Date( 2, 1, 1970 ), Time( 0, 0 ) ) == Timestamp::MINUTES_PER_DAY, "Midnight of the second day packs to a day of minutes" );
+    Assert( Timestamp::Pack( 31, 12, 2015, 23, 50 ) < Timestamp::Pack( 1, 1, 2016, 0, 0 ), "Packed timestamps keep time order across years" );
+    Assert( Timestamp::Pack( 1, 3, 2016, 9, 10 ) - Timestamp::Pack( 1, 3, 2016, 9, 0 ) == 10, "Ten minutes apart pack ten apart" );
+    cout << endl;
+}
+
+void TestUnpack()
+{
+    Date date;
+    Time time;
+
+    cout << "Test on unpacking" << endl;
+    Timestamp::Unpack( Timestamp::Pack( 29, 2, 2016, 13, 45 ), date, time );
+    Assert( date.GetDay() == 29 && date.GetMonth() == 2 && date.GetYear() == 2016, "Leap day unpacks to its date" );
+    Assert( time.GetHour() == 13 && time.GetMinute() == 45, "Leap day unpacks to its time" );
+
+    bool roundTrip = true;
+    for( unsigned day( Timestamp::GetDayNumber( 1, 1, 2010 ) ); day < Timestamp::GetDayNumber( 1, 1, 2031 ); day++ )
+    {
+        Timestamp::Unpack( day * Timestamp::MINUTES_PER_DAY, date, time );
+        if( Timestamp::GetDayNumber( date.GetDay(), date.GetMonth(), date.GetYear() ) != day )
+        {
+            roundTrip = false;
+        }
+    }
+    Assert( roundTrip, "Every day from 2010 to 2030 round trips" );
+    cout << endl;
+}
+
+void TestYearMonthKey()
+{
+    cout << "Test on month and year keys" << endl;
+    Assert( Timestamp::MakeYearMonthKey( 4, 2016 ) == Timestamp::MakeYearMonthKey( 3, 2016 ) + 1, "Keys of consecutive months are consecutive" );
+    Assert( Timestamp::MakeYearMonthKey( 1, 2017 ) == Timestamp::MakeYearMonthKey( 12, 2016 ) + 1, "December is followed by the January of the next year" );
+    cout << endl;
+}
@@ -108,6 +108,13 @@ public:
     */
     T *Start();
 
+    /**
+    * @brief Read only pointer that points on the start of the vector index[0].
+    *
+    * @return The vector index [0].
+    */
+    const T *Start() const;
+
     /**
     * @brief Pointer that points on the end of the vector index.
     *
@@ -115,6 +122,13 @@ public:
     */
     T *Finish();
 
+    /**
+    * @brief Read only pointer that points on the end of the vector index.
+    *
+    * @return The end of the vector index.
+    */
+    const T *Finish() const;
+
     /** @} */
 
     /**
@@ -131,6 +145,14 @@ public:
     */
     T &operator [] (const unsigned &index );
 
+    /**
+    * @brief Read only access of an element by vector's index.
+    *
+    * @param[in] index The index of the element to access in the vector.
+    * @return const element object.
+    */
+    const T &operator [] (const unsigned &index ) const;
+
     /** @} */
 
     /**
@@ -183,6 +205,18 @@ public:
     */
     bool RemoveAt( const unsigned &index );
 
+    /**
+    * @brief Sets the number of used elements of the vector.
+    *
+    * Grows the capacity by calling the Resize() method until the vector is at most half full,
+    * so the elements can be written directly through Start(). Elements past the previous
+    * number of used elements are left as they were allocated.
+    *
+    * @param[in] size The new number of used elements.
+    * @return True if the operation was successful, false otherwise.
+    */
+    bool SetSize( const unsigned &size );
+
     /** @} */
 
 private:
@@ -243,10 +277,7 @@ Vector<T>::~Vector()
 template<class T>
 Vector<T>::Vector( const Vector &otherVector )
 {
-    if ( m_array != nullptr )
-    {
-        Deallocate( m_array );
-    }
+    m_array = nullptr;
     CopyVector( otherVector );
 }
 
@@ -288,18 +319,36 @@ T *Vector<T>::Start()
     return m_array;
 }
 
+template<class T>
+const T *Vector<T>::Start() const
+{
+    return m_array;
+}
+
 template<class T>
 T *Vector<T>::Finish()
 {
     return (m_array + m_used);
 }
 
+template<class T>
+const T *Vector<T>::Finish() const
+{
+    return (m_array + m_used);
+}
+
 template<class T>
 T &Vector<T>::operator [] ( const unsigned &index )
 {
     return m_array[index];
 }
 
+template<class T>
+const T &Vector<T>::operator [] ( const unsigned &index ) const
+{
+    return m_array[index];
+}
+
 template<class T>
 bool Vector<T>::InsertLast( const T &object )
 {
@@ -363,6 +412,16 @@ bool Vector<T>::RemoveAt( const unsigned &index )
 }
 
 
+template<class T>
+bool Vector<T>::SetSize( const unsigned &size )
+{
+    while( size >= m_capacity / 2 )
+    {
+        Resize();
+    }
+    m_used = size;
+    return true;
+}
 
 template<class T>
 void Vector<T>::Deallocate( T *&ptr )
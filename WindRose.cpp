@@ -0,0 +1,208 @@
+
+#include "WindRose.h"
+
+#include<cmath>
+#include<sstream>
+
+const unsigned WindRose::SECTOR_COUNT;
+const float WindRose::SECTOR_WIDTH = 360.0f / WindRose::SECTOR_COUNT;
+const float WindRose::DEFAULT_SPEED_LIMITS[] = { 2, 4, 6, 8, 10 };
+const unsigned WindRose::DEFAULT_LIMIT_COUNT = sizeof( WindRose::DEFAULT_SPEED_LIMITS ) / sizeof( float );
+
+WindRose::WindRose()
+    : WindRose( DEFAULT_SPEED_LIMITS, DEFAULT_LIMIT_COUNT ) {}
+
+WindRose::WindRose( const float speedLimits[], const unsigned &limitCount )
+{
+    for( unsigned limit(0); limit < limitCount; limit++ )
+    {
+        m_speedLimits.InsertLast( speedLimits[limit] );
+    }
+    m_counts.SetSize( SECTOR_COUNT * GetSpeedClassCount() );
+    Clear();
+}
+
+bool WindRose::Add( const float &direction, const float &speed )
+{
+    if( !std::isfinite( direction ) || !std::isfinite( speed ) )
+    {
+        return false;
+    }
+
+    m_counts[GetSector( direction ) * GetSpeedClassCount() + GetSpeedClass( speed )] ++;
+    m_total ++;
+    return true;
+}
+
+bool WindRose::Merge( const WindRose &other )
+{
+    if( other.m_speedLimits.GetUsed() != m_speedLimits.GetUsed() )
+    {
+        return false;
+    }
+    for( unsigned limit(0); limit < m_speedLimits.GetUsed(); limit++ )
+    {
+        if( other.m_speedLimits[limit] != m_speedLimits[limit] )
+        {
+            return false;
+        }
+    }
+
+    for( unsigned cell(0); cell < m_counts.GetUsed(); cell++ )
+    {
+        m_counts[cell] += other.m_counts[cell];
+    }
+    m_total += other.m_total;
+    return true;
+}
+
+void WindRose::Clear()
+{
+    for( unsigned cell(0); cell < m_counts.GetUsed(); cell++ )
+    {
+        m_counts[cell] = 0;
+    }
+    m_total = 0;
+}
+
+unsigned WindRose::GetSpeedClassCount() const
+{
+    return m_speedLimits.GetUsed() + 1;
+}
+
+float WindRose::GetLowerLimit( const unsigned &speedClass ) const
+{
+    return speedClass == 0 ? 0.0f : m_speedLimits[speedClass - 1];
+}
+
+string WindRose::GetSpeedClassLabel( const unsigned &speedClass ) const
+{
+    ostringstream label;
+
+    label << GetLowerLimit( speedClass );
+    if( speedClass < m_speedLimits.GetUsed() )
+    {
+        label << '-' << m_speedLimits[speedClass];
+    }
+    else
+    {
+        label << '+';
+    }
+    return label.str();
+}
+
+unsigned WindRose::GetCount( const unsigned &sector, const unsigned &speedClass ) const
+{
+    return m_counts[sector * GetSpeedClassCount() + speedClass];
+}
+
+unsigned WindRose::GetSectorTotal( const unsigned &sector ) const
+{
+    unsigned total = 0;
+    for( unsigned speedClass(0); speedClass < GetSpeedClassCount(); speedClass++ )
+    {
+        total += GetCount( sector, speedClass );
+    }
+    return total;
+}
+
+unsigned WindRose::GetTotal() const
+{
+    return m_total;
+}
+
+void WindRose::WriteCsv( ostream &output ) const
+{
+    output << "sector";
+    for( unsigned speedClass(0); speedClass < GetSpeedClassCount(); speedClass++ )
+    {
+        output << ',' << GetSpeedClassLabel( speedClass );
+    }
+    output << ",total\n";
+
+    for( unsigned sector(0); sector < SECTOR_COUNT; sector++ )
+    {
+        output << GetSectorName( sector );
+        for( unsigned speedClass(0); speedClass < GetSpeedClassCount(); speedClass++ )
+        {
+            output << ',' << GetCount( sector, speedClass );
+        }
+        output << ',' << GetSectorTotal( sector ) << '\n';
+    }
+}
+
+void WindRose::WriteJson( JsonWriter &jsonWriter ) const
+{
+    jsonWriter.BeginObject();
+    jsonWriter.Key( "sectors" ).BeginArray();
+    for( unsigned sector(0); sector < SECTOR_COUNT; sector++ )
+    {
+        jsonWriter.Value( GetSectorName( sector ) );
+    }
+    jsonWriter.EndArray();
+
+    // The last class has no upper limit, written as null
+    jsonWriter.Key( "speedClasses" ).BeginArray();
+    for( unsigned speedClass(0); speedClass < GetSpeedClassCount(); speedClass++ )
+    {
+        jsonWriter.BeginObject().Key( "min" ).Value( GetLowerLimit( speedClass ) ).Key( "max" );
+        if( speedClass < m_speedLimits.GetUsed() )
+        {
+            jsonWriter.Value( m_speedLimits[speedClass] );
+        }
+        else
+        {
+            jsonWriter.Null();
+        }
+        jsonWriter.EndObject();
+    }
+    jsonWriter.EndArray();
+
+    jsonWriter.Key( "counts" ).BeginArray();
+    for( unsigned sector(0); sector < SECTOR_COUNT; sector++ )
+    {
+        jsonWriter.BeginArray();
+        for( unsigned speedClass(0); speedClass < GetSpeedClassCount(); speedClass++ )
+        {
+            jsonWriter.Value( GetCount( sector, speedClass ) );
+        }
+        jsonWriter.EndArray();
+    }
+    jsonWriter.EndArray();
+    jsonWriter.Key( "total" ).Value( m_total );
+    jsonWriter.EndObject();
+}
+
+unsigned WindRose::GetSector( const float &direction )
+{
+    // Shift by half a sector so that N is centred on 0 degrees, then wrap into one turn
+    float turned = std::fmod( direction + SECTOR_WIDTH / 2, 360.0f );
+    if( turned < 0.0f )
+    {
+        turned += 360.0f;
+    }
+
+    unsigned sector = unsigned( turned / SECTOR_WIDTH );
+    return sector < SECTOR_COUNT ? sector : 0;
+}
+
+string_view WindRose::GetSectorName( const unsigned &sector )
+{
+    if( sector >= SECTOR_COUNT )
+    {
+        return "Error";
+    }
+    return SECTOR_NAMES[sector];
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+unsigned WindRose::GetSpeedClass( const float &speed ) const
+{
+    unsigned speedClass = 0;
+    while( speedClass < m_speedLimits.GetUsed() && speed >= m_speedLimits[speedClass] )
+    {
+        speedClass ++;
+    }
+    return speedClass;
+}
@@ -0,0 +1,172 @@
+/**
+ * @file WindRose.h
+ * @brief Defines the WindRose class, a histogram of wind direction sectors by wind speed classes.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef WINDROSE_H_INCLUDED
+#define WINDROSE_H_INCLUDED
+
+#include<iostream>
+#include<string>
+#include<string_view>
+
+#include "Vector.h"
+#include "JsonWriter.h"
+
+using namespace std;
+
+/**
+* @brief Counts readings in a fixed matrix of 16 compass sectors by N wind speed classes.
+*
+* Sector 0 is N and covers 348.75 up to 11.25 degrees, each next sector turning 22.5 degrees
+* clockwise. The speed classes are cut at ascending upper limits, in the unit of the wind speed
+* column: class i holds speeds from limit i - 1 up to but not including limit i, and the last class
+* every speed from the last limit up. The counts are one contiguous row major matrix, so filling a
+* wind rose is a single increment per reading, and two wind roses with the same limits merge by
+* adding their matrices, which is how the Client combines the wind roses of its worker threads.
+*/
+class WindRose
+{
+public:
+    static const unsigned SECTOR_COUNT = 16;    ///< Number of compass sectors.
+    static const float SECTOR_WIDTH;            ///< Width of a sector, in degrees.
+    static const float DEFAULT_SPEED_LIMITS[];  ///< Upper limits of the default speed classes.
+    static const unsigned DEFAULT_LIMIT_COUNT;  ///< Number of default upper limits.
+
+    /**
+    * @brief Default constructor.
+    *
+    * @post Creates an empty wind rose with the default speed classes.
+    */
+    WindRose();
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] speedLimits The ascending upper limits of every speed class but the last.
+    * @param[in] limitCount The number of limits, giving limitCount + 1 speed classes.
+    * @post Creates an empty wind rose with the specified speed classes.
+    */
+    WindRose( const float speedLimits[], const unsigned &limitCount );
+
+    /**
+    * @brief Counts one reading in its sector and speed class.
+    *
+    * @param[in] direction The wind direction, in degrees.
+    * @param[in] speed The wind speed.
+    * @return false, counting nothing, if the direction or the speed is not a finite number, true otherwise.
+    */
+    bool Add( const float &direction, const float &speed );
+
+    /**
+    * @brief Adds the counts of another wind rose to this wind rose.
+    *
+    * @param[in] other The wind rose holding the partial result to combine.
+    * @return false, changing nothing, if the speed classes differ, true otherwise.
+    */
+    bool Merge( const WindRose &other );
+
+    /**
+    * @brief Resets every count back to zero, keeping the speed classes.
+    */
+    void Clear();
+
+    /**
+    * @brief Getter for the number of speed classes.
+    *
+    * @return The number of speed classes.
+    */
+    unsigned GetSpeedClassCount() const;
+
+    /**
+    * @brief Getter for the lower limit of a speed class.
+    *
+    * @param[in] speedClass The index of the speed class.
+    * @return The smallest speed of the class, 0 for the first class.
+    */
+    float GetLowerLimit( const unsigned &speedClass ) const;
+
+    /**
+    * @brief Gets the label of a speed class.
+    *
+    * @param[in] speedClass The index of the speed class.
+    * @return The lower and upper limits, such as "2-4", or the lower limit and a plus for the last class, such as "10+".
+    */
+    string GetSpeedClassLabel( const unsigned &speedClass ) const;
+
+    /**
+    * @brief Getter for the number of readings of a sector and speed class.
+    *
+    * @param[in] sector The index of the sector.
+    * @param[in] speedClass The index of the speed class.
+    * @return The number of readings.
+    */
+    unsigned GetCount( const unsigned &sector, const unsigned &speedClass ) const;
+
+    /**
+    * @brief Getter for the number of readings of a sector.
+    *
+    * @param[in] sector The index of the sector.
+    * @return The number of readings of every speed class of the sector.
+    */
+    unsigned GetSectorTotal( const unsigned &sector ) const;
+
+    /**
+    * @brief Getter for the number of readings.
+    *
+    * @return The number of readings counted.
+    */
+    unsigned GetTotal() const;
+
+    /**
+    * @brief Writes the matrix as CSV, one line per sector and one column per speed class.
+    *
+    * @param[out] output The stream written to.
+    */
+    void WriteCsv( ostream &output ) const;
+
+    /**
+    * @brief Writes the wind rose as a JSON object with its sectors, speed classes, counts and total.
+    *
+    * @param[out] jsonWriter The writer the object is written to.
+    */
+    void WriteJson( JsonWriter &jsonWriter ) const;
+
+    /**
+    * @brief Finds the sector of a direction.
+    *
+    * @param[in] direction The direction in degrees, any number of turns either way.
+    * @return The index of the sector, between 0 and SECTOR_COUNT - 1.
+    */
+    static unsigned GetSector( const float &direction );
+
+    /**
+    * @brief Gets the compass name of a sector.
+    *
+    * @param[in] sector The index of the sector.
+    * @return "N", "NNE", "NE" through "NNW", or "Error" when out of range.
+    */
+    static string_view GetSectorName( const unsigned &sector );
+
+private:
+    static constexpr string_view SECTOR_NAMES[SECTOR_COUNT] =
+    {
+        "N", "NNE", "NE", "ENE", "E", "ESE", "SE", "SSE",
+        "S", "SSW", "SW", "WSW", "W", "WNW", "NW", "NNW"
+    };
+
+    Vector<float> m_speedLimits;    ///< Ascending upper limits of every speed class but the last.
+    Vector<unsigned> m_counts;      ///< Readings of each sector and speed class, sector by sector.
+    unsigned m_total;               ///< Number of readings counted.
+
+    /**
+    * @brief Finds the speed class of a speed.
+    *
+    * @param[in] speed The wind speed.
+    * @return The index of the speed class.
+    */
+    unsigned GetSpeedClass( const float &speed ) const;
+};
+
+#endif // WINDROSE_H_INCLUDED
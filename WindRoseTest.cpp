@@ -0,0 +1,128 @@
+#include<iostream>
+#include<sstream>
+#include<cmath>
+#include<limits>
+
+#include "WindRose.h"
+#include "JsonWriter.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestSectors();
+void TestSpeedClasses();
+void TestMerge();
+void TestOutput();
+
+int main()
+{
+    TestSectors();
+    TestSpeedClasses();
+    TestMerge();
+    TestOutput();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestSectors()
+{
+    cout << "Test on sectors" << endl;
+    Assert( WindRose::GetSector( 0 ) == 0 && WindRose::GetSector( 350 ) == 0 && WindRose::GetSector( 11 ) == 0,
+            "north covers both sides of 0 degrees" );
+    Assert( WindRose::GetSector( 11.25f ) == 1 && WindRose::GetSector( 348.75f ) == 0 && WindRose::GetSector( 348.7f ) == 15,
+            "a sector starts at its lower boundary" );
+    Assert( WindRose::GetSector( 90 ) == 4 && WindRose::GetSector( 180 ) == 8 && WindRose::GetSector( 270 ) == 12,
+            "east, south and west are sectors 4, 8 and 12" );
+    Assert( WindRose::GetSector( -90 ) == 12 && WindRose::GetSector( 360 ) == 0 && WindRose::GetSector( 810 ) == 4,
+            "negative directions and whole turns wrap around" );
+    Assert( WindRose::GetSectorName( 0 ) == "N" && WindRose::GetSectorName( 15 ) == "NNW" && WindRose::GetSectorName( 16 ) == "Error",
+            "sectors are named by their compass point" );
+    cout << endl;
+}
+
+void TestSpeedClasses()
+{
+    WindRose windRose;
+    const float limits[] = { 5, 15 };
+    WindRose custom( limits, 2 );
+
+    cout << "Test on speed classes" << endl;
+    Assert( windRose.GetSpeedClassCount() == 6 && windRose.GetSpeedClassLabel( 0 ) == "0-2"
+            && windRose.GetSpeedClassLabel( 1 ) == "2-4" && windRose.GetSpeedClassLabel( 5 ) == "10+",
+            "the default classes step by 2 up to 10 and above" );
+
+    windRose.Add( 0, 0 );
+    windRose.Add( 0, 1.99f );
+    windRose.Add( 0, 2 );
+    windRose.Add( 90, 10 );
+    windRose.Add( 90, 45 );
+    Assert( windRose.GetCount( 0, 0 ) == 2 && windRose.GetCount( 0, 1 ) == 1 && windRose.GetCount( 4, 5 ) == 2,
+            "a speed on a limit falls in the class above it" );
+    Assert( windRose.GetSectorTotal( 0 ) == 3 && windRose.GetSectorTotal( 4 ) == 2 && windRose.GetTotal() == 5,
+            "sector totals add up to the total" );
+
+    float missing = numeric_limits<float>::quiet_NaN();
+    Assert( !windRose.Add( missing, 3 ) && !windRose.Add( 90, missing ) && windRose.GetTotal() == 5,
+            "missing directions or speeds are not counted" );
+
+    custom.Add( 180, 10 );
+    Assert( custom.GetSpeedClassCount() == 3 && custom.GetSpeedClassLabel( 1 ) == "5-15" && custom.GetCount( 8, 1 ) == 1,
+            "speed classes are cut at the given limits" );
+    cout << endl;
+}
+
+void TestMerge()
+{
+    WindRose first;
+    WindRose second;
+    const float limits[] = { 5, 15 };
+    WindRose custom( limits, 2 );
+
+    cout << "Test on merging" << endl;
+    first.Add( 45, 3 );
+    second.Add( 45, 3 );
+    second.Add( 270, 12 );
+    Assert( first.Merge( second ) && first.GetCount( 2, 1 ) == 2 && first.GetCount( 12, 5 ) == 1 && first.GetTotal() == 3,
+            "merging adds the counts of each cell" );
+    Assert( !first.Merge( custom ) && first.GetTotal() == 3, "wind roses with other speed classes are not merged" );
+
+    first.Clear();
+    Assert( first.GetTotal() == 0 && first.GetCount( 2, 1 ) == 0 && first.GetSpeedClassCount() == 6,
+            "clearing keeps the speed classes" );
+    cout << endl;
+}
+
+void TestOutput()
+{
+    const float limits[] = { 5 };
+    WindRose windRose( limits, 1 );
+    ostringstream csv;
+    ostringstream json;
+    JsonWriter jsonWriter( json );
+
+    cout << "Test on output" << endl;
+    windRose.Add( 0, 3 );
+    windRose.Add( 22.5f, 8 );
+    windRose.WriteCsv( csv );
+    Assert( csv.str().compare( 0, 47, "sector,0-5,5+,total\nN,1,0,1\nNNE,0,1,1\nNE,0,0,0\n" ) == 0,
+            "the CSV has a line per sector and a column per speed class" );
+
+    windRose.WriteJson( jsonWriter );
+    jsonWriter.Flush();
+    Assert( json.str().find( "\"speedClasses\":[{\"min\":0,\"max\":5},{\"min\":5,\"max\":null}]" ) != string::npos
+            && json.str().find( "\"counts\":[[1,0],[0,1],[0,0]" ) != string::npos
+            && json.str().find( "\"total\":2}" ) != string::npos, "the JSON holds the speed classes, counts and total" );
+    cout << endl;
+}
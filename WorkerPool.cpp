@@ -0,0 +1,122 @@
+
+#include "WorkerPool.h"
+
+WorkerPool::WorkerPool( const unsigned &threadCount )
+{
+    unsigned workers = ( threadCount == 0 ) ? GetDefaultThreadCount() : threadCount;
+
+    m_stopping = false;
+    for( unsigned i(0); i < workers; i++ )
+    {
+        m_threads.InsertLast( new std::thread( &WorkerPool::WorkerLoop, this ) );
+    }
+}
+
+WorkerPool::~WorkerPool()
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_stopping = true;
+    }
+    m_taskReady.notify_all();
+
+    for( unsigned i(0); i < m_threads.GetUsed(); i++ )
+    {
+        m_threads[i]->join();
+        delete m_threads[i];
+    }
+}
+
+unsigned WorkerPool::GetThreadCount() const
+{
+    return m_threads.GetUsed();
+}
+
+void WorkerPool::Submit( const std::function<void()> &task )
+{
+    {
+        std::lock_guard<std::mutex> lock( m_mutex );
+        m_tasks.push( task );
+    }
+    m_taskReady.notify_one();
+}
+
+unsigned WorkerPool::ParallelFor( const unsigned &begin, const unsigned &end, const unsigned &minimumChunk, const ChunkTask &task )
+{
+    if( end <= begin )
+    {
+        return 0;
+    }
+
+    unsigned size = end - begin;
+    unsigned chunks = GetThreadCount();
+    unsigned chunksBySize = ( minimumChunk == 0 ) ? size : size / minimumChunk;
+    if( chunksBySize < chunks )
+    {
+        chunks = ( chunksBySize == 0 ) ? 1 : chunksBySize;
+    }
+
+    if( chunks == 1 )
+    {
+        task( 0, begin, end );
+        return 1;
+    }
+
+    std::mutex doneMutex;
+    std::condition_variable allDone;
+    unsigned remaining = chunks;
+
+    for( unsigned chunk(0); chunk < chunks; chunk++ )
+    {
+        unsigned chunkBegin = begin + unsigned( ( unsigned long long )size * chunk / chunks );
+        unsigned chunkEnd = begin + unsigned( ( unsigned long long )size * ( chunk + 1 ) / chunks );
+
+        Submit( [&, chunk, chunkBegin, chunkEnd]()
+        {
+            task( chunk, chunkBegin, chunkEnd );
+
+            std::lock_guard<std::mutex> lock( doneMutex );
+            if( --remaining == 0 )
+            {
+                allDone.notify_one();
+            }
+        } );
+    }
+
+    std::unique_lock<std::mutex> lock( doneMutex );
+    allDone.wait( lock, [&remaining]()
+    {
+        return remaining == 0;
+    } );
+    return chunks;
+}
+
+unsigned WorkerPool::GetDefaultThreadCount()
+{
+    unsigned hardwareThreads = std::thread::hardware_concurrency();
+    return ( hardwareThreads == 0 ) ? 1 : hardwareThreads;
+}
+
+// ++++++++++++ PRIVATE ++++++++++++++++++++++++
+// ++++++++++++++++++++++++++++++++++++++++++++
+void WorkerPool::WorkerLoop()
+{
+    while( true )
+    {
+        std::function<void()> task;
+        {
+            std::unique_lock<std::mutex> lock( m_mutex );
+            m_taskReady.wait( lock, [this]()
+            {
+                return m_stopping || !m_tasks.empty();
+            } );
+            if( m_tasks.empty() )
+            {
+                return;
+            }
+            task = m_tasks.front();
+            m_tasks.pop();
+        }
+        task();
+    }
+}
@@ -0,0 +1,104 @@
+/**
+ * @file WorkerPool.h
+ * @brief Defines the WorkerPool class, a fixed set of worker threads running submitted tasks.
+ * @author Chan Kok Wai
+ * @version 1.0.0
+ */
+#ifndef WORKERPOOL_H_INCLUDED
+#define WORKERPOOL_H_INCLUDED
+
+#include<thread>
+#include<mutex>
+#include<condition_variable>
+#include<functional>
+#include<queue>
+
+#include "Vector.h"
+
+/**
+* @brief Represents a pool of worker threads that run tasks from a shared queue.
+*
+* The threads are started once by the constructor and joined by the destructor. ParallelFor()
+* partitions an index range into one chunk per worker and blocks until every chunk is done,
+* which is how the Client reductions split the record range across cores.
+*
+* @note ParallelFor() must not be called from inside a task of the same pool.
+*/
+class WorkerPool
+{
+public:
+
+    /**
+    * @brief Task run by ParallelFor() on one chunk of the range.
+    *
+    * The parameters are the chunk number, the first index of the chunk and one past the last index.
+    */
+    using ChunkTask = std::function<void( unsigned, unsigned, unsigned )>;
+
+    /**
+    * @brief Parameterized constructor.
+    *
+    * @param[in] threadCount The number of worker threads, 0 for GetDefaultThreadCount().
+    * @post Creates a WorkerPool with the worker threads started and waiting for tasks.
+    */
+    WorkerPool( const unsigned &threadCount = 0 );
+
+    /**
+    * @brief Destructor.
+    *
+    * Finishes the queued tasks, then stops and joins every worker thread.
+    */
+    ~WorkerPool();
+
+    WorkerPool( const WorkerPool & ) = delete;
+    WorkerPool &operator = ( const WorkerPool & ) = delete;
+
+    /**
+    * @brief Getter for the number of worker threads.
+    *
+    * @return The number of worker threads.
+    */
+    unsigned GetThreadCount() const;
+
+    /**
+    * @brief Queues a task to run on the next free worker thread.
+    *
+    * @param[in] task The task to run.
+    */
+    void Submit( const std::function<void()> &task );
+
+    /**
+    * @brief Runs a task over an index range split into one chunk per worker thread.
+    *
+    * Blocks until every chunk has finished. A range shorter than minimumChunk per worker is
+    * split into fewer chunks, and a single chunk is run directly on the calling thread.
+    *
+    * @param[in] begin The first index of the range.
+    * @param[in] end One past the last index of the range.
+    * @param[in] minimumChunk The smallest number of indexes worth handing to a worker.
+    * @param[in] task The task to run on each chunk.
+    * @return The number of chunks the range was split into.
+    */
+    unsigned ParallelFor( const unsigned &begin, const unsigned &end, const unsigned &minimumChunk, const ChunkTask &task );
+
+    /**
+    * @brief Gets the number of hardware threads, the default size of a pool.
+    *
+    * @return The hardware concurrency, at least 1.
+    */
+    static unsigned GetDefaultThreadCount();
+
+private:
+    Vector<std::thread *> m_threads;                ///< Worker threads.
+    std::queue< std::function<void()> > m_tasks;    ///< Tasks waiting for a worker.
+    std::mutex m_mutex;                             ///< Guards the task queue and the stopping flag.
+    std::condition_variable m_taskReady;            ///< Signalled when a task is queued or the pool stops.
+    bool m_stopping;                                ///< Set by the destructor to stop the workers.
+
+    /**
+    * @brief Loop run by each worker thread, taking tasks until the pool stops.
+    */
+    void WorkerLoop();
+};
+
+#endif // WORKERPOOL_H_INCLUDED
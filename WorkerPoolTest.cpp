@@ -0,0 +1,111 @@
+
+#include<iostream>
+#include<atomic>
+
+#include "WorkerPool.h"
+
+using namespace std;
+
+void Assert( bool condition, const string &message );
+void TestThreadCount();
+void TestSubmittedTasks();
+void TestParallelForCoversRange();
+void TestParallelForSmallRange();
+
+int main()
+{
+    TestThreadCount();
+    TestSubmittedTasks();
+    TestParallelForCoversRange();
+    TestParallelForSmallRange();
+
+    return 0;
+}
+
+void Assert( bool condition, const string &message )
+{
+    if( condition )
+    {
+        cout << "\t[ PASS ] " << message << endl;
+    }
+    else
+    {
+        cout << "\t[ FAIL ] " << message << endl;
+    }
+}
+
+void TestThreadCount()
+{
+    WorkerPool defaultPool;
+    WorkerPool fourPool( 4 );
+
+    cout << "Test on the number of worker threads" << endl;
+    Assert( defaultPool.GetThreadCount() == WorkerPool::GetDefaultThreadCount(), "Default pool uses the hardware concurrency" );
+    Assert( WorkerPool::GetDefaultThreadCount() >= 1, "Hardware concurrency is at least 1" );
+    Assert( fourPool.GetThreadCount() == 4, "Pool of 4 has 4 worker threads" );
+    cout << endl;
+}
+
+void TestSubmittedTasks()
+{
+    atomic<unsigned> finished( 0 );
+    {
+        WorkerPool pool( 3 );
+        for( unsigned i(0); i < 100; i++ )
+        {
+            pool.Submit( [&finished]()
+            {
+                finished ++;
+            } );
+        }
+    }
+
+    cout << "Test on submitted tasks" << endl;
+    Assert( finished == 100, "Every queued task runs before the pool is destroyed" );
+    cout << endl;
+}
+
+void TestParallelForCoversRange()
+{
+    const unsigned size = 10000;
+    static unsigned char visited[size] = { 0 };
+    atomic<unsigned> total( 0 );
+    WorkerPool pool( 4 );
+
+    unsigned chunks = pool.ParallelFor( 0, size, 100, [&]( unsigned chunk, unsigned begin, unsigned end )
+    {
+        for( unsigned i(begin); i < end; i++ )
+        {
+            visited[i] ++;
+        }
+        total += end - begin;
+    } );
+
+    bool once = true;
+    for( unsigned i(0); i < size; i++ )
+    {
+        once = once && visited[i] == 1;
+    }
+
+    cout << "Test on ParallelFor covering a range" << endl;
+    Assert( chunks == 4, "Range is split into one chunk per worker" );
+    Assert( total == size, "Chunks add up to the whole range" );
+    Assert( once, "Every index is visited exactly once" );
+    cout << endl;
+}
+
+void TestParallelForSmallRange()
+{
+    WorkerPool pool( 4 );
+    unsigned calls = 0;
+
+    unsigned chunks = pool.ParallelFor( 5, 50, 100, [&calls]( unsigned chunk, unsigned begin, unsigned end )
+    {
+        calls ++;
+    } );
+
+    cout << "Test on ParallelFor with a small range" << endl;
+    Assert( chunks == 1 && calls == 1, "Range below the minimum chunk runs as a single chunk" );
+    Assert( pool.ParallelFor( 7, 7, 1, []( unsigned, unsigned, unsigned ) {} ) == 0, "Empty range runs no chunks" );
+    cout << endl;
+}